@@ -4,21 +4,26 @@
 #include "freertos/task.h"
 #include "freertos/event_groups.h"
 #include "esp_sleep.h"
+#include "driver/rtc_io.h"
 #include "esp_log.h"
 #include "hardware.h"
 #include "wifi_manager.h"
 #include "sntp_manager.h"
-#include "esp_http_client.h"
+#include "timezone_manager.h"
+#include "calendar_manager.h"
+#include "lunar_calendar.h"
 
 /**
  * @brief Application states
  */
 typedef enum {
     APP_STATE_INIT,
+    APP_STATE_SHOW_CACHED,
     APP_STATE_WIFI_CONNECT,
     APP_STATE_SYNC_TIMEZONE_START,
     APP_STATE_SYNC_TIMEZONE_WAIT,
     APP_STATE_SYNC_TIME,
+    APP_STATE_SYNC_CALENDAR,
     APP_STATE_IDLE,
     APP_STATE_DEEPSLEEP,
     APP_STATE_ERROR,
@@ -33,70 +38,6 @@ static EventGroupHandle_t app_event_group;
 static app_state_t current_state = APP_STATE_INIT;
 static int idle_loops = 0;
 
-esp_err_t _http_event_handler_print_raw(esp_http_client_event_t *evt)
-{
-    switch(evt->event_id) {
-        case HTTP_EVENT_ERROR:
-            break;
-        case HTTP_EVENT_ON_CONNECTED:
-            break;
-        case HTTP_EVENT_HEADER_SENT:
-            break;
-        case HTTP_EVENT_ON_HEADER:
-            break;
-        case HTTP_EVENT_ON_DATA:
-            printf("RAW_DATA: %.*s\n", evt->data_len, (char*)evt->data);
-            break;
-        case HTTP_EVENT_ON_FINISH:
-            break;
-        case HTTP_EVENT_DISCONNECTED:
-            break;
-        case HTTP_EVENT_REDIRECT:
-            break;
-        default:
-            break;
-    }
-    return ESP_OK;
-}
-
-bool glance_timezone_sync(void)
-{
-    printf("glance_timezone_sync: Starting...\n");
-
-    esp_http_client_config_t config = {
-        .url = "http://ip-api.com/json",
-        .event_handler = _http_event_handler_print_raw,
-    };
-
-    printf("glance_timezone_sync: Initializing HTTP client...\n");
-    esp_http_client_handle_t client = esp_http_client_init(&config);
-    if (client == NULL) {
-        printf("glance_timezone_sync: Failed to initialize HTTP client\n");
-        return false;
-    }
-
-    printf("glance_timezone_sync: Performing HTTP GET request...\n");
-    esp_err_t err = esp_http_client_perform(client);
-    printf("glance_timezone_sync: HTTP GET request finished.\n");
-
-    bool success = false;
-    if (err == ESP_OK) {
-        printf("HTTP GET Status = %d, content_length = %lld\n",
-                (int)esp_http_client_get_status_code(client),
-                (long long)esp_http_client_get_content_length(client));
-        if (esp_http_client_get_status_code(client) == 200) {
-            success = true;
-        }
-    } else {
-        printf("HTTP GET request failed: %s\n", esp_err_to_name(err));
-    }
-
-    printf("glance_timezone_sync: Cleaning up HTTP client...\n");
-    esp_http_client_cleanup(client);
-    printf("glance_timezone_sync: Finished.\n");
-    return success;
-}
-
 void timezone_sync_task(void *pvParameters)
 {
     if (glance_timezone_sync()) {
@@ -117,7 +58,23 @@ void app_main(void)
                 printf("Entering state: INIT\n");
                 app_event_group = xEventGroupCreate();
                 hardware_init();
-                current_state = APP_STATE_WIFI_CONNECT;
+                glance_timezone_load_saved(); // Local time until the next sync
+                if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_EXT0) {
+                    current_state = APP_STATE_SHOW_CACHED; // Button wake, no sync needed
+                } else {
+                    current_state = APP_STATE_WIFI_CONNECT;
+                }
+                break;
+
+            case APP_STATE_SHOW_CACHED:
+                printf("Entering state: SHOW_CACHED\n");
+                display_hardware_init(); // The external flash shares the display's SPI bus
+                if (calendar_load_cached()) {
+                    current_state = APP_STATE_IDLE;
+                    idle_loops = 0; // Reset idle loop counter
+                } else {
+                    current_state = APP_STATE_WIFI_CONNECT;
+                }
                 break;
 
             case APP_STATE_WIFI_CONNECT:
@@ -170,10 +127,29 @@ void app_main(void)
                 printf("Entering state: SYNC_TIME\n");
                 hardware_set_led(true); // Turn LED on while syncing
                 if (glance_sntp_sync_time()) {
+                    current_state = APP_STATE_SYNC_CALENDAR;
+                } else {
+                    printf("Time synchronization failed.\n");
+                    current_state = APP_STATE_ERROR;
+                }
+                hardware_set_led(false); // Turn LED off
+                break;
+
+            case APP_STATE_SYNC_CALENDAR:
+                printf("Entering state: SYNC_CALENDAR\n");
+                hardware_set_led(true); // Turn LED on while downloading
+                if (calendar_sync()) {
+                    if (!calendar_events_changed(NULL)) {
+                        printf("No changes since the last sync, display refresh not needed.\n");
+                    }
                     current_state = APP_STATE_IDLE;
                     idle_loops = 0; // Reset idle loop counter
+                } else if (calendar_load_cached()) {
+                    printf("Calendar synchronization failed, showing saved events.\n");
+                    current_state = APP_STATE_IDLE;
+                    idle_loops = 0;
                 } else {
-                    printf("Time synchronization failed.\n");
+                    printf("Calendar synchronization failed.\n");
                     current_state = APP_STATE_ERROR;
                 }
                 hardware_set_led(false); // Turn LED off
@@ -186,14 +162,23 @@ void app_main(void)
 
                 // Get current time
                 time_t now;
-                struct tm timeinfo;
+                civil_time_t local;
+                char day_label[16];
+                char lunar_label[16] = "";
+                lunar_date_t lunar;
                 time(&now);
-                localtime_r(&now, &timeinfo);
+                calendar_local_time(now, &local);
+                calendar_day_label(now, day_label, sizeof(day_label));
+                int64_t today = civil_days_from_date(local.year, local.month, local.day);
+                if (lunar_date_from_days(today, &lunar)) {
+                    lunar_day_label(&lunar, lunar_label, sizeof(lunar_label));
+                }
 
-                // Format and print time
-                char strftime_buf[64];
-                strftime(strftime_buf, sizeof(strftime_buf), "%c", &timeinfo);
-                printf("Current time: %s\n", strftime_buf);
+                // Print time
+                printf("Current time: %04d-%02d-%02d %02d:%02d:%02d (%s) %s %s\n",
+                        (int)local.year, local.month, local.day,
+                        local.hour, local.minute, local.second, day_label,
+                        lunar_label, taiwan_holiday_name(taiwan_holiday(today)));
 
                 hardware_set_led(idle_loops % 2 == 0); // Blink the LED
 
@@ -209,6 +194,11 @@ void app_main(void)
                 wifi_disconnect();
                 hardware_deinit();
                 
+                // Wake on a button press (active low) to show the saved events
+                rtc_gpio_pullup_en(PIN_BTN);
+                rtc_gpio_pulldown_dis(PIN_BTN);
+                esp_sleep_enable_ext0_wakeup(PIN_BTN, 0);
+
                 printf("Entering deep sleep now.\n");
                 esp_deep_sleep_start();
                 break;
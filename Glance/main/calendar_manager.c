@@ -0,0 +1,1333 @@
+#include "calendar_manager.h"
+#include "credentials.h"
+#include "ics_feed.h"
+#include "event_heap.h"
+#include "event_cache.h"
+#include "feed_validators.h"
+#include "feed_spool.h"
+#include "inflate_stream.h"
+#include "xml_extract.h"
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "esp_http_client.h"
+#include "esp_crt_bundle.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+#include <ctype.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#define DEFAULT_POSIX_TZ        "CST-8" // Used when TZ is not set
+#define CALDAV_MAX_CHANGES      32   // Changed or deleted resources an incremental sync can apply
+#define MAX_CALENDARS           6    // Feeds listed in ICS_URLS
+#define FETCH_TASK_STACK_SIZE   8192 // TLS handshake and the parser callbacks
+#define SPOOL_READ_CHUNK        1024 // Kept bytes replayed into the parser at a time
+
+#ifdef CALDAV_URL
+#define CALENDAR_URLS           CALDAV_URL
+#elif defined(ICS_URLS)
+#define CALENDAR_URLS           ICS_URLS
+#else
+#define CALENDAR_URLS           ICS_URL
+#endif
+
+static const char *TAG = "calendar_manager";
+
+// Calendars in priority order: an event is dropped if a calendar listed before has its UID
+static const char *const calendar_urls[] = {CALENDAR_URLS};
+#define CALENDAR_COUNT          ((int)(sizeof(calendar_urls) / sizeof(calendar_urls[0])))
+
+_Static_assert(CALENDAR_COUNT <= MAX_CALENDARS, "Too many calendars in ICS_URLS");
+_Static_assert(MAX_CALENDARS <= FEED_SPOOL_SLOTS, "Every calendar needs a spool slot");
+
+_Static_assert(EVENT_STORE_DAYS > CALENDAR_WINDOW_DAYS, "Day buckets must cover the window");
+
+// What one calendar contributes to a sync, kept until the calendars are merged
+typedef struct {
+    int index;
+    const char *url;
+    uint32_t url_hash;
+
+    // The MAX_EVENTS earliest events found so far and their text; listed by start once drained
+    ics_feed_t feed;
+    int16_t order[MAX_EVENTS];
+    int count;
+    char *text_buf;
+    text_intern_t text_intern_table[CONFIG_GLANCE_EVENT_TEXT_INTERN_SLOTS];
+
+    // Validators sent with the request, and those the response carried
+    feed_validators_t request_validators;
+    feed_validators_t response_validators;
+    bool conditional;
+    bool not_modified;
+    esp_err_t err;
+} calendar_source_t;
+
+// Download and parse state of one fetch task, which may read several calendars in turn
+typedef struct {
+    calendar_source_t *src;
+
+    // The calendar's events, read from the body once decoded
+    ics_feed_parser_t feed;
+    ics_occurrence_t occurrence_storage[CONFIG_GLANCE_ICS_OCCURRENCE_INDEX_SIZE];
+
+    // Compressed bodies are decoded on the fly in front of the tokenizer
+    uint8_t *inflate_window;
+    inflate_stream_t inflater;
+    bool body_gzip;
+
+    // Large bodies are spooled to external flash, so that an interrupted download can be resumed
+    bool body_started;              // The status is known and the body's first bytes are due
+    bool body_failed;               // A partial response that does not continue the kept bytes
+    bool body_ignored;              // An error response, whose body is not the document asked for
+    size_t body_bytes;              // Bytes of the body received, as sent
+    bool accept_ranges;
+    int64_t range_start;            // First byte of a partial response, -1 for a whole body
+    int64_t range_total;
+    bool resuming;                  // Asked for the rest of the body kept in the calendar's slot
+    feed_spool_header_t spooled;
+    bool spooling;
+    feed_spool_writer_t spool;
+    char spool_chunk[SPOOL_READ_CHUNK];
+
+    // CalDAV multistatus responses: an href per resource, then its status or calendar-data
+    xml_extract_t xml_extractor;
+    bool body_xml;
+
+#ifdef CALDAV_URL
+    // Resources listed by the CalDAV response being read
+    struct {
+        char text[FEED_SYNC_TOKEN_MAX]; // href, status or sync-token read so far
+        size_t text_len;
+        bool text_overflow;
+        bool has_data;                  // The current resource came with its calendar-data
+        bool truncated;                 // 507: the server did not list every change
+        uint32_t replaced[CALDAV_MAX_CHANGES]; // Resources whose saved events are replaced or deleted
+        int replaced_count;
+        bool replaced_overflow;
+        uint16_t resources;
+        uint16_t with_data;
+        uint16_t deleted;
+    } caldav;
+#endif
+} calendar_parser_t;
+
+// Result of the last sync
+static event_store_t event_store;
+
+// Events saved by the previous sync, and what the last sync changed compared with them
+static event_store_t saved_store;
+static ics_tz_zone_t saved_zone;
+static bool saved_loaded;
+static event_store_diff_t event_changes;
+static bool events_changed = true;
+
+// Allocated on first use and kept for the life of the app
+static calendar_source_t *sources[MAX_CALENDARS];
+static calendar_parser_t *parsers[CONFIG_GLANCE_CALENDAR_FETCH_TASKS];
+
+// Text of the events in the store; the calendars' strings are copied here when merged
+static char *text_buf = NULL;
+static text_intern_t text_intern_table[CONFIG_GLANCE_EVENT_TEXT_INTERN_SLOTS];
+static text_arena_t text_arena;
+
+// Events are kept if they start in [sync_now, window_end)
+static time_t sync_now;
+static time_t window_end;
+static ics_feed_window_t feed_window;
+
+// Zones are compiled once per sync, so event times convert without touching TZ
+static ics_tz_zone_t local_zone;
+static int tz_first_year, tz_last_year;
+
+static int64_t local_seconds(time_t utc)
+{
+    return (int64_t)utc + ics_tz_offset_at(&local_zone, utc);
+}
+
+// Decoded body bytes, ICS text or a CalDAV multistatus document
+static bool on_body(const char *data, size_t len, void *ctx)
+{
+    calendar_parser_t *p = ctx;
+    return p->body_xml ? xml_extract_feed(&p->xml_extractor, data, len) : ics_feed_parser_feed(&p->feed, data, len);
+}
+
+// Body bytes as sent, decoded first if compressed
+static void decode_body(calendar_parser_t *p, const char *data, size_t len)
+{
+    if (!p->body_gzip) {
+        on_body(data, len, p);
+    } else if (!inflate_stream_feed(&p->inflater, data, len) && p->inflater.error != NULL) {
+        ESP_LOGE(TAG, "Failed to decode gzip body: %s", p->inflater.error);
+        p->inflater.error = NULL; // Logged once; the state stays failed
+    }
+}
+
+// If-Range needs a strong validator: an ETag that is not weak, or else the Last-Modified date
+static const char *if_range_validator(const feed_validators_t *validators)
+{
+    if (validators->etag[0] != '\0' && strncmp(validators->etag, "W/", 2) != 0) {
+        return validators->etag;
+    }
+    return validators->last_modified[0] != '\0' ? validators->last_modified : NULL;
+}
+
+// Replays the kept bytes of a resumed body into the parser, as if they had just arrived
+static void replay_spooled(calendar_parser_t *p)
+{
+    for (uint32_t offset = 0; offset < p->spooled.length && !p->body_failed; offset += SPOOL_READ_CHUNK) {
+        size_t len = p->spooled.length - offset < SPOOL_READ_CHUNK ? p->spooled.length - offset : SPOOL_READ_CHUNK;
+        if (feed_spool_read(p->src->index, offset, p->spool_chunk, len) != ESP_OK) {
+            ESP_LOGE(TAG, "Calendar %d: failed to read the kept bytes", p->src->index);
+            p->body_failed = true;
+        } else {
+            decode_body(p, p->spool_chunk, len);
+        }
+    }
+}
+
+// Once the status is known: sets an error page aside, continues a resumed body after its kept bytes,
+// or starts spooling a new one
+static void start_body(calendar_parser_t *p, esp_http_client_handle_t client)
+{
+    calendar_source_t *src = p->src;
+    int status = esp_http_client_get_status_code(client);
+    p->body_started = true;
+    if (p->body_xml ? status != 207 : status != 200 && !(status == 206 && p->resuming)) {
+        p->body_ignored = true;
+        return;
+    }
+    if (status == 206 && p->resuming) {
+        if (p->range_start != p->spooled.length || p->range_total != p->spooled.total ||
+            p->body_gzip != (p->spooled.gzip != 0)) {
+            ESP_LOGW(TAG, "Calendar %d: partial response does not continue the kept bytes", src->index);
+            p->body_failed = true;
+            return;
+        }
+        replay_spooled(p);
+        if (!p->body_failed) {
+            feed_spool_open(&p->spool, src->index, p->spooled.length);
+            p->spooling = true;
+        }
+        return;
+    }
+    if (status == 200 && p->resuming) {
+        // If-Range did not match, so the feed has changed and this is all of it
+        ESP_LOGI(TAG, "Calendar %d: feed changed since the download broke off, starting over", src->index);
+        p->resuming = false;
+        feed_spool_discard(src->index);
+    }
+#ifdef CONFIG_GLANCE_ICS_RESUME
+    int64_t length = esp_http_client_get_content_length(client);
+    if (status == 200 && p->accept_ranges && length >= CONFIG_GLANCE_ICS_RESUME_MIN_SIZE &&
+        length <= FEED_SPOOL_CAPACITY && if_range_validator(&src->response_validators) != NULL) {
+        feed_spool_open(&p->spool, src->index, 0);
+        p->spooling = true;
+    }
+#endif
+}
+
+static esp_err_t _http_event_handler(esp_http_client_event_t *evt)
+{
+    calendar_parser_t *p = evt->user_data;
+    switch(evt->event_id) {
+        case HTTP_EVENT_ON_HEADER:
+            feed_validators_capture(&p->src->response_validators, evt->header_key, evt->header_value);
+            if (p->inflate_window != NULL && strcasecmp(evt->header_key, "Content-Encoding") == 0 &&
+                strcasecmp(evt->header_value, "gzip") == 0) {
+                p->body_gzip = true;
+                inflate_stream_init(&p->inflater, INFLATE_STREAM_GZIP, p->inflate_window, on_body, p);
+            } else if (strcasecmp(evt->header_key, "Accept-Ranges") == 0) {
+                p->accept_ranges = strcasecmp(evt->header_value, "bytes") == 0;
+            } else if (strcasecmp(evt->header_key, "Content-Range") == 0) {
+                long long first, last, total;
+                if (sscanf(evt->header_value, "bytes %lld-%lld/%lld", &first, &last, &total) == 3) {
+                    p->range_start = first;
+                    p->range_total = total;
+                }
+            }
+            break;
+        case HTTP_EVENT_ON_DATA:
+            if (!p->body_started) {
+                start_body(p, evt->client);
+            }
+            if (p->body_failed) {
+                break;
+            }
+            p->body_bytes += evt->data_len;
+            if (p->body_ignored) {
+                break;
+            }
+            if (p->spooling && !feed_spool_write(&p->spool, evt->data, evt->data_len)) {
+                p->spooling = false;
+            }
+            decode_body(p, evt->data, evt->data_len);
+            break;
+        case HTTP_EVENT_ON_FINISH:
+            ics_feed_parser_finish(&p->feed);
+            break;
+        default:
+            break;
+    }
+    return ESP_OK;
+}
+
+// Prefers PSRAM; everything allocated here is kept for the life of the app
+static void *alloc_prefer_psram(size_t size)
+{
+    void *ptr = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    return ptr != NULL ? ptr : heap_caps_malloc(size, MALLOC_CAP_8BIT);
+}
+
+static bool text_arena_ready(void)
+{
+    if (text_buf != NULL) {
+        return true;
+    }
+    text_buf = alloc_prefer_psram(CONFIG_GLANCE_EVENT_TEXT_ARENA_SIZE);
+    if (text_buf == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate %d bytes for event text", CONFIG_GLANCE_EVENT_TEXT_ARENA_SIZE);
+        return false;
+    }
+    text_arena_init(&text_arena, text_buf, CONFIG_GLANCE_EVENT_TEXT_ARENA_SIZE,
+                    text_intern_table, CONFIG_GLANCE_EVENT_TEXT_INTERN_SLOTS);
+    return true;
+}
+
+static calendar_source_t *source_ready(int index)
+{
+    if (sources[index] != NULL) {
+        return sources[index];
+    }
+    calendar_source_t *src = alloc_prefer_psram(sizeof(*src));
+    char *buf = alloc_prefer_psram(CONFIG_GLANCE_EVENT_TEXT_ARENA_SIZE);
+    if (src == NULL || buf == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate %u bytes for calendar %d",
+                 (unsigned)(sizeof(*src) + CONFIG_GLANCE_EVENT_TEXT_ARENA_SIZE), index);
+        heap_caps_free(src);
+        heap_caps_free(buf);
+        return NULL;
+    }
+    memset(src, 0, sizeof(*src));
+    src->index = index;
+    src->url = calendar_urls[index];
+    src->url_hash = ics_span_hash(src->url, strlen(src->url));
+    src->text_buf = buf;
+    ics_feed_init(&src->feed, buf, CONFIG_GLANCE_EVENT_TEXT_ARENA_SIZE,
+                  src->text_intern_table, CONFIG_GLANCE_EVENT_TEXT_INTERN_SLOTS);
+    sources[index] = src;
+    return src;
+}
+
+static calendar_parser_t *parser_ready(int task)
+{
+    if (parsers[task] == NULL) {
+        parsers[task] = alloc_prefer_psram(sizeof(calendar_parser_t));
+        if (parsers[task] == NULL) {
+            ESP_LOGW(TAG, "Failed to allocate %u bytes for fetch task %d", (unsigned)sizeof(calendar_parser_t), task);
+            return NULL;
+        }
+        memset(parsers[task], 0, sizeof(calendar_parser_t));
+    }
+    return parsers[task];
+}
+
+// Compression is only requested if the decoder window could be allocated
+static bool inflate_ready(calendar_parser_t *p)
+{
+#ifdef CONFIG_GLANCE_ICS_GZIP
+    if (p->inflate_window == NULL) {
+        p->inflate_window = alloc_prefer_psram(INFLATE_STREAM_WINDOW_SIZE);
+        if (p->inflate_window == NULL) {
+            ESP_LOGW(TAG, "No memory for the gzip window, fetching uncompressed");
+        }
+    }
+    return p->inflate_window != NULL;
+#else
+    return false;
+#endif
+}
+
+// Sets the window and compiles the device zone for a sync; false if the text arena cannot be allocated
+static bool sync_begin(void)
+{
+    if (!text_arena_ready()) {
+        return false;
+    }
+    time(&sync_now);
+
+    // Transitions are compiled for a window around the current year
+    civil_time_t now_utc;
+    civil_from_seconds(sync_now, &now_utc);
+    tz_first_year = now_utc.year - 1;
+    tz_last_year = now_utc.year + 2;
+
+    const char *posix_tz = getenv("TZ");
+    if (posix_tz == NULL || !ics_tz_compile_posix(&local_zone, posix_tz, tz_first_year, tz_last_year)) {
+        ics_tz_compile_posix(&local_zone, DEFAULT_POSIX_TZ, tz_first_year, tz_last_year);
+    }
+
+    // The window ends at a local midnight, so every sync of the same day keeps the same events
+    // and saved ones can stand in for an unchanged feed
+    int64_t today = civil_days_from_seconds(local_seconds(sync_now));
+    window_end = calendar_day_start(today + CALENDAR_WINDOW_DAYS + 1);
+    feed_window = (ics_feed_window_t){
+        .now = sync_now,
+        .end = window_end,
+        .local = &local_zone,
+        .first_year = tz_first_year,
+        .last_year = tz_last_year,
+    };
+    return true;
+}
+
+// Forgets what the headers of the last response said
+static void response_begin(calendar_parser_t *p)
+{
+    p->body_gzip = false;
+    p->body_started = false;
+    p->body_failed = false;
+    p->body_ignored = false;
+    p->body_bytes = 0;
+    p->accept_ranges = false;
+    p->range_start = -1;
+    p->range_total = -1;
+    p->spooling = false;
+}
+
+// Resets the parser and the calendar's events for a new download
+static void parse_begin(calendar_parser_t *p, calendar_source_t *src)
+{
+    p->src = src;
+    response_begin(p);
+    p->resuming = false;
+    p->body_xml = false;
+    memset(&src->response_validators, 0, sizeof(src->response_validators));
+    src->count = 0;
+    ics_feed_parser_begin(&p->feed, &src->feed, &feed_window, p->occurrence_storage,
+                          CONFIG_GLANCE_ICS_OCCURRENCE_INDEX_SIZE);
+    p->feed.href = src->url_hash;
+}
+
+// Checks that the body was received in full, and decoded in full if compressed
+static esp_err_t body_complete(calendar_parser_t *p, esp_http_client_handle_t client)
+{
+    int64_t length = esp_http_client_get_content_length(client);
+    if (p->body_failed || (length >= 0 && (int64_t)p->body_bytes != length)) {
+        ESP_LOGE(TAG, "Body cut off after %u of %lld bytes", (unsigned)p->body_bytes, (long long)length);
+        return ESP_FAIL;
+    }
+    if (p->body_gzip && !p->body_ignored && !inflate_stream_done(&p->inflater)) {
+        ESP_LOGE(TAG, "Compressed body incomplete or corrupt");
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+static void log_parse_stats(const calendar_parser_t *p)
+{
+    const calendar_source_t *src = p->src;
+    const ics_tokenizer_t *tok = &p->feed.tokenizer;
+    const text_arena_t *text = &src->feed.text;
+    const ics_feed_stats_t *stats = &p->feed.stats;
+    if (p->body_gzip) {
+        ESP_LOGI(TAG, "Calendar %d: received %u gzip bytes, %u decoded (%.1fx)", src->index,
+                 (unsigned)p->inflater.bytes_in, (unsigned)p->inflater.bytes_out,
+                 p->inflater.bytes_in ? (double)p->inflater.bytes_out / p->inflater.bytes_in : 0.0);
+    }
+    ESP_LOGI(TAG, "Calendar %d: tokenized %u bytes, %u lines (%u spilled, %u truncated), spill high-water %u bytes",
+             src->index, (unsigned)tok->bytes_in, (unsigned)tok->lines, (unsigned)tok->lines_spilled,
+             (unsigned)tok->lines_truncated, (unsigned)tok->spill_high_water);
+    ESP_LOGI(TAG, "Calendar %d: skipped %u lines, %u bytes", src->index,
+             (unsigned)tok->lines_skipped, (unsigned)tok->bytes_skipped);
+    ESP_LOGI(TAG, "Calendar %d: %u events, %u occurrences in the window", src->index,
+             (unsigned)stats->vevents, (unsigned)stats->occurrences);
+    ESP_LOGI(TAG, "Calendar %d: kept %d earliest events, %u evicted, %u later ones dropped", src->index,
+             src->feed.heap.count, (unsigned)src->feed.heap.evicted, (unsigned)src->feed.heap.rejected);
+    ESP_LOGI(TAG, "Calendar %d: event text: %u strings, %u interned, %u dropped, %u compactions, "
+             "%u/%u bytes (high-water %u)", src->index, (unsigned)text->strings, (unsigned)text->interned,
+             (unsigned)text->overflows, (unsigned)text->compactions, (unsigned)text->top, (unsigned)text->cap,
+             (unsigned)text->high_water);
+    ESP_LOGI(TAG, "Calendar %d: occurrence index: %u/%u entries used, %u dropped", src->index,
+             (unsigned)p->feed.occurrence_index.count, (unsigned)(p->feed.occurrence_index.mask + 1),
+             (unsigned)p->feed.occurrence_index.dropped);
+
+    // Problems with the feed itself
+    if (stats->invalid_values > 0) {
+        ESP_LOGW(TAG, "Calendar %d: %u values failed to parse, first [%s]", src->index,
+                 (unsigned)stats->invalid_values, stats->first_invalid);
+    }
+    if (stats->unknown_tzids > 0) {
+        ESP_LOGW(TAG, "Calendar %d: %u times in unknown zones read as local time, first [%s]", src->index,
+                 (unsigned)stats->unknown_tzids, stats->first_unknown_tzid);
+    }
+    if (stats->unsupported_rrules > 0) {
+        ESP_LOGW(TAG, "Calendar %d: %u unsupported RRULEs, only their first occurrence is shown", src->index,
+                 (unsigned)stats->unsupported_rrules);
+    }
+    if (stats->ends_before_start > 0) {
+        ESP_LOGW(TAG, "Calendar %d: %u events end before they start, their end is ignored", src->index,
+                 (unsigned)stats->ends_before_start);
+    }
+    if (stats->exdates_dropped > 0) {
+        ESP_LOGW(TAG, "Calendar %d: %u EXDATEs before UID ignored (max %d per event)", src->index,
+                 (unsigned)stats->exdates_dropped, ICS_FEED_PENDING_EXDATES);
+    }
+    if (stats->zones_dropped > 0 || stats->zones_truncated > 0) {
+        ESP_LOGW(TAG, "Calendar %d: %u VTIMEZONEs ignored (max %d), %u with later transitions dropped", src->index,
+                 (unsigned)stats->zones_dropped, ICS_TZ_MAX_ZONES, (unsigned)stats->zones_truncated);
+    }
+    if (stats->known_zones_evicted > 0) {
+        ESP_LOGW(TAG, "Calendar %d: more than %d zones named without a VTIMEZONE, %u compiled again", src->index,
+                 ICS_FEED_KNOWN_ZONES, (unsigned)stats->known_zones_evicted);
+    }
+}
+
+#ifndef CALDAV_URL
+// Keeps the spooled bytes of a body that broke off for the next sync, or drops them once it is complete
+static void finish_spool(calendar_parser_t *p, esp_http_client_handle_t client, bool complete)
+{
+    calendar_source_t *src = p->src;
+    if (complete || p->body_failed) {
+        if (p->resuming || p->body_failed) {
+            feed_spool_discard(src->index);
+        }
+        return;
+    }
+    if (!p->spooling || p->spool.length == (p->resuming ? p->spooled.length : 0)) {
+        return; // Nothing new was received; kept bytes stay as they are
+    }
+    feed_spool_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.url_hash = src->url_hash;
+    header.total = p->resuming ? p->spooled.total : (uint32_t)esp_http_client_get_content_length(client);
+    header.gzip = p->body_gzip;
+    snprintf(header.validator, sizeof(header.validator), "%s",
+             p->resuming ? p->spooled.validator : if_range_validator(&src->response_validators));
+    if (feed_spool_keep(&p->spool, &header) == ESP_OK) {
+        ESP_LOGW(TAG, "Calendar %d: download broke off, the next sync asks for the remaining %u bytes",
+                 src->index, (unsigned)(header.total - header.length));
+    }
+}
+
+// Sets src->not_modified on a 304, which only a conditional request can get
+static esp_err_t http_get_ics(calendar_parser_t *p, calendar_source_t *src)
+{
+    src->not_modified = false;
+    parse_begin(p, src);
+
+#ifdef CONFIG_GLANCE_ICS_RESUME
+    // The kept bytes are only of use if the rest comes in the same encoding
+    p->resuming = feed_spool_find(src->index, src->url_hash, &p->spooled) && (!p->spooled.gzip || inflate_ready(p));
+#endif
+    bool conditional = src->conditional && !p->resuming;
+
+    esp_http_client_config_t config = {
+        .url = src->url,
+        .event_handler = _http_event_handler,
+        .user_data = p,
+        .crt_bundle_attach = esp_crt_bundle_attach,
+    };
+    esp_http_client_handle_t client = esp_http_client_init(&config);
+    if (client == NULL) {
+        ESP_LOGE(TAG, "Failed to initialize HTTP client");
+        return ESP_FAIL;
+    }
+    if (p->resuming ? p->spooled.gzip : inflate_ready(p)) {
+        esp_http_client_set_header(client, "Accept-Encoding", "gzip");
+    }
+    if (p->resuming) {
+        char range[24];
+        snprintf(range, sizeof(range), "bytes=%" PRIu32 "-", p->spooled.length);
+        esp_http_client_set_header(client, "Range", range);
+        esp_http_client_set_header(client, "If-Range", p->spooled.validator);
+        ESP_LOGI(TAG, "Calendar %d: resuming the download at byte %" PRIu32 " of %" PRIu32,
+                 src->index, p->spooled.length, p->spooled.total);
+    }
+    if (conditional) {
+        if (src->request_validators.etag[0] != '\0') {
+            esp_http_client_set_header(client, "If-None-Match", src->request_validators.etag);
+        }
+        if (src->request_validators.last_modified[0] != '\0') {
+            esp_http_client_set_header(client, "If-Modified-Since", src->request_validators.last_modified);
+        }
+    }
+
+    esp_err_t err = esp_http_client_perform(client);
+    if (err == ESP_OK) {
+        int status = esp_http_client_get_status_code(client);
+        ESP_LOGI(TAG, "Calendar %d: HTTP GET Status = %d, content_length = %"PRId64,
+                 src->index, status, esp_http_client_get_content_length(client));
+        if (status == 304 && conditional) {
+            src->not_modified = true;
+        } else if (status != 200 && !(status == 206 && p->resuming)) {
+            err = ESP_FAIL;
+            if (p->resuming) {
+                // Asking for the same range again would fail the same way, e.g. with a 416
+                ESP_LOGW(TAG, "Calendar %d: resumed download refused, the next sync starts over", src->index);
+                p->body_failed = true;
+            }
+        } else {
+            err = body_complete(p, client);
+        }
+    } else {
+        ESP_LOGE(TAG, "Calendar %d: HTTP GET request failed: %s", src->index, esp_err_to_name(err));
+    }
+    finish_spool(p, client, err == ESP_OK);
+
+    if (!src->not_modified) {
+        log_parse_stats(p);
+    }
+    esp_http_client_cleanup(client);
+    return err;
+}
+
+// Calendars being fetched, shared out between the fetch tasks
+static int fetch_list[MAX_CALENDARS];
+static int fetch_list_count;
+static int fetch_tasks;
+static EventGroupHandle_t fetch_done;
+
+// Fetches this task's share of the listed calendars, one after another
+static void fetch_share(int task)
+{
+    for (int i = task; i < fetch_list_count; i += fetch_tasks) {
+        calendar_source_t *src = sources[fetch_list[i]];
+        src->err = http_get_ics(parsers[task], src);
+    }
+}
+
+static void fetch_task(void *arg)
+{
+    int task = (int)(intptr_t)arg;
+    fetch_share(task);
+    xEventGroupSetBits(fetch_done, 1 << task);
+    vTaskDelete(NULL);
+}
+
+/*
+ * Fetches and parses the listed calendars, up to
+ * CONFIG_GLANCE_CALENDAR_FETCH_TASKS at a time. Each task has its own parser
+ * and reads into the calendar's own heap and text arena, so nothing is shared
+ * while they run; the calling task takes the first share.
+ */
+static esp_err_t fetch_calendars(const int *list, int count)
+{
+    memcpy(fetch_list, list, count * sizeof(list[0]));
+    fetch_list_count = count;
+    fetch_tasks = count < CONFIG_GLANCE_CALENDAR_FETCH_TASKS ? count : CONFIG_GLANCE_CALENDAR_FETCH_TASKS;
+    for (int task = 0; task < fetch_tasks; task++) {
+        if (parser_ready(task) == NULL) {
+            if (task == 0) {
+                return ESP_ERR_NO_MEM;
+            }
+            fetch_tasks = task;
+        }
+    }
+    if (fetch_done == NULL && fetch_tasks > 1 && (fetch_done = xEventGroupCreate()) == NULL) {
+        fetch_tasks = 1;
+    }
+
+    int64_t started = esp_timer_get_time();
+    EventBits_t running = 0;
+    for (int task = 1; task < fetch_tasks; task++) {
+        if (xTaskCreate(&fetch_task, "calendar_fetch", FETCH_TASK_STACK_SIZE, (void *)(intptr_t)task, 5, NULL) == pdPASS) {
+            running |= 1 << task;
+        } else {
+            ESP_LOGW(TAG, "Failed to start fetch task %d", task);
+        }
+    }
+    fetch_share(0);
+    // Shares whose task did not start are fetched here
+    for (int task = 1; task < fetch_tasks; task++) {
+        if (!(running & (1 << task))) {
+            fetch_share(task);
+        }
+    }
+    if (running != 0) {
+        xEventGroupWaitBits(fetch_done, running, pdTRUE, pdTRUE, portMAX_DELAY);
+    }
+    ESP_LOGI(TAG, "Fetched %d calendars with %d tasks in %lld ms", count, fetch_tasks,
+             (long long)((esp_timer_get_time() - started) / 1000));
+
+    esp_err_t err = ESP_OK;
+    for (int i = 0; i < count; i++) {
+        calendar_source_t *src = sources[list[i]];
+        if (src->err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to fetch calendar %d (%s)", src->index, src->url);
+            err = src->err;
+        }
+    }
+    return err;
+}
+
+#else
+// calendar-query for the events overlapping a time range, with their full ICS text
+#define CALDAV_QUERY_FORMAT \
+    "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n" \
+    "<C:calendar-query xmlns:D=\"DAV:\" xmlns:C=\"urn:ietf:params:xml:ns:caldav\">\n" \
+    "<D:prop><C:calendar-data/></D:prop>\n" \
+    "<C:filter><C:comp-filter name=\"VCALENDAR\"><C:comp-filter name=\"VEVENT\">\n" \
+    "<C:time-range start=\"%s\" end=\"%s\"/>\n" \
+    "</C:comp-filter></C:comp-filter></C:filter>\n" \
+    "</C:calendar-query>\n"
+
+// sync-collection for the resources changed or deleted since a sync-token (RFC 6578)
+#define CALDAV_SYNC_FORMAT \
+    "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n" \
+    "<D:sync-collection xmlns:D=\"DAV:\" xmlns:C=\"urn:ietf:params:xml:ns:caldav\">\n" \
+    "<D:sync-token>%s</D:sync-token>\n" \
+    "<D:sync-level>1</D:sync-level>\n" \
+    "<D:prop><C:calendar-data/></D:prop>\n" \
+    "</D:sync-collection>\n"
+
+// The collection's current sync-token
+#define CALDAV_SYNC_TOKEN_QUERY \
+    "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n" \
+    "<D:propfind xmlns:D=\"DAV:\"><D:prop><D:sync-token/></D:prop></D:propfind>\n"
+
+enum { CALDAV_HREF, CALDAV_STATUS, CALDAV_CALENDAR_DATA, CALDAV_SYNC_TOKEN };
+
+static char caldav_body[1280];
+
+static const char *const caldav_elements[] = {"href", "status", "calendar-data", "sync-token", NULL};
+
+// Marks a resource whose saved events an incremental sync drops
+static void caldav_replace(calendar_parser_t *p, uint32_t href)
+{
+    for (int i = 0; i < p->caldav.replaced_count; i++) {
+        if (p->caldav.replaced[i] == href) {
+            return;
+        }
+    }
+    if (p->caldav.replaced_count < CALDAV_MAX_CHANGES) {
+        p->caldav.replaced[p->caldav.replaced_count++] = href;
+    } else {
+        p->caldav.replaced_overflow = true;
+    }
+}
+
+static bool caldav_replaced(const calendar_parser_t *p, uint32_t href)
+{
+    for (int i = 0; i < p->caldav.replaced_count; i++) {
+        if (p->caldav.replaced[i] == href) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool on_caldav_text(int element, const char *data, size_t len, void *ctx)
+{
+    calendar_parser_t *p = ctx;
+    if (element == CALDAV_CALENDAR_DATA) {
+        if (data == NULL) {
+            // Each resource is a complete VCALENDAR; make sure its last line is terminated
+            return ics_feed_parser_feed(&p->feed, "\r\n", 2);
+        }
+        if (!p->caldav.has_data) {
+            p->caldav.has_data = true;
+            p->caldav.with_data++;
+            caldav_replace(p, p->feed.href);
+        }
+        return ics_feed_parser_feed(&p->feed, data, len);
+    }
+
+    // The other elements are short and collected whole
+    if (data != NULL) {
+        if (len >= sizeof(p->caldav.text) - p->caldav.text_len) {
+            len = sizeof(p->caldav.text) - 1 - p->caldav.text_len;
+            p->caldav.text_overflow = true;
+        }
+        memcpy(p->caldav.text + p->caldav.text_len, data, len);
+        p->caldav.text_len += len;
+        return true;
+    }
+    const char *text = p->caldav.text;
+    size_t text_len = p->caldav.text_len;
+    while (text_len > 0 && isspace((unsigned char)*text)) {
+        text++;
+        text_len--;
+    }
+    while (text_len > 0 && isspace((unsigned char)text[text_len - 1])) {
+        text_len--;
+    }
+    p->caldav.text[text + text_len - p->caldav.text] = '\0';
+
+    if (element == CALDAV_HREF) {
+        p->feed.href = ics_span_hash(text, text_len);
+        p->caldav.has_data = false;
+        p->caldav.resources++;
+    } else if (element == CALDAV_STATUS) {
+        // A resource listed with 404 and without calendar-data was deleted
+        if (strstr(text, " 404") != NULL && !p->caldav.has_data) {
+            p->caldav.deleted++;
+            caldav_replace(p, p->feed.href);
+        } else if (strstr(text, " 507") != NULL) {
+            p->caldav.truncated = true;
+        }
+    } else if (element == CALDAV_SYNC_TOKEN && !p->caldav.text_overflow) {
+        memcpy(p->src->response_validators.sync_token, text, text_len + 1);
+    }
+    p->caldav.text_len = 0;
+    p->caldav.text_overflow = false;
+    return true;
+}
+
+// CalDAV time-range bound, e.g. 20250101T000000Z
+static void format_caldav_time(time_t utc, char *buf, size_t len)
+{
+    civil_time_t t;
+    civil_from_seconds(utc, &t);
+    snprintf(buf, len, "%04d%02d%02dT%02d%02d%02dZ", (int)t.year, t.month, t.day, t.hour, t.minute, t.second);
+}
+
+// Escapes text for an XML element; false if it does not fit
+static bool xml_escape(const char *text, char *buf, size_t len)
+{
+    size_t n = 0;
+    for (; *text != '\0'; text++) {
+        const char *piece = *text == '&' ? "&amp;" : *text == '<' ? "&lt;" : *text == '>' ? "&gt;" : NULL;
+        size_t piece_len = piece != NULL ? strlen(piece) : 1;
+        if (n + piece_len >= len) {
+            return false;
+        }
+        memcpy(buf + n, piece != NULL ? piece : text, piece_len);
+        n += piece_len;
+    }
+    buf[n] = '\0';
+    return true;
+}
+
+// Sends a CalDAV request and reads the multistatus response through on_caldav_text.
+// Returns the HTTP status, or -1 if no complete response arrived.
+static int caldav_request(calendar_parser_t *p, esp_http_client_method_t method, const char *depth,
+                          const char *body, int body_len)
+{
+    const char *name = method == HTTP_METHOD_PROPFIND ? "PROPFIND" : "REPORT";
+    memset(&p->caldav, 0, sizeof(p->caldav));
+    p->feed.href = 0;
+    response_begin(p);
+    p->body_xml = true;
+    xml_extract_init(&p->xml_extractor, caldav_elements, on_caldav_text, p);
+
+    esp_http_client_config_t config = {
+        .url = p->src->url,
+        .method = method,
+        .event_handler = _http_event_handler,
+        .user_data = p,
+        .crt_bundle_attach = esp_crt_bundle_attach,
+#ifdef CALDAV_USERNAME
+        .username = CALDAV_USERNAME,
+        .password = CALDAV_PASSWORD,
+        .auth_type = HTTP_AUTH_TYPE_BASIC,
+#endif
+    };
+    esp_http_client_handle_t client = esp_http_client_init(&config);
+    if (client == NULL) {
+        ESP_LOGE(TAG, "Failed to initialize HTTP client");
+        return -1;
+    }
+    esp_http_client_set_header(client, "Depth", depth);
+    esp_http_client_set_header(client, "Content-Type", "application/xml; charset=utf-8");
+    if (inflate_ready(p)) {
+        esp_http_client_set_header(client, "Accept-Encoding", "gzip");
+    }
+    esp_http_client_set_post_field(client, body, body_len);
+
+    int status = -1;
+    esp_err_t err = esp_http_client_perform(client);
+    if (err == ESP_OK) {
+        status = esp_http_client_get_status_code(client);
+        ESP_LOGI(TAG, "HTTP %s Status = %d, content_length = %"PRId64,
+                name, status, esp_http_client_get_content_length(client));
+        if (body_complete(p, client) != ESP_OK) {
+            status = -1;
+        }
+    } else {
+        ESP_LOGE(TAG, "HTTP %s request failed: %s", name, esp_err_to_name(err));
+    }
+    ESP_LOGI(TAG, "CalDAV response: %u bytes, %u resources (%u with calendar-data, %u deleted)",
+             (unsigned)p->xml_extractor.bytes_in, p->caldav.resources, p->caldav.with_data, p->caldav.deleted);
+    esp_http_client_cleanup(client);
+    return status;
+}
+
+static esp_err_t http_report_caldav(calendar_parser_t *p, calendar_source_t *src)
+{
+    parse_begin(p, src);
+
+    // Read first, so that changes made during the query are listed again by the next incremental sync
+    if (caldav_request(p, HTTP_METHOD_PROPFIND, "0", CALDAV_SYNC_TOKEN_QUERY,
+                       strlen(CALDAV_SYNC_TOKEN_QUERY)) != 207 || src->response_validators.sync_token[0] == '\0') {
+        ESP_LOGW(TAG, "No sync-token for the calendar, the next sync queries it in full again");
+        src->response_validators.sync_token[0] = '\0';
+    }
+
+    // The server only sends events overlapping the window; the margins cover all-day events in any zone
+    char from[20], to[20];
+    format_caldav_time(sync_now - CIVIL_SECS_PER_DAY, from, sizeof(from));
+    format_caldav_time(window_end + CIVIL_SECS_PER_DAY, to, sizeof(to));
+    int body_len = snprintf(caldav_body, sizeof(caldav_body), CALDAV_QUERY_FORMAT, from, to);
+
+    esp_err_t err = caldav_request(p, HTTP_METHOD_REPORT, "1", caldav_body, body_len) == 207 ? ESP_OK : ESP_FAIL;
+    log_parse_stats(p);
+    return err;
+}
+
+/*
+ * Applies the changes since the saved sync-token to the saved events. Only
+ * changed resources are sent, with their calendar-data, and only the hrefs of
+ * deleted ones. The saved events of both are dropped, the changed resources
+ * are parsed as usual, and the remaining saved events compete with them for
+ * the kept slots.
+ *
+ * Returns ESP_ERR_INVALID_STATE when the changes cannot be applied and the
+ * calendar has to be queried in full: the token expired, the server did not
+ * list every change, or the saved events were full and lost some.
+ */
+static esp_err_t http_sync_caldav(calendar_parser_t *p, calendar_source_t *src)
+{
+    parse_begin(p, src);
+
+    // Changed text is appended behind the saved pool; the device zone stays as compiled
+    int64_t synced;
+    if (event_cache_load(&event_store, &saved_zone, &src->feed.text, &synced) != ESP_OK) {
+        ESP_LOGW(TAG, "Saved events unreadable");
+        return ESP_ERR_INVALID_STATE;
+    }
+    ics_feed_pin_text(&src->feed);
+    bool was_full = event_store.count == MAX_EVENTS;
+    int started = event_store_drop_started(&event_store, sync_now);
+    if (was_full && started > 0) {
+        // Events past the last saved one were never read, so the slots of started ones cannot be filled
+        ESP_LOGW(TAG, "Saved events were full and %d have since started", started);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    char token[FEED_SYNC_TOKEN_MAX * 5];
+    if (!xml_escape(src->request_validators.sync_token, token, sizeof(token))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    int body_len = snprintf(caldav_body, sizeof(caldav_body), CALDAV_SYNC_FORMAT, token);
+    if (body_len >= (int)sizeof(caldav_body)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    int status = caldav_request(p, HTTP_METHOD_REPORT, "0", caldav_body, body_len);
+    if (status == 403 || status == 409) {
+        // valid-sync-token precondition: the server no longer knows the token
+        ESP_LOGW(TAG, "Sync-token rejected (%d)", status);
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (status != 207) {
+        return ESP_FAIL;
+    }
+    if (p->caldav.truncated || p->caldav.replaced_overflow || src->feed.text.overflows > 0) {
+        ESP_LOGW(TAG, "Too many changes to apply (%u resources)", p->caldav.resources);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Saved events of unchanged resources compete with the changed ones for the kept slots
+    int replaced = 0;
+    for (int i = 0; i < event_store.count; i++) {
+        if (caldav_replaced(p, event_store.href[i])) {
+            replaced++;
+            continue;
+        }
+        ics_feed_event_t event = {
+            .start_time = (time_t)event_store.start[i],
+            .end_time = (time_t)event_store.end[i],
+            .all_day = (event_store.flags[i] & EVENT_STORE_ALL_DAY) != 0,
+            .summary = event_store.summary[i],
+            .location = event_store.location[i],
+            .description = event_store.description[i],
+            .hash = event_store.hash[i],
+            .href = event_store.href[i],
+        };
+        ics_feed_keep(&src->feed, &event, event_store.uid[i]);
+    }
+    // Events past the last saved one were never read, so freed slots cannot be filled
+    if (was_full && replaced > 0) {
+        ESP_LOGW(TAG, "Saved events were full and %d were replaced", replaced);
+        return ESP_ERR_INVALID_STATE;
+    }
+    event_store_clear(&event_store);
+
+    ESP_LOGI(TAG, "Applied %u changed and %u deleted resources: %d saved events replaced, %d since started",
+             p->caldav.with_data, p->caldav.deleted, replaced, started);
+    log_parse_stats(p);
+    return ESP_OK;
+}
+#endif
+
+static void print_upcoming_events(int count)
+{
+    if (event_store.count == 0) {
+        ESP_LOGI(TAG, "No upcoming events found in ICS.");
+        return;
+    }
+
+    ESP_LOGI(TAG, "--- Upcoming Events (Max %d) ---", count);
+    int print_count = (event_store.count < count) ? event_store.count : count;
+
+    for (int i = 0; i < print_count; i++) {
+        time_t start = (time_t)event_store.start[i];
+        char label[16];
+        calendar_day_label(start, label, sizeof(label));
+        if (event_store.flags[i] & EVENT_STORE_ALL_DAY) {
+            ESP_LOGI(TAG, "%d: %s (all day) - %s", i + 1, label, calendar_text(event_store.summary[i]));
+        } else {
+            civil_time_t t;
+            calendar_local_time(start, &t);
+            ESP_LOGI(TAG, "%d: %s %02d:%02d - %s", i + 1, label, t.hour, t.minute,
+                     calendar_text(event_store.summary[i]));
+        }
+    }
+}
+
+// True if a calendar listed before this one has an event with the UID
+static bool uid_listed_before(int index, uint32_t uid)
+{
+    for (int i = 0; i < index; i++) {
+        const calendar_source_t *src = sources[i];
+        for (int k = 0; k < src->count; k++) {
+            if (src->feed.pool_uid[src->order[k]] == uid) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static text_ref_t copy_text(const calendar_source_t *src, text_ref_t ref)
+{
+    return ref.len > 0 ? text_arena_intern(&text_arena, text_arena_get(&src->feed.text, ref), ref.len) : ref;
+}
+
+/*
+ * Merges the calendars' events into the store, earliest first, until it is
+ * full. Each calendar's events are already sorted, so a heap over the next
+ * event of each calendar picks the earliest of all in O(log k). Ties go to
+ * the calendar listed first, and an event is dropped if a calendar listed
+ * before its own has an event with the same UID, e.g. a meeting on both the
+ * work and the family calendar.
+ */
+static void merge_calendars(void)
+{
+    int64_t keys[MAX_CALENDARS];
+    int16_t heap_slots[MAX_CALENDARS];
+    int16_t heap_pos[MAX_CALENDARS];
+    int slot_calendar[MAX_CALENDARS];
+    int next[MAX_CALENDARS] = {0};
+    event_heap_t merge;
+
+    // The heap keeps the largest key on top, so keys are negated to take the earliest start first
+    event_heap_init(&merge, keys, heap_slots, heap_pos, CALENDAR_COUNT);
+    for (int i = 0; i < CALENDAR_COUNT; i++) {
+        calendar_source_t *src = sources[i];
+        src->count = ics_feed_drain(&src->feed, src->order);
+        if (src->count > 0) {
+            int slot = event_heap_offer(&merge, -((int64_t)src->feed.pool[src->order[0]].start_time * MAX_CALENDARS + i));
+            slot_calendar[slot] = i;
+        }
+    }
+
+    event_store_clear(&event_store);
+    text_arena_reset(&text_arena);
+    int duplicates = 0;
+    int slot;
+    while (event_store.count < MAX_EVENTS && (slot = event_heap_top(&merge)) != EVENT_HEAP_NO_SLOT) {
+        int i = slot_calendar[slot];
+        const calendar_source_t *src = sources[i];
+        int16_t order = src->order[next[i]++];
+        event_heap_remove(&merge, slot);
+        if (next[i] < src->count) {
+            int s = event_heap_offer(&merge, -((int64_t)src->feed.pool[src->order[next[i]]].start_time * MAX_CALENDARS + i));
+            slot_calendar[s] = i;
+        }
+
+        const ics_feed_event_t *event = &src->feed.pool[order];
+        uint32_t uid = src->feed.pool_uid[order];
+        if (uid != 0 && uid_listed_before(i, uid)) {
+            duplicates++;
+            continue;
+        }
+        event_store_append(&event_store, event->start_time, event->end_time, event->all_day ? EVENT_STORE_ALL_DAY : 0,
+                           copy_text(src, event->summary), copy_text(src, event->location),
+                           copy_text(src, event->description), uid, event->hash, event->href);
+    }
+    if (CALENDAR_COUNT > 1) {
+        ESP_LOGI(TAG, "Merged %d events from %d calendars, %d duplicates dropped",
+                 event_store.count, CALENDAR_COUNT, duplicates);
+    }
+}
+
+// Buckets the events by local day from the day of now; buckets follow local midnights, which shift with DST
+static void index_event_days(time_t now)
+{
+    int64_t today = civil_days_from_seconds(local_seconds(now));
+    int64_t day_starts[EVENT_STORE_DAYS + 1];
+    for (int i = 0; i <= EVENT_STORE_DAYS; i++) {
+        day_starts[i] = calendar_day_start(today + i);
+    }
+    event_store_index_days(&event_store, today, day_starts);
+}
+
+static void build_event_store(void)
+{
+    merge_calendars();
+    index_event_days(sync_now);
+}
+
+static void load_saved(void)
+{
+    int64_t saved_sync;
+    saved_loaded = event_cache_load(&saved_store, &saved_zone, NULL, &saved_sync) == ESP_OK;
+}
+
+// Saved events can stand in for an unchanged feed only on the local day they were bucketed for
+static bool saved_is_current(void)
+{
+    if (!saved_loaded) {
+        return false;
+    }
+    time_t now;
+    time(&now);
+    return civil_days_from_seconds((int64_t)now + ics_tz_offset_at(&saved_zone, now)) == saved_store.first_day;
+}
+
+#ifndef CALDAV_URL
+// Saved events stand in for the feeds only if they all came from the feeds listed now
+static bool saved_from_calendars(void)
+{
+    for (int i = 0; i < saved_store.count; i++) {
+        int k = 0;
+        while (k < CALENDAR_COUNT && sources[k]->url_hash != saved_store.href[i]) {
+            k++;
+        }
+        if (k == CALENDAR_COUNT) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The feeds have not changed since the saved events were parsed; drop those that have since started
+static bool reuse_saved_events(void)
+{
+    int64_t synced;
+    bool loaded = event_cache_load(&event_store, &local_zone, &text_arena, &synced) == ESP_OK;
+    bool was_full = event_store.count == MAX_EVENTS;
+    int dropped = loaded ? event_store_drop_started(&event_store, sync_now) : 0;
+
+    // Events past the last saved one were never kept, so the slots of started ones cannot be filled
+    if (!loaded || (was_full && dropped > 0)) {
+        if (loaded) {
+            ESP_LOGI(TAG, "Saved events were full and %d have since started", dropped);
+        }
+        event_store_clear(&event_store);
+        text_arena_reset(&text_arena);
+        return false;
+    }
+    ESP_LOGI(TAG, "Feeds not modified, reusing %d saved events (%d since started)", event_store.count, dropped);
+    return true;
+}
+#endif
+
+// Compares the new events with those saved by the previous sync
+static void compare_with_saved(void)
+{
+    events_changed = true;
+    memset(&event_changes, 0, sizeof(event_changes));
+    if (!saved_loaded) {
+        ESP_LOGI(TAG, "No saved events to compare with");
+        return;
+    }
+
+    // Saved events that have since started count as removed, they are no longer shown
+    bool differ = event_store_diff(&saved_store, &event_store, INT64_MIN, window_end, &event_changes);
+    events_changed = differ || saved_store.first_day != event_store.first_day;
+    ESP_LOGI(TAG, "Since the last sync: %u added, %u removed, %u changed%s",
+             event_changes.added, event_changes.removed, event_changes.changed,
+             saved_store.first_day != event_store.first_day ? ", new day" : "");
+}
+
+bool calendar_sync(void)
+{
+    if (!sync_begin()) {
+        return false;
+    }
+    for (int i = 0; i < CALENDAR_COUNT; i++) {
+        if (source_ready(i) == NULL) {
+            return false;
+        }
+    }
+
+    // The saved events are compared with the new ones, or reused if the feeds are unchanged
+    load_saved();
+    for (int i = 0; i < CALENDAR_COUNT; i++) {
+        feed_validators_load(sources[i]->url, &sources[i]->request_validators);
+    }
+#ifdef CALDAV_URL
+    // Changes are applied to the saved events while they are for the current local day; the
+    // text of replaced events is left behind when the events are copied to the store
+    calendar_source_t *src = sources[0];
+    calendar_parser_t *p = parser_ready(0);
+    if (p == NULL) {
+        return false;
+    }
+    bool not_modified = false;
+    bool incremental = saved_is_current() && src->request_validators.sync_token[0] != '\0';
+    esp_err_t err = ESP_FAIL;
+    if (incremental) {
+        ESP_LOGI(TAG, "Syncing CalDAV calendar %s (incremental)", src->url);
+        err = http_sync_caldav(p, src);
+        if (err != ESP_OK) {
+            ESP_LOGW(TAG, "Incremental sync failed, querying the calendar in full");
+            incremental = false;
+        }
+    }
+    if (err != ESP_OK) {
+        ESP_LOGI(TAG, "Querying CalDAV calendar %s", src->url);
+        err = http_report_caldav(p, src);
+    }
+#else
+    // Either every feed is unchanged and the saved events are reused, or all of them are parsed
+    bool conditional = saved_is_current() && saved_from_calendars();
+    int list[MAX_CALENDARS];
+    for (int i = 0; i < CALENDAR_COUNT; i++) {
+        sources[i]->conditional = conditional && !feed_validators_empty(&sources[i]->request_validators);
+        ESP_LOGI(TAG, "Fetching ICS data from %s%s", sources[i]->url, sources[i]->conditional ? " (conditional)" : "");
+        list[i] = i;
+    }
+    bool not_modified = false;
+    esp_err_t err = fetch_calendars(list, CALENDAR_COUNT);
+    if (err == ESP_OK) {
+        int unchanged = 0;
+        for (int i = 0; i < CALENDAR_COUNT; i++) {
+            if (sources[i]->not_modified) {
+                sources[i]->conditional = false;
+                list[unchanged++] = i;
+            }
+        }
+        if (unchanged == CALENDAR_COUNT && reuse_saved_events()) {
+            not_modified = true;
+        } else if (unchanged > 0) {
+            // Saved events of an unchanged feed cannot be merged with new ones: they lack its events that
+            // another feed pushed past the kept ones or claimed as duplicates
+            ESP_LOGI(TAG, "%d of %d feeds not modified, fetching them in full", unchanged, CALENDAR_COUNT);
+            err = fetch_calendars(list, unchanged);
+        }
+    }
+    bool incremental = false;
+#endif
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to fetch or process ICS data.");
+        return false;
+    }
+
+    if (!not_modified) {
+        build_event_store();
+        ESP_LOGI(TAG, "Parsed %d future events.", event_store.count);
+    }
+    print_upcoming_events(10);
+    compare_with_saved();
+
+    // Unchanged events are only saved again if some have since started
+    if ((not_modified || incremental) && !events_changed) {
+        if (incremental) {
+            feed_validators_save(sources[0]->url, &sources[0]->response_validators);
+        }
+        return true;
+    }
+    if (event_cache_save(&event_store, &local_zone, &text_arena, sync_now) != ESP_OK) {
+        ESP_LOGW(TAG, "Failed to save events to external flash");
+    } else if (!not_modified) {
+        // Validators are only sent back while the saved events match them
+        for (int i = 0; i < CALENDAR_COUNT; i++) {
+            feed_validators_save(sources[i]->url, &sources[i]->response_validators);
+        }
+    }
+    return true;
+}
+
+bool calendar_load_cached(void)
+{
+    if (!text_arena_ready()) {
+        return false;
+    }
+    int64_t synced;
+    if (event_cache_load(&event_store, &local_zone, &text_arena, &synced) != ESP_OK) {
+        event_store_clear(&event_store);
+        text_arena_reset(&text_arena);
+        ESP_LOGW(TAG, "No saved events on external flash");
+        return false;
+    }
+    sync_now = (time_t)synced;
+    events_changed = true;
+
+    // The saved events were kept and bucketed as of the sync; show them as of now
+    time_t now;
+    time(&now);
+    int dropped = event_store_drop_started(&event_store, now);
+    index_event_days(now);
+    ESP_LOGI(TAG, "Loaded %d saved events, synced %lld minutes ago (%d since started)", event_store.count,
+             (long long)((now - sync_now) / 60), dropped);
+    print_upcoming_events(10);
+    return true;
+}
+
+bool calendar_events_changed(event_store_diff_t *changes)
+{
+    if (changes != NULL) {
+        *changes = event_changes;
+    }
+    return events_changed;
+}
+
+const event_store_t *calendar_get_events(void)
+{
+    return &event_store;
+}
+
+const char *calendar_text(text_ref_t ref)
+{
+    return text_buf ? text_arena_get(&text_arena, ref) : "";
+}
+
+void calendar_local_time(time_t utc, civil_time_t *out)
+{
+    civil_from_seconds(local_seconds(utc), out);
+}
+
+time_t calendar_day_start(int64_t day)
+{
+    return (time_t)ics_tz_local_to_utc(&local_zone, day * CIVIL_SECS_PER_DAY);
+}
+
+void calendar_day_label(time_t utc, char *buf, size_t len)
+{
+    time_t now;
+    time(&now);
+    int64_t day = civil_days_from_seconds(local_seconds(utc));
+    int64_t today = civil_days_from_seconds(local_seconds(now));
+
+    if (day == today) {
+        snprintf(buf, len, "Today");
+    } else if (day == today + 1) {
+        snprintf(buf, len, "Tomorrow");
+    } else {
+        int32_t y;
+        int8_t m, d;
+        civil_date_from_days(day, &y, &m, &d);
+        snprintf(buf, len, "%s %d/%d", civil_weekday_names[civil_weekday(day)], m, d);
+    }
+}
@@ -0,0 +1,111 @@
+#ifndef CALENDAR_MANAGER_H
+#define CALENDAR_MANAGER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <time.h>
+#include "civil_time.h"
+#include "text_arena.h"
+#include "event_store.h"
+
+#define MAX_EVENTS              EVENT_STORE_CAPACITY // Number of earliest future events kept
+#define CALENDAR_WINDOW_DAYS    14   // Days after today through the end of which events are kept
+
+/**
+ * @brief Downloads the ICS feed at ICS_URL and keeps the MAX_EVENTS earliest
+ * events starting from now until the end of the local day CALENDAR_WINDOW_DAYS
+ * days from today, expanding recurrences.
+ *
+ * To show several calendars, define ICS_URLS in credentials.h as a list of up
+ * to six quoted URLs separated by commas instead. The feeds are fetched and
+ * parsed side by side, CONFIG_GLANCE_CALENDAR_FETCH_TASKS at a time, and
+ * their events merged by start time. An event is dropped if a feed listed
+ * before its own has an event with the same UID.
+ *
+ * This is a blocking function.
+ * It assumes that Wi-Fi is connected and the system time is synchronized.
+ * On success the events are also saved to external flash. Each feed's ETag
+ * and Last-Modified are kept in NVS and sent back on the next sync; if every
+ * feed answers 304 Not Modified, the saved events are reused without
+ * parsing, minus those that have since started. If only some do, or if the
+ * saved events filled MAX_EVENTS and some have started, the unchanged feeds
+ * are fetched again in full. Conditional requests are only made while the saved
+ * events are for the current local day.
+ *
+ * If CALDAV_URL is defined in credentials.h, the calendar collection at that
+ * URL is queried with a CalDAV calendar-query REPORT instead, so the server
+ * only sends the events overlapping the window. Define CALDAV_USERNAME and
+ * CALDAV_PASSWORD as well for basic authentication. The collection's
+ * sync-token is kept in NVS; while the saved events are for the current local
+ * day, a sync-collection REPORT fetches only the resources changed or deleted
+ * since and applies them to the saved events.
+ *
+ * @return true if every feed was fetched and parsed, false otherwise.
+ */
+bool calendar_sync(void);
+
+/**
+ * @brief Loads the events saved to external flash by the last successful sync.
+ *
+ * For wakes that do not sync. Also restores the device zone the events were
+ * bucketed with. The external flash must be reachable, i.e. the SPI bus is
+ * initialized.
+ *
+ * @return true if saved events were loaded.
+ */
+bool calendar_load_cached(void);
+
+/**
+ * @brief Reports whether the last sync changed anything that is shown.
+ *
+ * The events are compared with those saved by the sync before, by start time,
+ * UID and a hash of UID, SEQUENCE, LAST-MODIFIED, DTSTART, DTEND, DURATION,
+ * SUMMARY, LOCATION and DESCRIPTION. If nothing in the window was added,
+ * removed or changed and the local day is the same, layout and the panel
+ * refresh can be skipped. Events loaded with calendar_load_cached() always
+ * count as changed.
+ *
+ * @param[out] changes Counts of added, removed and changed events; may be NULL.
+ * @return true if the display needs to be redrawn.
+ */
+bool calendar_events_changed(event_store_diff_t *changes);
+
+/**
+ * @brief Returns the upcoming events found by the last sync.
+ *
+ * The store is sorted by start time and bucketed by local day; use
+ * event_store_query() and event_store_day() to find events by start,
+ * event_store_overlapping() with calendar_day_start() to find those that
+ * cover a day or a cell of a week or month grid, and calendar_text() for
+ * their text.
+ */
+const event_store_t *calendar_get_events(void);
+
+/**
+ * @brief Returns the text of an event field such as summary.
+ *
+ * Valid until the next sync.
+ */
+const char *calendar_text(text_ref_t ref);
+
+/**
+ * @brief Converts a UTC time to local calendar time.
+ *
+ * Uses the device zone compiled by the last sync instead of localtime_r().
+ */
+void calendar_local_time(time_t utc, civil_time_t *out);
+
+/**
+ * @brief Returns the UTC start of a local day.
+ *
+ * @param day Day number since 1970-01-01, as in event_store_t first_day.
+ */
+time_t calendar_day_start(int64_t day);
+
+/**
+ * @brief Formats the day of an event relative to today, e.g. "Today",
+ * "Tomorrow" or "Mon 10/20".
+ */
+void calendar_day_label(time_t utc, char *buf, size_t len);
+
+#endif // CALENDAR_MANAGER_H
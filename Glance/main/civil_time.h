@@ -0,0 +1,143 @@
+#ifndef CIVIL_TIME_H
+#define CIVIL_TIME_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Integer civil-calendar arithmetic on 64-bit epoch seconds.
+ *
+ * Replaces struct tm, mktime() and localtime_r() in the event pipeline:
+ * no locks, no TZ environment, and valid far outside the 32-bit time_t
+ * range. Dates are proleptic Gregorian; days are counted from 1970-01-01.
+ * The day conversions follow Howard Hinnant's days_from_civil algorithms.
+ */
+
+#define CIVIL_SECS_PER_DAY  86400
+
+/**
+ * @brief A broken-down calendar time.
+ */
+typedef struct {
+    int32_t year;
+    int8_t month;       // 1-12
+    int8_t day;         // 1-31
+    int8_t hour;        // 0-23
+    int8_t minute;      // 0-59
+    int8_t second;      // 0-59
+    int8_t weekday;     // 0 = Sunday
+    int16_t yday;       // 0-365
+} civil_time_t;
+
+// Days before the first of each month in a common year
+static const int16_t civil_days_before_month[13] = {
+    0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365
+};
+
+static const char civil_weekday_names[7][4] = {
+    "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"
+};
+
+static inline int64_t civil_floor_div(int64_t a, int64_t b)
+{
+    int64_t q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+static inline bool civil_is_leap(int32_t y)
+{
+    return (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+}
+
+static inline int civil_days_in_month(int32_t y, int m)
+{
+    return civil_days_before_month[m] - civil_days_before_month[m - 1] + (m == 2 && civil_is_leap(y));
+}
+
+/**
+ * @brief Zero-based day of the year.
+ */
+static inline int civil_day_of_year(int32_t y, int m, int d)
+{
+    return civil_days_before_month[m - 1] + (m > 2 && civil_is_leap(y)) + d - 1;
+}
+
+/**
+ * @brief Days since 1970-01-01 for a date.
+ */
+static inline int64_t civil_days_from_date(int32_t y, int m, int d)
+{
+    y -= m <= 2;
+    int64_t era = civil_floor_div(y, 400);
+    int64_t yoe = y - era * 400;                                        // [0, 399]
+    int64_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;       // [0, 365]
+    int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;                // [0, 146096]
+    return era * 146097 + doe - 719468;
+}
+
+/**
+ * @brief Date for a count of days since 1970-01-01.
+ */
+static inline void civil_date_from_days(int64_t days, int32_t *y, int8_t *m, int8_t *d)
+{
+    days += 719468;
+    int64_t era = civil_floor_div(days, 146097);
+    int64_t doe = days - era * 146097;
+    int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    int64_t mp = (5 * doy + 2) / 153;
+    *d = (int8_t)(doy - (153 * mp + 2) / 5 + 1);
+    *m = (int8_t)(mp < 10 ? mp + 3 : mp - 9);
+    *y = (int32_t)(yoe + era * 400 + (*m <= 2));
+}
+
+/**
+ * @brief Day of the week for a day count; 0 = Sunday.
+ */
+static inline int civil_weekday(int64_t days)
+{
+    return (int)(((days % 7) + 11) % 7); // 1970-01-01 was a Thursday
+}
+
+static inline int64_t civil_days_from_seconds(int64_t seconds)
+{
+    return civil_floor_div(seconds, CIVIL_SECS_PER_DAY);
+}
+
+static inline int64_t civil_to_seconds(int32_t y, int m, int d, int hour, int minute, int second)
+{
+    return civil_days_from_date(y, m, d) * CIVIL_SECS_PER_DAY + hour * 3600 + minute * 60 + second;
+}
+
+static inline void civil_from_seconds(int64_t seconds, civil_time_t *out)
+{
+    int64_t days = civil_days_from_seconds(seconds);
+    int32_t secs = (int32_t)(seconds - days * CIVIL_SECS_PER_DAY);
+
+    civil_date_from_days(days, &out->year, &out->month, &out->day);
+    out->hour = (int8_t)(secs / 3600);
+    out->minute = (int8_t)(secs / 60 % 60);
+    out->second = (int8_t)(secs % 60);
+    out->weekday = (int8_t)civil_weekday(days);
+    out->yday = (int16_t)civil_day_of_year(out->year, out->month, out->day);
+}
+
+/**
+ * @brief Day of the nth weekday in a month; n < 0 counts from the end.
+ */
+static inline int64_t civil_nth_weekday(int32_t y, int m, int weekday, int n)
+{
+    if (n >= 0) {
+        int64_t first = civil_days_from_date(y, m, 1);
+        int64_t day = first + (weekday - civil_weekday(first) + 7) % 7 + 7 * ((n > 0 ? n : 1) - 1);
+        int64_t limit = first + civil_days_in_month(y, m) - 1;
+        while (day > limit) {
+            day -= 7;
+        }
+        return day;
+    }
+    int64_t last = civil_days_from_date(y, m, civil_days_in_month(y, m));
+    return last - (civil_weekday(last) - weekday + 7) % 7 - 7 * (-n - 1);
+}
+
+#endif // CIVIL_TIME_H
@@ -0,0 +1,129 @@
+#include "event_cache.h"
+#include "event_image.h"
+#include "ext_flash.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+static const char *TAG = "event_cache";
+
+static uint32_t slot_offset(int slot)
+{
+    return EVENT_CACHE_OFFSET + (uint32_t)slot * EVENT_CACHE_SLOT_SIZE;
+}
+
+// Reads a slot's header; false if the slot holds no image of this version
+static bool read_header(esp_flash_t *chip, int slot, event_image_header_t *header)
+{
+    if (esp_flash_read(chip, header, slot_offset(slot), sizeof(*header)) != ESP_OK) {
+        return false;
+    }
+    return event_image_check_header(header, EVENT_CACHE_SLOT_SIZE);
+}
+
+static void *alloc_buffer(size_t size)
+{
+    void *buf = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    return buf ? buf : heap_caps_malloc(size, MALLOC_CAP_8BIT);
+}
+
+esp_err_t event_cache_save(const event_store_t *store, const ics_tz_zone_t *zone,
+                           const text_arena_t *text, int64_t sync_time)
+{
+    esp_err_t err = ext_flash_init();
+    if (err != ESP_OK) {
+        return err;
+    }
+    esp_flash_t *chip = ext_flash_get();
+
+    size_t size = event_image_size(store, text->top);
+    if (size > EVENT_CACHE_SLOT_SIZE) {
+        ESP_LOGE(TAG, "Image of %u bytes does not fit a %u byte slot", (unsigned)size, EVENT_CACHE_SLOT_SIZE);
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    // Overwrite the older slot, keeping the newest image intact
+    event_image_header_t headers[2];
+    bool valid[2];
+    for (int i = 0; i < 2; i++) {
+        valid[i] = read_header(chip, i, &headers[i]);
+    }
+    int slot = 0;
+    uint32_t sequence = 1;
+    if (valid[0] || valid[1]) {
+        int newest = (!valid[1] || (valid[0] && (int32_t)(headers[0].sequence - headers[1].sequence) > 0)) ? 0 : 1;
+        slot = 1 - newest;
+        sequence = headers[newest].sequence + 1;
+    }
+
+    uint8_t *buf = alloc_buffer(size);
+    if (buf == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    event_image_write(buf, size, sequence, sync_time, store, zone, text->buf, text->top);
+
+    size_t erase_size = (size + EXT_FLASH_SECTOR_SIZE - 1) / EXT_FLASH_SECTOR_SIZE * EXT_FLASH_SECTOR_SIZE;
+    err = esp_flash_erase_region(chip, slot_offset(slot), erase_size);
+    if (err == ESP_OK) {
+        err = esp_flash_write(chip, buf, slot_offset(slot), size);
+    }
+    free(buf);
+
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to write slot %d: %s", slot, esp_err_to_name(err));
+        return err;
+    }
+    ESP_LOGI(TAG, "Saved %d events (%u bytes) to slot %d, sequence %" PRIu32,
+             store->count, (unsigned)size, slot, sequence);
+    return ESP_OK;
+}
+
+esp_err_t event_cache_load(event_store_t *store, ics_tz_zone_t *zone, text_arena_t *text, int64_t *sync_time)
+{
+    esp_err_t err = ext_flash_init();
+    if (err != ESP_OK) {
+        return err;
+    }
+    esp_flash_t *chip = ext_flash_get();
+    int64_t started = esp_timer_get_time();
+
+    event_image_header_t headers[2];
+    bool valid[2];
+    for (int i = 0; i < 2; i++) {
+        valid[i] = read_header(chip, i, &headers[i]);
+    }
+
+    // Newest first; fall back to the other slot if it fails its checksum
+    int order[2] = {0, 1};
+    if (valid[0] && valid[1] && (int32_t)(headers[1].sequence - headers[0].sequence) > 0) {
+        order[0] = 1;
+        order[1] = 0;
+    }
+    for (int i = 0; i < 2; i++) {
+        int slot = order[i];
+        if (!valid[slot]) {
+            continue;
+        }
+        uint8_t *buf = alloc_buffer(headers[slot].size);
+        if (buf == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+        const char *pool;
+        size_t pool_len;
+        bool ok = esp_flash_read(chip, buf, slot_offset(slot), headers[slot].size) == ESP_OK &&
+                  event_image_read(buf, headers[slot].size, store, zone, &pool, &pool_len, sync_time) &&
+                  (text == NULL || text_arena_load(text, pool, pool_len));
+        free(buf);
+        if (ok) {
+            ESP_LOGI(TAG, "Loaded %d events from slot %d in %lld us", store->count, slot,
+                     (long long)(esp_timer_get_time() - started));
+            return ESP_OK;
+        }
+        ESP_LOGW(TAG, "Slot %d is corrupt", slot);
+    }
+    return ESP_ERR_NOT_FOUND;
+}
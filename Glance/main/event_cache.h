@@ -0,0 +1,44 @@
+#ifndef EVENT_CACHE_H
+#define EVENT_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "event_store.h"
+#include "ics_tz.h"
+#include "text_arena.h"
+
+/*
+ * Persists the synced event set to the external flash (see event_image.h),
+ * so wakes that do not sync can show events without the network. Images
+ * alternate between two slots and the newest valid one is loaded, so an
+ * interrupted write never loses the previous set.
+ */
+
+#define EVENT_CACHE_OFFSET      0x000000    // Start of the cache on the external flash
+#define EVENT_CACHE_SLOT_SIZE   (64 * 1024) // Bytes per slot, a multiple of the sector size
+
+/**
+ * @brief Writes the events of a sync to the older slot.
+ *
+ * @param store     Events to save.
+ * @param zone      Device zone the day index was built with.
+ * @param text      Text arena the store refers to.
+ * @param sync_time UTC time of the sync.
+ */
+esp_err_t event_cache_save(const event_store_t *store, const ics_tz_zone_t *zone,
+                           const text_arena_t *text, int64_t sync_time);
+
+/**
+ * @brief Loads the newest valid image.
+ *
+ * @param[out] store     Loaded events.
+ * @param[out] zone      Loaded device zone.
+ * @param[out] text      Arena to load the text pool into, or NULL to load only
+ *                       the columns, e.g. to compare against a new sync.
+ * @param[out] sync_time UTC time of the sync that produced the events.
+ * @return ESP_ERR_NOT_FOUND if no slot holds a valid image.
+ */
+esp_err_t event_cache_load(event_store_t *store, ics_tz_zone_t *zone, text_arena_t *text, int64_t *sync_time);
+
+#endif // EVENT_CACHE_H
@@ -0,0 +1,123 @@
+#include "event_heap.h"
+
+static void place(event_heap_t *h, int i, int16_t slot)
+{
+    h->heap[i] = slot;
+    h->pos[slot] = (int16_t)i;
+}
+
+static void sift_up(event_heap_t *h, int i)
+{
+    int16_t slot = h->heap[i];
+    int64_t key = h->keys[slot];
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (h->keys[h->heap[parent]] >= key) {
+            break;
+        }
+        place(h, i, h->heap[parent]);
+        i = parent;
+    }
+    place(h, i, slot);
+}
+
+static void sift_down(event_heap_t *h, int i)
+{
+    int16_t slot = h->heap[i];
+    int64_t key = h->keys[slot];
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= h->count) {
+            break;
+        }
+        if (child + 1 < h->count && h->keys[h->heap[child + 1]] > h->keys[h->heap[child]]) {
+            child++;
+        }
+        if (h->keys[h->heap[child]] <= key) {
+            break;
+        }
+        place(h, i, h->heap[child]);
+        i = child;
+    }
+    place(h, i, slot);
+}
+
+void event_heap_init(event_heap_t *h, int64_t *keys, int16_t *heap, int16_t *pos, int16_t capacity)
+{
+    h->keys = keys;
+    h->heap = heap;
+    h->pos = pos;
+    h->capacity = capacity;
+    h->count = 0;
+    h->evicted = 0;
+    h->rejected = 0;
+    for (int16_t i = 0; i < capacity; i++) {
+        heap[i] = i;
+        pos[i] = EVENT_HEAP_NO_SLOT;
+    }
+}
+
+int event_heap_offer(event_heap_t *h, int64_t key)
+{
+    if (h->count < h->capacity) {
+        int16_t slot = h->heap[h->count];
+        h->keys[slot] = key;
+        h->count++;
+        sift_up(h, h->count - 1);
+        return slot;
+    }
+    if (h->capacity == 0 || key >= h->keys[h->heap[0]]) {
+        h->rejected++;
+        return EVENT_HEAP_NO_SLOT;
+    }
+
+    // Reuse the latest event's slot
+    int16_t slot = h->heap[0];
+    h->keys[slot] = key;
+    h->evicted++;
+    sift_down(h, 0);
+    return slot;
+}
+
+void event_heap_remove(event_heap_t *h, int slot)
+{
+    int i = h->pos[slot];
+    if (i == EVENT_HEAP_NO_SLOT) {
+        return;
+    }
+    h->count--;
+    int16_t last = h->heap[h->count];
+    h->heap[h->count] = (int16_t)slot;
+    h->pos[slot] = EVENT_HEAP_NO_SLOT;
+    if (i == h->count) {
+        return;
+    }
+    place(h, i, last);
+    if (i > 0 && h->keys[h->heap[(i - 1) / 2]] < h->keys[last]) {
+        sift_up(h, i);
+    } else {
+        sift_down(h, i);
+    }
+}
+
+bool event_heap_holds(const event_heap_t *h, int slot)
+{
+    return slot >= 0 && slot < h->capacity && h->pos[slot] != EVENT_HEAP_NO_SLOT;
+}
+
+int event_heap_top(const event_heap_t *h)
+{
+    return h->count > 0 ? h->heap[0] : EVENT_HEAP_NO_SLOT;
+}
+
+int event_heap_drain(event_heap_t *h, int16_t *slots)
+{
+    // Popping the maximum fills the output from the back
+    int n = h->count;
+    while (h->count > 0) {
+        int16_t slot = h->heap[0];
+        slots[h->count - 1] = slot;
+        event_heap_remove(h, slot);
+    }
+    return n;
+}
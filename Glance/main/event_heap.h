@@ -0,0 +1,78 @@
+#ifndef EVENT_HEAP_H
+#define EVENT_HEAP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Bounded selection of the K earliest events.
+ *
+ * An indexed max-heap over K slots: the latest kept start sits at the root,
+ * so an incoming event is rejected or takes the root's slot in O(log K), and
+ * the events kept never depend on the order they were found in. Slots are
+ * stable handles for the caller's payload array; a slot's payload is only
+ * replaced when the event in it is evicted or removed.
+ *
+ * The heap array is a permutation of all slots: the first count entries form
+ * the heap and the rest are the free slots.
+ */
+
+#define EVENT_HEAP_NO_SLOT  -1
+
+typedef struct {
+    int64_t *keys;          // Start time per slot
+    int16_t *heap;          // Slot ids
+    int16_t *pos;           // Heap position per slot, EVENT_HEAP_NO_SLOT when free
+    int16_t capacity;
+    int16_t count;
+    uint32_t evicted;       // Events pushed out by earlier ones
+    uint32_t rejected;      // Events later than everything kept while full
+} event_heap_t;
+
+/**
+ * @brief Initializes an empty heap over caller-provided arrays.
+ *
+ * @param h        Heap to initialize.
+ * @param keys     Array of capacity keys.
+ * @param heap     Array of capacity slot ids.
+ * @param pos      Array of capacity positions.
+ * @param capacity Number of events kept (K).
+ */
+void event_heap_init(event_heap_t *h, int64_t *keys, int16_t *heap, int16_t *pos, int16_t capacity);
+
+/**
+ * @brief Offers an event.
+ *
+ * When the heap is full the latest event is evicted if the new one starts
+ * earlier; ties keep the event already held.
+ *
+ * @return The slot to store the event's payload in, or EVENT_HEAP_NO_SLOT
+ *         if the event is not among the K earliest.
+ */
+int event_heap_offer(event_heap_t *h, int64_t key);
+
+/**
+ * @brief Removes the event held in a slot and frees the slot.
+ */
+void event_heap_remove(event_heap_t *h, int slot);
+
+/**
+ * @brief Returns true if the slot currently holds an event.
+ */
+bool event_heap_holds(const event_heap_t *h, int slot);
+
+/**
+ * @brief Returns the slot holding the latest event, or EVENT_HEAP_NO_SLOT if
+ * the heap is empty.
+ */
+int event_heap_top(const event_heap_t *h);
+
+/**
+ * @brief Empties the heap, listing the slots in ascending key order.
+ *
+ * @param[out] slots Array of at least count entries.
+ * @return The number of slots written.
+ */
+int event_heap_drain(event_heap_t *h, int16_t *slots);
+
+#endif // EVENT_HEAP_H
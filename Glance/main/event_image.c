@@ -0,0 +1,224 @@
+#include "event_image.h"
+#include <string.h>
+
+// The zone section: tzid_hash, initial_offset, count, overflow and two zero bytes, then per transition
+// utc, offset_from and offset_to. Written field by field so it does not depend on ics_tz_zone_t's padding.
+#define ZONE_HEAD_SIZE          12
+#define ZONE_TRANSITION_SIZE    16
+#define ZONE_SIZE               (ZONE_HEAD_SIZE + ICS_TZ_MAX_TRANSITIONS * ZONE_TRANSITION_SIZE)
+
+static uint32_t align8(uint32_t n)
+{
+    return (n + 7u) & ~7u;
+}
+
+// Fills in the section offsets and size of an image
+static void layout(event_image_header_t *h, uint16_t count, size_t text_len)
+{
+    uint32_t off = align8(sizeof(event_image_header_t));
+    h->off_start = off;
+    off = align8(off + count * sizeof(int64_t));
+    h->off_end = off;
+    off = align8(off + count * sizeof(int64_t));
+    h->off_flags = off;
+    off = align8(off + count * sizeof(uint8_t));
+    h->off_summary = off;
+    off = align8(off + count * sizeof(text_ref_t));
+    h->off_location = off;
+    off = align8(off + count * sizeof(text_ref_t));
+    h->off_description = off;
+    off = align8(off + count * sizeof(text_ref_t));
+    h->off_uid = off;
+    off = align8(off + count * sizeof(uint32_t));
+    h->off_hash = off;
+    off = align8(off + count * sizeof(uint64_t));
+    h->off_href = off;
+    off = align8(off + count * sizeof(uint32_t));
+    h->off_days = off;
+    off = align8(off + (EVENT_STORE_DAYS + 1) * sizeof(uint16_t));
+    h->off_zone = off;
+    h->zone_size = ZONE_SIZE;
+    off = align8(off + ZONE_SIZE);
+    h->off_text = off;
+    h->text_len = (uint32_t)text_len;
+    h->size = off + (uint32_t)text_len;
+}
+
+// Transitions past count are left zero
+static void write_zone(uint8_t *out, const ics_tz_zone_t *zone)
+{
+    uint8_t count = zone->count < ICS_TZ_MAX_TRANSITIONS ? zone->count : ICS_TZ_MAX_TRANSITIONS;
+    memcpy(out, &zone->tzid_hash, sizeof(uint32_t));
+    memcpy(out + 4, &zone->initial_offset, sizeof(int32_t));
+    out[8] = count;
+    out[9] = zone->overflow ? 1 : 0;
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t *t = out + ZONE_HEAD_SIZE + i * ZONE_TRANSITION_SIZE;
+        memcpy(t, &zone->transitions[i].utc, sizeof(int64_t));
+        memcpy(t + 8, &zone->transitions[i].offset_from, sizeof(int32_t));
+        memcpy(t + 12, &zone->transitions[i].offset_to, sizeof(int32_t));
+    }
+}
+
+static bool read_zone(const uint8_t *in, ics_tz_zone_t *zone)
+{
+    if (in[8] > ICS_TZ_MAX_TRANSITIONS || in[9] > 1) {
+        return false;
+    }
+    memset(zone, 0, sizeof(*zone));
+    memcpy(&zone->tzid_hash, in, sizeof(uint32_t));
+    memcpy(&zone->initial_offset, in + 4, sizeof(int32_t));
+    zone->count = in[8];
+    zone->overflow = in[9] != 0;
+    for (uint8_t i = 0; i < zone->count; i++) {
+        const uint8_t *t = in + ZONE_HEAD_SIZE + i * ZONE_TRANSITION_SIZE;
+        memcpy(&zone->transitions[i].utc, t, sizeof(int64_t));
+        memcpy(&zone->transitions[i].offset_from, t + 8, sizeof(int32_t));
+        memcpy(&zone->transitions[i].offset_to, t + 12, sizeof(int32_t));
+    }
+    return true;
+}
+
+uint32_t event_image_crc32(uint32_t crc, const void *data, size_t len)
+{
+    // Nibble-wise table: small enough for flash, fast enough for a few KB
+    static const uint32_t table[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+    };
+    const uint8_t *p = data;
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= p[i];
+        crc = (crc >> 4) ^ table[crc & 0x0F];
+        crc = (crc >> 4) ^ table[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+size_t event_image_size(const event_store_t *store, size_t text_len)
+{
+    event_image_header_t h;
+    layout(&h, store->count, text_len);
+    return h.size;
+}
+
+size_t event_image_write(uint8_t *buf, size_t cap, uint32_t sequence, int64_t sync_time,
+                         const event_store_t *store, const ics_tz_zone_t *zone,
+                         const char *text, size_t text_len)
+{
+    event_image_header_t h = {
+        .magic = EVENT_IMAGE_MAGIC,
+        .version = EVENT_IMAGE_VERSION,
+        .header_size = sizeof(event_image_header_t),
+        .sequence = sequence,
+        .count = store->count,
+        .days = EVENT_STORE_DAYS,
+        .sync_time = sync_time,
+        .first_day = store->first_day,
+    };
+    layout(&h, store->count, text_len);
+    if (h.size > cap) {
+        return 0;
+    }
+
+    memset(buf, 0, h.size); // Padding is covered by the CRC
+    memcpy(buf + h.off_start, store->start, store->count * sizeof(int64_t));
+    memcpy(buf + h.off_end, store->end, store->count * sizeof(int64_t));
+    memcpy(buf + h.off_flags, store->flags, store->count * sizeof(uint8_t));
+    memcpy(buf + h.off_summary, store->summary, store->count * sizeof(text_ref_t));
+    memcpy(buf + h.off_location, store->location, store->count * sizeof(text_ref_t));
+    memcpy(buf + h.off_description, store->description, store->count * sizeof(text_ref_t));
+    memcpy(buf + h.off_uid, store->uid, store->count * sizeof(uint32_t));
+    memcpy(buf + h.off_hash, store->hash, store->count * sizeof(uint64_t));
+    memcpy(buf + h.off_href, store->href, store->count * sizeof(uint32_t));
+    memcpy(buf + h.off_days, store->day_first, sizeof(store->day_first));
+    write_zone(buf + h.off_zone, zone);
+    memcpy(buf + h.off_text, text, text_len);
+
+    h.crc = event_image_crc32(0, buf + sizeof(h), h.size - sizeof(h));
+    memcpy(buf, &h, sizeof(h));
+    return h.size;
+}
+
+bool event_image_check_header(const event_image_header_t *header, size_t max_size)
+{
+    return header->magic == EVENT_IMAGE_MAGIC &&
+           header->version == EVENT_IMAGE_VERSION &&
+           header->header_size == sizeof(event_image_header_t) &&
+           header->size >= sizeof(event_image_header_t) &&
+           header->size <= max_size;
+}
+
+bool event_image_read(const uint8_t *image, size_t len, event_store_t *store, ics_tz_zone_t *zone,
+                      const char **text, size_t *text_len, int64_t *sync_time)
+{
+    event_image_header_t h;
+    if (len < sizeof(h)) {
+        return false;
+    }
+    memcpy(&h, image, sizeof(h));
+    if (!event_image_check_header(&h, len) ||
+        h.count > EVENT_STORE_CAPACITY || h.days != EVENT_STORE_DAYS ||
+        h.zone_size != ZONE_SIZE) {
+        return false;
+    }
+
+    // The layout is fully determined by the counts; reject anything else
+    event_image_header_t expected = h;
+    layout(&expected, h.count, h.text_len);
+    if (memcmp(&expected, &h, sizeof(h)) != 0) {
+        return false;
+    }
+    if (event_image_crc32(0, image + sizeof(h), h.size - sizeof(h)) != h.crc) {
+        return false;
+    }
+
+    // Text references must stay inside the pool and end at a NUL
+    const char *pool = (const char *)image + h.off_text;
+    for (uint16_t i = 0; i < h.count; i++) {
+        text_ref_t refs[3];
+        memcpy(&refs[0], image + h.off_summary + i * sizeof(text_ref_t), sizeof(text_ref_t));
+        memcpy(&refs[1], image + h.off_location + i * sizeof(text_ref_t), sizeof(text_ref_t));
+        memcpy(&refs[2], image + h.off_description + i * sizeof(text_ref_t), sizeof(text_ref_t));
+        for (int k = 0; k < 3; k++) {
+            if (h.text_len == 0 || refs[k].offset >= h.text_len || refs[k].len >= h.text_len - refs[k].offset ||
+                pool[refs[k].offset + refs[k].len] != '\0') {
+                return false;
+            }
+        }
+    }
+
+    ics_tz_zone_t loaded_zone;
+    if (!read_zone(image + h.off_zone, &loaded_zone)) {
+        return false;
+    }
+
+    // Day buckets must be ascending indexes into the events
+    uint16_t day_first[EVENT_STORE_DAYS + 1];
+    memcpy(day_first, image + h.off_days, sizeof(day_first));
+    for (int i = 0; i <= EVENT_STORE_DAYS; i++) {
+        if (day_first[i] > h.count || (i > 0 && day_first[i] < day_first[i - 1])) {
+            return false;
+        }
+    }
+
+    store->count = h.count;
+    store->first_day = h.first_day;
+    memcpy(store->start, image + h.off_start, h.count * sizeof(int64_t));
+    memcpy(store->end, image + h.off_end, h.count * sizeof(int64_t));
+    memcpy(store->flags, image + h.off_flags, h.count * sizeof(uint8_t));
+    memcpy(store->summary, image + h.off_summary, h.count * sizeof(text_ref_t));
+    memcpy(store->location, image + h.off_location, h.count * sizeof(text_ref_t));
+    memcpy(store->description, image + h.off_description, h.count * sizeof(text_ref_t));
+    memcpy(store->uid, image + h.off_uid, h.count * sizeof(uint32_t));
+    memcpy(store->hash, image + h.off_hash, h.count * sizeof(uint64_t));
+    memcpy(store->href, image + h.off_href, h.count * sizeof(uint32_t));
+    memcpy(store->day_first, day_first, sizeof(store->day_first));
+    event_store_index_spans(store);
+    *zone = loaded_zone;
+    *text = pool;
+    *text_len = h.text_len;
+    *sync_time = h.sync_time;
+    return true;
+}
@@ -0,0 +1,107 @@
+#ifndef EVENT_IMAGE_H
+#define EVENT_IMAGE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "event_store.h"
+#include "ics_tz.h"
+
+/*
+ * Binary image of a synced event set, as persisted to external flash.
+ *
+ * The image is the event store's columns, its day index, the device zone and
+ * the text pool laid out back to back (little-endian, each section 8-byte
+ * aligned) behind a fixed header. Loading copies the columns into place; only
+ * the zone is written and read field by field, so the image does not depend on
+ * the padding of ics_tz_zone_t. A CRC-32 over everything after the header
+ * guards against torn or stale writes, and the version changes whenever the
+ * layout does.
+ *
+ * playground/event_image_tool reads and writes the same format on a host.
+ */
+
+#define EVENT_IMAGE_MAGIC       0x56454C47u // "GLEV"
+#define EVENT_IMAGE_VERSION     5
+
+/**
+ * @brief Image header. Offsets are from the start of the image.
+ */
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t header_size;       // sizeof(event_image_header_t)
+    uint32_t sequence;          // Incremented on every write, the newest image wins
+    uint32_t size;              // Total image size, header included
+    uint32_t crc;               // CRC-32 of the bytes after the header
+    uint16_t count;             // Events
+    uint16_t days;              // Day buckets, EVENT_STORE_DAYS
+    int64_t sync_time;          // UTC time of the sync that produced the events
+    int64_t first_day;          // Local day number of bucket 0
+    uint32_t off_start;         // int64_t[count]
+    uint32_t off_end;           // int64_t[count]
+    uint32_t off_flags;         // uint8_t[count]
+    uint32_t off_summary;       // text_ref_t[count]
+    uint32_t off_location;      // text_ref_t[count]
+    uint32_t off_description;   // text_ref_t[count]
+    uint32_t off_uid;           // uint32_t[count]
+    uint32_t off_hash;          // uint64_t[count]
+    uint32_t off_days;          // uint16_t[days + 1]
+    uint32_t off_zone;          // Zone fields, see write_zone() in event_image.c
+    uint32_t zone_size;
+    uint32_t off_text;          // Text pool, offsets as in text_ref_t
+    uint32_t text_len;
+    uint32_t off_href;          // uint32_t[count]
+} event_image_header_t;
+
+/**
+ * @brief Size of the image for a store and text pool.
+ */
+size_t event_image_size(const event_store_t *store, size_t text_len);
+
+/**
+ * @brief Serializes a store into an image.
+ *
+ * @param buf       Output buffer, at least event_image_size() bytes.
+ * @param cap       Size of buf.
+ * @param sequence  Sequence number of this image.
+ * @param sync_time UTC time of the sync.
+ * @param store     Events to write.
+ * @param zone      Device zone the day index was built with.
+ * @param text      Text pool the store's references point into.
+ * @param text_len  Bytes of the text pool in use.
+ * @return The image size, or 0 if buf is too small.
+ */
+size_t event_image_write(uint8_t *buf, size_t cap, uint32_t sequence, int64_t sync_time,
+                         const event_store_t *store, const ics_tz_zone_t *zone,
+                         const char *text, size_t text_len);
+
+/**
+ * @brief Checks a header before the rest of the image is read.
+ *
+ * @param max_size Largest image the caller can hold.
+ * @return true if the header describes an image of this version that fits.
+ */
+bool event_image_check_header(const event_image_header_t *header, size_t max_size);
+
+/**
+ * @brief Verifies an image and loads it.
+ *
+ * @param image          Complete image.
+ * @param len            Bytes available at image.
+ * @param[out] store     Loaded events.
+ * @param[out] zone      Loaded device zone.
+ * @param[out] text      Set to the text pool inside the image.
+ * @param[out] text_len  Set to the length of the text pool.
+ * @param[out] sync_time Set to the UTC time of the sync.
+ * @return false if the image is malformed or its checksum does not match.
+ */
+bool event_image_read(const uint8_t *image, size_t len, event_store_t *store, ics_tz_zone_t *zone,
+                      const char **text, size_t *text_len, int64_t *sync_time);
+
+/**
+ * @brief Updates a CRC-32 (IEEE 802.3, as zlib's crc32()) with more data.
+ */
+uint32_t event_image_crc32(uint32_t crc, const void *data, size_t len);
+
+#endif // EVENT_IMAGE_H
@@ -0,0 +1,216 @@
+#include "event_store.h"
+
+void event_store_clear(event_store_t *store)
+{
+    store->count = 0;
+    store->first_day = 0;
+    for (int i = 0; i <= EVENT_STORE_DAYS; i++) {
+        store->day_first[i] = 0;
+    }
+}
+
+bool event_store_append(event_store_t *store, int64_t start, int64_t end, uint8_t flags,
+                        text_ref_t summary, text_ref_t location, text_ref_t description,
+                        uint32_t uid, uint64_t hash, uint32_t href)
+{
+    if (store->count >= EVENT_STORE_CAPACITY) {
+        return false;
+    }
+    uint16_t i = store->count++;
+    store->start[i] = start;
+    store->end[i] = end;
+    store->flags[i] = flags;
+    store->summary[i] = summary;
+    store->location[i] = location;
+    store->description[i] = description;
+    store->uid[i] = uid;
+    store->hash[i] = hash;
+    store->href[i] = href;
+    return true;
+}
+
+// Index of the first event starting at or after t
+static int lower_bound(const event_store_t *store, int64_t t)
+{
+    int lo = 0;
+    int hi = store->count;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (store->start[mid] < t) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// End of an event for overlap tests; one without duration lasts an instant
+static int64_t span_end(const event_store_t *store, int i)
+{
+    return store->end[i] > store->start[i] ? store->end[i] : store->start[i] + 1;
+}
+
+/*
+ * The tree over events [lo, hi) has the middle event at its root, the events
+ * before it on the left and those after it on the right. Every event is the
+ * root of exactly one subtree, so its span_end slot holds that subtree's
+ * latest end.
+ */
+static int64_t build_spans(event_store_t *store, int lo, int hi)
+{
+    if (lo >= hi) {
+        return INT64_MIN;
+    }
+    int mid = (lo + hi) / 2;
+    int64_t end = span_end(store, mid);
+    int64_t left = build_spans(store, lo, mid);
+    int64_t right = build_spans(store, mid + 1, hi);
+    end = left > end ? left : end;
+    end = right > end ? right : end;
+    store->span_end[mid] = end;
+    return end;
+}
+
+void event_store_index_spans(event_store_t *store)
+{
+    build_spans(store, 0, store->count);
+}
+
+void event_store_index_days(event_store_t *store, int64_t first_day, const int64_t *day_starts)
+{
+    store->first_day = first_day;
+    for (int i = 0; i <= EVENT_STORE_DAYS; i++) {
+        store->day_first[i] = (uint16_t)lower_bound(store, day_starts[i]);
+    }
+    event_store_index_spans(store);
+}
+
+// Visits the subtree over [lo, hi) in start order, counting events that overlap [from, to)
+static void find_overlapping(const event_store_t *store, int lo, int hi, int64_t from, int64_t to,
+                             uint16_t *out, int max, int *n)
+{
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (store->span_end[mid] <= from) {
+            return; // Everything below ends before the range
+        }
+        find_overlapping(store, lo, mid, from, to, out, max, n);
+        if (store->start[mid] >= to) {
+            return; // Everything to the right starts after the range
+        }
+        if (span_end(store, mid) > from) {
+            if (*n < max) {
+                out[*n] = (uint16_t)mid;
+            }
+            (*n)++;
+        }
+        lo = mid + 1;
+    }
+}
+
+int event_store_overlapping(const event_store_t *store, int64_t from, int64_t to, uint16_t *out, int max)
+{
+    int n = 0;
+    if (to > from) {
+        find_overlapping(store, 0, store->count, from, to, out, max, &n);
+    }
+    return n;
+}
+
+int event_store_query(const event_store_t *store, int64_t from, int64_t to, int *first)
+{
+    int lo = lower_bound(store, from);
+    int hi = to > from ? lower_bound(store, to) : lo;
+    *first = lo;
+    return hi - lo;
+}
+
+int event_store_day(const event_store_t *store, int64_t day, int *first)
+{
+    int64_t i = day - store->first_day;
+    if (i < 0 || i >= EVENT_STORE_DAYS) {
+        *first = 0;
+        return 0;
+    }
+    *first = store->day_first[i];
+    return store->day_first[i + 1] - store->day_first[i];
+}
+
+int event_store_drop_started(event_store_t *store, int64_t now)
+{
+    // kept_before[i] is the new index of old event i, so buckets can be remapped
+    uint16_t kept_before[EVENT_STORE_CAPACITY + 1];
+    uint16_t n = 0;
+    for (uint16_t i = 0; i < store->count; i++) {
+        kept_before[i] = n;
+        if (store->start[i] <= now && (!(store->flags[i] & EVENT_STORE_ALL_DAY) || store->end[i] <= now)) {
+            continue;
+        }
+        if (n != i) {
+            store->start[n] = store->start[i];
+            store->end[n] = store->end[i];
+            store->flags[n] = store->flags[i];
+            store->summary[n] = store->summary[i];
+            store->location[n] = store->location[i];
+            store->description[n] = store->description[i];
+            store->uid[n] = store->uid[i];
+            store->hash[n] = store->hash[i];
+            store->href[n] = store->href[i];
+        }
+        n++;
+    }
+    kept_before[store->count] = n;
+
+    int dropped = store->count - n;
+    store->count = n;
+    for (int i = 0; i <= EVENT_STORE_DAYS; i++) {
+        store->day_first[i] = kept_before[store->day_first[i]];
+    }
+    event_store_index_spans(store);
+    return dropped;
+}
+
+// Finds the event of another store with the same start and UID, preferring one with the same content
+static int find_match(const event_store_t *store, int64_t start, uint32_t uid, uint64_t hash)
+{
+    int match = -1;
+    for (int i = lower_bound(store, start); i < store->count && store->start[i] == start; i++) {
+        if (store->uid[i] != uid) {
+            continue;
+        }
+        if (store->hash[i] == hash) {
+            return i;
+        }
+        if (match < 0) {
+            match = i;
+        }
+    }
+    return match;
+}
+
+bool event_store_diff(const event_store_t *older, const event_store_t *newer, int64_t from, int64_t to,
+                      event_store_diff_t *diff)
+{
+    diff->added = 0;
+    diff->removed = 0;
+    diff->changed = 0;
+
+    int first;
+    int n = event_store_query(newer, from, to, &first);
+    for (int i = first; i < first + n; i++) {
+        int j = find_match(older, newer->start[i], newer->uid[i], newer->hash[i]);
+        if (j < 0) {
+            diff->added++;
+        } else if (older->hash[j] != newer->hash[i]) {
+            diff->changed++;
+        }
+    }
+    n = event_store_query(older, from, to, &first);
+    for (int i = first; i < first + n; i++) {
+        if (find_match(newer, older->start[i], older->uid[i], older->hash[i]) < 0) {
+            diff->removed++;
+        }
+    }
+    return diff->added != 0 || diff->removed != 0 || diff->changed != 0;
+}
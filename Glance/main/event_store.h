@@ -0,0 +1,144 @@
+#ifndef EVENT_STORE_H
+#define EVENT_STORE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "text_arena.h"
+
+/*
+ * Columnar store of the events kept by a sync.
+ *
+ * Start times, end times, flags and text references live in separate packed
+ * arrays sorted by start, so range queries and layout only touch the 8-byte
+ * time columns and text is read only for events that are drawn. Range
+ * queries are binary searches; events are also bucketed by local day.
+ *
+ * Multi-day events overlap days after the one they start on. For those the
+ * start-sorted columns double as an implicit interval tree: the subtree of
+ * each midpoint keeps its latest end, so finding the events overlapping a
+ * day or a grid cell skips every subtree that ends before it.
+ *
+ * Each event also carries its UID hash and a 64-bit content hash, so the
+ * stores of two syncs can be compared without looking at any text, and the
+ * hash of the CalDAV resource or ICS feed it came from, so incremental syncs
+ * can replace or delete a resource's events.
+ */
+
+#define EVENT_STORE_CAPACITY    50  // Events kept per sync
+#define EVENT_STORE_DAYS        16  // Day buckets, from the local day of the sync
+
+#define EVENT_STORE_ALL_DAY     0x01
+
+typedef struct {
+    uint16_t count;
+    int64_t start[EVENT_STORE_CAPACITY];            // UTC, ascending
+    int64_t end[EVENT_STORE_CAPACITY];              // UTC, exclusive
+    uint8_t flags[EVENT_STORE_CAPACITY];            // EVENT_STORE_* flags
+    text_ref_t summary[EVENT_STORE_CAPACITY];
+    text_ref_t location[EVENT_STORE_CAPACITY];
+    text_ref_t description[EVENT_STORE_CAPACITY];
+    uint32_t uid[EVENT_STORE_CAPACITY];             // UID hash; with start, identifies an event across syncs
+    uint64_t hash[EVENT_STORE_CAPACITY];            // Content hash, changes whenever the event does
+    uint32_t href[EVENT_STORE_CAPACITY];            // Hash of the CalDAV resource's href, or of the ICS feed's URL
+
+    int64_t first_day;                              // Local day number of bucket 0
+    uint16_t day_first[EVENT_STORE_DAYS + 1];       // First event of each bucket, then the end of the last
+
+    int64_t span_end[EVENT_STORE_CAPACITY];         // Latest end in the tree below each event, derived
+} event_store_t;
+
+/**
+ * @brief Differences between two stores over a time range.
+ */
+typedef struct {
+    uint16_t added;         // Events only in the newer store
+    uint16_t removed;       // Events only in the older store
+    uint16_t changed;       // Events in both whose content hash differs
+} event_store_diff_t;
+
+/**
+ * @brief Empties the store.
+ */
+void event_store_clear(event_store_t *store);
+
+/**
+ * @brief Appends an event. Events must be appended in ascending start order.
+ *
+ * @return false if the store is full.
+ */
+bool event_store_append(event_store_t *store, int64_t start, int64_t end, uint8_t flags,
+                        text_ref_t summary, text_ref_t location, text_ref_t description,
+                        uint32_t uid, uint64_t hash, uint32_t href);
+
+/**
+ * @brief Builds the per-day buckets and the interval tree once all events
+ * are appended.
+ *
+ * @param store      Store to index.
+ * @param first_day  Local day number of the first bucket.
+ * @param day_starts UTC start of each bucket's local day, EVENT_STORE_DAYS + 1
+ *                   entries so the last bucket has an end.
+ */
+void event_store_index_days(event_store_t *store, int64_t first_day, const int64_t *day_starts);
+
+/**
+ * @brief Finds the events starting in [from, to).
+ *
+ * @param[out] first Index of the first such event.
+ * @return The number of events.
+ */
+int event_store_query(const event_store_t *store, int64_t from, int64_t to, int *first);
+
+/**
+ * @brief Finds the events overlapping [from, to), including those that
+ * started earlier and are still running, in O(log n + k).
+ *
+ * An event with no duration counts as an instant at its start.
+ *
+ * @param[out] out Indexes of the events, in start order.
+ * @param max      Room in out.
+ * @return The number of events, which may be more than max; only the first
+ *         max are written.
+ */
+int event_store_overlapping(const event_store_t *store, int64_t from, int64_t to, uint16_t *out, int max);
+
+/**
+ * @brief Rebuilds the interval tree after the time columns were filled in
+ * some other way, such as loading a saved image.
+ */
+void event_store_index_spans(event_store_t *store);
+
+/**
+ * @brief Finds the events starting on a local day.
+ *
+ * @param day        Day number, as in first_day.
+ * @param[out] first Index of the first event on that day.
+ * @return The number of events, 0 for days outside the buckets.
+ */
+int event_store_day(const event_store_t *store, int64_t day, int *first);
+
+/**
+ * @brief Drops timed events that started at or before a time, keeping the
+ * day buckets and the interval tree consistent. All-day events are kept until they end.
+ *
+ * @return The number of events dropped.
+ */
+int event_store_drop_started(event_store_t *store, int64_t now);
+
+/**
+ * @brief Compares the events starting in [from, to) of two stores.
+ *
+ * Events are matched by start time and UID hash, so a moved event counts as
+ * removed and added.
+ *
+ * @param older      Store of the previous sync.
+ * @param newer      Store of the current sync.
+ * @param from       Start of the range, UTC.
+ * @param to         End of the range, UTC.
+ * @param[out] diff  Counts of added, removed and changed events.
+ * @return true if the stores differ in the range.
+ */
+bool event_store_diff(const event_store_t *older, const event_store_t *newer, int64_t from, int64_t to,
+                      event_store_diff_t *diff);
+
+#endif // EVENT_STORE_H
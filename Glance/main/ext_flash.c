@@ -0,0 +1,50 @@
+#include "ext_flash.h"
+#include "hardware.h"
+#include "esp_flash_spi_init.h"
+#include "esp_log.h"
+
+#include <inttypes.h>
+
+static const char *TAG = "ext_flash";
+static esp_flash_t *ext_flash = NULL;
+
+esp_err_t ext_flash_init(void)
+{
+    if (ext_flash != NULL) {
+        return ESP_OK;
+    }
+
+    // Only CLK/MOSI/MISO are routed, so the chip runs in single-line mode
+    const esp_flash_spi_device_config_t config = {
+        .host_id = SPI2_HOST,
+        .cs_id = 0,
+        .cs_io_num = PIN_FLS_CS,
+        .io_mode = SPI_FLASH_FASTRD,
+        .freq_mhz = 40,
+    };
+    esp_flash_t *chip;
+    esp_err_t err = spi_bus_add_flash_device(&chip, &config);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to add flash device: %s", esp_err_to_name(err));
+        return err;
+    }
+    err = esp_flash_init(chip);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to initialize flash: %s", esp_err_to_name(err));
+        spi_bus_remove_flash_device(chip);
+        return err;
+    }
+
+    uint32_t id = 0;
+    uint32_t size = 0;
+    esp_flash_read_id(chip, &id);
+    esp_flash_get_size(chip, &size);
+    ESP_LOGI(TAG, "External flash ID %06" PRIX32 ", %" PRIu32 " KB", id, size / 1024);
+    ext_flash = chip;
+    return ESP_OK;
+}
+
+esp_flash_t *ext_flash_get(void)
+{
+    return ext_flash;
+}
@@ -0,0 +1,24 @@
+#ifndef EXT_FLASH_H
+#define EXT_FLASH_H
+
+#include "esp_err.h"
+#include "esp_flash.h"
+
+#define EXT_FLASH_SECTOR_SIZE   4096
+
+/**
+ * @brief Attaches the W25Q128 on the shared SPI bus as an esp_flash device.
+ *
+ * Requires display_hardware_init() to have set up the bus. Safe to call
+ * more than once.
+ *
+ * @return ESP_OK if the chip responded.
+ */
+esp_err_t ext_flash_init(void);
+
+/**
+ * @brief Returns the external flash chip, or NULL before ext_flash_init().
+ */
+esp_flash_t *ext_flash_get(void);
+
+#endif // EXT_FLASH_H
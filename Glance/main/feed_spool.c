@@ -0,0 +1,126 @@
+#include "feed_spool.h"
+#include "event_cache.h"
+#include "event_image.h"
+#include "ext_flash.h"
+#include "esp_log.h"
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <string.h>
+
+#define SPOOL_MAGIC     0x4C4F5053  // "SPOL"
+
+_Static_assert(FEED_SPOOL_OFFSET >= EVENT_CACHE_OFFSET + 2 * EVENT_CACHE_SLOT_SIZE, "Spool overlaps the event cache");
+_Static_assert(FEED_SPOOL_SLOT_SIZE % EXT_FLASH_SECTOR_SIZE == 0, "Slots must be whole sectors");
+
+static const char *TAG = "feed_spool";
+
+static uint32_t header_offset(int slot)
+{
+    return FEED_SPOOL_OFFSET + (uint32_t)slot * FEED_SPOOL_SLOT_SIZE;
+}
+
+static uint32_t data_offset(int slot)
+{
+    return header_offset(slot) + EXT_FLASH_SECTOR_SIZE;
+}
+
+static uint32_t header_crc(const feed_spool_header_t *header)
+{
+    return event_image_crc32(0, header, offsetof(feed_spool_header_t, crc));
+}
+
+static bool read_header(int slot, feed_spool_header_t *header)
+{
+    if (ext_flash_init() != ESP_OK ||
+        esp_flash_read(ext_flash_get(), header, header_offset(slot), sizeof(*header)) != ESP_OK) {
+        return false;
+    }
+    return header->magic == SPOOL_MAGIC && header->crc == header_crc(header) &&
+           header->length > 0 && header->length <= header->total && header->length <= FEED_SPOOL_CAPACITY &&
+           memchr(header->validator, '\0', sizeof(header->validator)) != NULL;
+}
+
+bool feed_spool_find(int slot, uint32_t url_hash, feed_spool_header_t *header)
+{
+    return slot >= 0 && slot < FEED_SPOOL_SLOTS && read_header(slot, header) && header->url_hash == url_hash;
+}
+
+esp_err_t feed_spool_read(int slot, uint32_t offset, void *buf, size_t len)
+{
+    return esp_flash_read(ext_flash_get(), buf, data_offset(slot) + offset, len);
+}
+
+void feed_spool_discard(int slot)
+{
+    // Erasing costs tens of milliseconds, so only slots that hold something are erased
+    feed_spool_header_t header;
+    if (ext_flash_init() == ESP_OK &&
+        esp_flash_read(ext_flash_get(), &header, header_offset(slot), sizeof(header)) == ESP_OK &&
+        header.magic != 0xFFFFFFFF) {
+        esp_flash_erase_region(ext_flash_get(), header_offset(slot), EXT_FLASH_SECTOR_SIZE);
+    }
+}
+
+void feed_spool_open(feed_spool_writer_t *w, int slot, uint32_t length)
+{
+    w->slot = slot;
+    w->length = length;
+    // The sector the kept bytes end in was erased with them; the rest of it is still blank
+    w->erased = (length + EXT_FLASH_SECTOR_SIZE - 1) / EXT_FLASH_SECTOR_SIZE * EXT_FLASH_SECTOR_SIZE;
+    w->failed = slot < 0 || slot >= FEED_SPOOL_SLOTS || ext_flash_init() != ESP_OK;
+    if (!w->failed && length == 0) {
+        feed_spool_discard(slot);
+    }
+}
+
+bool feed_spool_write(feed_spool_writer_t *w, const void *data, size_t len)
+{
+    if (w->failed) {
+        return false;
+    }
+    if (len > FEED_SPOOL_CAPACITY - w->length) {
+        ESP_LOGW(TAG, "Body longer than the %u bytes a slot holds, no longer spooled", (unsigned)FEED_SPOOL_CAPACITY);
+        w->failed = true;
+        return false;
+    }
+    esp_flash_t *chip = ext_flash_get();
+    esp_err_t err = ESP_OK;
+    while (err == ESP_OK && w->erased < w->length + len) {
+        err = esp_flash_erase_region(chip, data_offset(w->slot) + w->erased, EXT_FLASH_SECTOR_SIZE);
+        w->erased += EXT_FLASH_SECTOR_SIZE;
+    }
+    if (err == ESP_OK) {
+        err = esp_flash_write(chip, data, data_offset(w->slot) + w->length, len);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to spool to slot %d: %s", w->slot, esp_err_to_name(err));
+        w->failed = true;
+        return false;
+    }
+    w->length += len;
+    return true;
+}
+
+esp_err_t feed_spool_keep(const feed_spool_writer_t *w, feed_spool_header_t *header)
+{
+    if (w->failed || w->length == 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    header->magic = SPOOL_MAGIC;
+    header->length = w->length;
+    memset(header->reserved, 0, sizeof(header->reserved));
+    header->crc = header_crc(header);
+
+    esp_flash_t *chip = ext_flash_get();
+    esp_err_t err = esp_flash_erase_region(chip, header_offset(w->slot), EXT_FLASH_SECTOR_SIZE);
+    if (err == ESP_OK) {
+        err = esp_flash_write(chip, header, header_offset(w->slot), sizeof(*header));
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to write header of slot %d: %s", w->slot, esp_err_to_name(err));
+        return err;
+    }
+    ESP_LOGI(TAG, "Kept %" PRIu32 " of %" PRIu32 " bytes in slot %d", header->length, header->total, w->slot);
+    return ESP_OK;
+}
@@ -0,0 +1,92 @@
+#ifndef FEED_SPOOL_H
+#define FEED_SPOOL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "feed_validators.h"
+
+/*
+ * Spools feed bodies to the external flash while they download, so a
+ * transfer that breaks off is not lost. The bytes received are kept with the
+ * validator of the representation they belong to; the next sync asks the
+ * server for the rest with Range and If-Range and replays the kept bytes
+ * into the parser instead of downloading them again.
+ *
+ * Each feed has its own slot: a header sector, written only when a partial
+ * body is kept, followed by the body as it came off the wire, e.g. still
+ * gzip-coded. Sectors are erased just ahead of the writes.
+ */
+
+#define FEED_SPOOL_OFFSET       0x020000        // After the event cache
+#define FEED_SPOOL_SLOT_SIZE    (1024 * 1024)   // Bytes per feed, a multiple of the sector size
+#define FEED_SPOOL_SLOTS        6
+#define FEED_SPOOL_CAPACITY     (FEED_SPOOL_SLOT_SIZE - 4096) // Longest body that can be spooled
+
+/**
+ * @brief What a slot holds: the first length bytes of a body of total bytes.
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t url_hash;              // Feed the body belongs to
+    uint32_t length;                // Bytes kept
+    uint32_t total;                 // Length of the whole body
+    uint8_t gzip;                   // The body is gzip-coded
+    uint8_t reserved[3];
+    char validator[FEED_ETAG_MAX];  // Strong ETag or Last-Modified, sent back as If-Range
+    uint32_t crc;                   // CRC-32 of the fields above
+} feed_spool_header_t;
+
+/**
+ * @brief Appends a body to a slot.
+ */
+typedef struct {
+    int slot;
+    uint32_t length;                // Bytes written
+    uint32_t erased;                // Bytes of the data area erased so far
+    bool failed;                    // Out of room or a flash error; nothing more is written
+} feed_spool_writer_t;
+
+/**
+ * @brief Reads the header of a slot.
+ *
+ * @return true if the slot holds part of a body of the feed with this URL hash.
+ */
+bool feed_spool_find(int slot, uint32_t url_hash, feed_spool_header_t *header);
+
+/**
+ * @brief Reads kept bytes of a body.
+ */
+esp_err_t feed_spool_read(int slot, uint32_t offset, void *buf, size_t len);
+
+/**
+ * @brief Starts writing a body, or continues one after its first length bytes.
+ *
+ * Starting a new body drops whatever the slot held. A continued body keeps
+ * its header until feed_spool_keep() replaces it, so the bytes kept before
+ * stay usable if the device resets meanwhile.
+ */
+void feed_spool_open(feed_spool_writer_t *w, int slot, uint32_t length);
+
+/**
+ * @brief Appends bytes of the body.
+ *
+ * @return false once the slot is full or the flash failed.
+ */
+bool feed_spool_write(feed_spool_writer_t *w, const void *data, size_t len);
+
+/**
+ * @brief Keeps what was written for the next sync.
+ *
+ * @param header Feed, total, encoding and validator of the body; length and
+ *               the checksum are filled in.
+ */
+esp_err_t feed_spool_keep(const feed_spool_writer_t *w, feed_spool_header_t *header);
+
+/**
+ * @brief Drops the body kept in a slot.
+ */
+void feed_spool_discard(int slot);
+
+#endif // FEED_SPOOL_H
@@ -0,0 +1,97 @@
+#include "feed_validators.h"
+#include "ics_tokenizer.h"
+#include "nvs_flash.h"
+#include "esp_log.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+#define NVS_NAMESPACE   "feeds"
+
+static const char *TAG = "feed_validators";
+
+// NVS keys are at most 15 characters, so feeds are keyed by a hash of their URL
+static void url_key(const char *url, char *key, size_t len)
+{
+    snprintf(key, len, "v%08" PRIx32, ics_span_hash(url, strlen(url)));
+}
+
+esp_err_t feed_validators_load(const char *url, feed_validators_t *validators)
+{
+    memset(validators, 0, sizeof(*validators));
+
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs_handle);
+    if (err != ESP_OK) {
+        return err == ESP_ERR_NVS_NOT_INITIALIZED ? err : ESP_ERR_NVS_NOT_FOUND;
+    }
+
+    char key[16];
+    url_key(url, key, sizeof(key));
+    size_t len = sizeof(*validators);
+    err = nvs_get_blob(nvs_handle, key, validators, &len);
+    nvs_close(nvs_handle);
+
+    // A blob of another size was written by a different layout
+    if (err != ESP_OK || len != sizeof(*validators)) {
+        memset(validators, 0, sizeof(*validators));
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    validators->etag[FEED_ETAG_MAX - 1] = '\0';
+    validators->last_modified[FEED_LAST_MODIFIED_MAX - 1] = '\0';
+    validators->sync_token[FEED_SYNC_TOKEN_MAX - 1] = '\0';
+    return ESP_OK;
+}
+
+esp_err_t feed_validators_save(const char *url, const feed_validators_t *validators)
+{
+    feed_validators_t saved;
+    bool has_saved = feed_validators_load(url, &saved) == ESP_OK;
+    if (has_saved ? memcmp(&saved, validators, sizeof(saved)) == 0 : feed_validators_empty(validators)) {
+        return ESP_OK;
+    }
+
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error (%s) opening NVS handle!", esp_err_to_name(err));
+        return err;
+    }
+
+    char key[16];
+    url_key(url, key, sizeof(key));
+    if (feed_validators_empty(validators)) {
+        err = nvs_erase_key(nvs_handle, key);
+    } else {
+        err = nvs_set_blob(nvs_handle, key, validators, sizeof(*validators));
+    }
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs_handle);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error (%s) saving validators to NVS!", esp_err_to_name(err));
+    }
+    nvs_close(nvs_handle);
+    return err;
+}
+
+void feed_validators_capture(feed_validators_t *validators, const char *key, const char *value)
+{
+    if (strcasecmp(key, "ETag") == 0) {
+        if (strlen(value) < FEED_ETAG_MAX) {
+            strcpy(validators->etag, value);
+        }
+    } else if (strcasecmp(key, "Last-Modified") == 0) {
+        if (strlen(value) < FEED_LAST_MODIFIED_MAX) {
+            strcpy(validators->last_modified, value);
+        }
+    }
+}
+
+bool feed_validators_empty(const feed_validators_t *validators)
+{
+    return validators->etag[0] == '\0' && validators->last_modified[0] == '\0' &&
+           validators->sync_token[0] == '\0';
+}
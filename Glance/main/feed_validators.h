@@ -0,0 +1,53 @@
+#ifndef FEED_VALIDATORS_H
+#define FEED_VALIDATORS_H
+
+#include <stdbool.h>
+#include "esp_err.h"
+
+/*
+ * HTTP cache validators of a calendar feed, kept in NVS so they survive deep
+ * sleep and power loss. Sending them back with the next request lets the
+ * server answer 304 Not Modified instead of sending the whole feed again.
+ * For CalDAV calendars the collection's sync-token is kept instead, so the
+ * next sync only asks for what changed since.
+ */
+
+#define FEED_ETAG_MAX           128 // Including the quotes and the NUL
+#define FEED_LAST_MODIFIED_MAX  40  // An HTTP-date is 29 characters
+#define FEED_SYNC_TOKEN_MAX     192 // Tokens are URIs, usually well under 100 characters
+
+/**
+ * @brief Validators of one feed. Empty strings stand for absent values.
+ */
+typedef struct {
+    char etag[FEED_ETAG_MAX];
+    char last_modified[FEED_LAST_MODIFIED_MAX];
+    char sync_token[FEED_SYNC_TOKEN_MAX];       // CalDAV collection sync-token (RFC 6578)
+} feed_validators_t;
+
+/**
+ * @brief Loads the validators saved for a feed URL.
+ *
+ * @return ESP_ERR_NVS_NOT_FOUND if none are saved; validators are then empty.
+ */
+esp_err_t feed_validators_load(const char *url, feed_validators_t *validators);
+
+/**
+ * @brief Saves the validators of a feed URL, erasing them if all are empty.
+ *
+ * NVS is only written if they differ from the saved ones.
+ */
+esp_err_t feed_validators_save(const char *url, const feed_validators_t *validators);
+
+/**
+ * @brief Takes ETag and Last-Modified from a response header. Values too
+ * long to send back intact are ignored.
+ */
+void feed_validators_capture(feed_validators_t *validators, const char *key, const char *value);
+
+/**
+ * @brief true if no validator is set.
+ */
+bool feed_validators_empty(const feed_validators_t *validators);
+
+#endif // FEED_VALIDATORS_H
@@ -13,6 +13,7 @@
 
 static const char *TAG = "hardware";
 static i2c_master_bus_handle_t bus_handle;
+static bool display_hardware_ready = false;
 
 /**
  * @brief Initializes base hardware components: NVS, power, essential GPIOs, and the I2C bus.
@@ -69,6 +70,9 @@ void hardware_init(void)
  */
 void display_hardware_init(void)
 {
+    if (display_hardware_ready) {
+        return;
+    }
     ESP_LOGI(TAG, "Initializing display hardware...");
 
     // 1. Init EPD and Flash GPIOs
@@ -98,6 +102,7 @@ void display_hardware_init(void)
         ESP_LOGE(TAG, "Failed to initialize SPI bus: %s", esp_err_to_name(ret));
     } else {
         ESP_LOGI(TAG, "SPI bus initialized.");
+        display_hardware_ready = true;
     }
 }
 
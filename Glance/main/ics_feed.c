@@ -0,0 +1,560 @@
+#include "ics_feed.h"
+#include "civil_time.h"
+#include "tz_posix.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+// Everything else (VTODO, VALARM, ATTACH, ORGANIZER, ...) is skipped unread
+static const char *const ics_components[] = {
+    "VCALENDAR", "VEVENT", "VTIMEZONE", "STANDARD", "DAYLIGHT", NULL
+};
+static const char *const ics_properties[] = {
+    "SUMMARY", "LOCATION", "DESCRIPTION", "DTSTART", "RRULE", "UID", "EXDATE", "RECURRENCE-ID", "STATUS",
+    "TZID", "TZOFFSETFROM", "TZOFFSETTO", "RDATE", "DTEND", "DURATION", "SEQUENCE", "LAST-MODIFIED", NULL
+};
+static const ics_filter_t ics_filter = {
+    .components = ics_components,
+    .properties = ics_properties,
+};
+// Properties that change how an event is shown; the rest are left out of its content hash
+static const char *const event_hash_properties[] = {
+    "UID", "SEQUENCE", "LAST-MODIFIED", "DTSTART", "DTEND", "DURATION", "SUMMARY", "LOCATION", "DESCRIPTION", NULL
+};
+
+static const ics_tz_zone_t utc_zone = {0};
+
+_Static_assert(ICS_FEED_KNOWN_ZONES > 2, "DTSTART and DTEND may each hold a known zone");
+
+static int64_t local_seconds(const ics_feed_parser_t *p, int64_t utc)
+{
+    return utc + ics_tz_offset_at(p->window->local, utc);
+}
+
+// Quotes a value in the statistics, e.g. "DTSTART:2025-10-01"
+static void note(char *buf, const char *name, size_t name_len, const char *value, size_t value_len)
+{
+    if (name_len > 0) {
+        snprintf(buf, ICS_FEED_NOTE_MAX, "%.*s:%.*s", (int)name_len, name, (int)value_len, value);
+    } else {
+        snprintf(buf, ICS_FEED_NOTE_MAX, "%.*s", (int)value_len, value);
+    }
+}
+
+static void invalid_value(ics_feed_parser_t *p, const ics_property_t *prop, const char *value, size_t len)
+{
+    if (p->stats.invalid_values++ == 0) {
+        note(p->stats.first_invalid, prop->name, prop->name_len, value, len);
+    }
+}
+
+// A zone the VEVENT being read still refers to
+static bool zone_in_use(const ics_feed_parser_t *p, const ics_tz_zone_t *zone)
+{
+    return p->in_vevent && (p->vevent_time.zone == zone || p->vevent_time.dtend_zone == zone);
+}
+
+// Zone of a TZID without a VTIMEZONE, such as "Asia/Taipei" or Exchange's "Taipei Standard Time"
+static const ics_tz_zone_t *known_zone(ics_feed_parser_t *p, uint32_t tzid_hash)
+{
+    const ics_tz_zone_t *found = ics_tz_find(p->known_zones, p->known_zone_count, tzid_hash);
+    int slot = found != NULL ? (int)(found - p->known_zones) : p->known_zone_count;
+    if (found == NULL) {
+        const char *posix = tz_posix_lookup_hash(tzid_hash);
+        if (posix == NULL) {
+            return NULL;
+        }
+        // Events resolve their times to UTC at END:VEVENT, so only the current one can hold a zone
+        if (slot == ICS_FEED_KNOWN_ZONES) {
+            slot = -1;
+            for (int i = 0; i < ICS_FEED_KNOWN_ZONES; i++) {
+                if (!zone_in_use(p, &p->known_zones[i]) &&
+                    (slot < 0 || p->known_zone_used[i] < p->known_zone_used[slot])) {
+                    slot = i;
+                }
+            }
+            p->stats.known_zones_evicted++;
+        }
+        ics_tz_zone_t *zone = &p->known_zones[slot];
+        if (!ics_tz_compile_posix(zone, posix, p->window->first_year, p->window->last_year)) {
+            zone->tzid_hash = 0;
+            return NULL;
+        }
+        zone->tzid_hash = tzid_hash;
+        if (slot == p->known_zone_count) {
+            p->known_zone_count++;
+        }
+    }
+    p->known_zone_used[slot] = ++p->known_zone_clock;
+    return &p->known_zones[slot];
+}
+
+// Zone a DATE or DATE-TIME value is expressed in; floating times and dates use the device zone
+static const ics_tz_zone_t *value_zone(ics_feed_parser_t *p, const ics_property_t *prop, bool is_utc, bool is_date)
+{
+    const ics_tz_zone_t *zone = NULL;
+    const char *tzid;
+    size_t tzid_len;
+    if (is_utc) {
+        zone = &utc_zone;
+    } else if (!is_date && ics_param_get(prop, "TZID", &tzid, &tzid_len)) {
+        uint32_t tzid_hash = ics_tz_hash(tzid, tzid_len);
+        zone = ics_tz_find(p->tz_zones, p->tz_zone_count, tzid_hash);
+        if (zone == NULL) {
+            zone = known_zone(p, tzid_hash);
+        }
+        if (zone == NULL && p->stats.unknown_tzids++ == 0) {
+            note(p->stats.first_unknown_tzid, NULL, 0, tzid, tzid_len);
+        }
+    }
+    return zone ? zone : p->window->local;
+}
+
+// Parses a single DATE or DATE-TIME value to UTC
+static bool parse_utc(ics_feed_parser_t *p, const ics_property_t *prop, const char *value, size_t len, int64_t *utc)
+{
+    int64_t seconds;
+    bool is_utc, is_date;
+    if (!ics_tz_parse_datetime(value, len, &seconds, &is_utc, &is_date)) {
+        return false;
+    }
+    *utc = ics_tz_local_to_utc(value_zone(p, prop, is_utc, is_date), seconds);
+    return true;
+}
+
+// Exceptions outside the window can never match an occurrence that is kept
+static bool near_window(const ics_feed_parser_t *p, int64_t utc)
+{
+    return utc >= p->window->now - CIVIL_SECS_PER_DAY && utc < p->window->end + CIVIL_SECS_PER_DAY;
+}
+
+static void exclude_occurrence(ics_feed_parser_t *p, int64_t utc)
+{
+    ics_occurrence_t *e = ics_occurrence_insert(&p->occurrence_index, p->vevent_time.uid_hash, utc);
+    if (e != NULL) {
+        e->flags |= ICS_OCCURRENCE_EXCLUDED;
+    }
+}
+
+static void handle_dtstart(ics_feed_parser_t *p, const ics_property_t *prop)
+{
+    int64_t seconds;
+    bool is_utc, is_date;
+    if (!ics_tz_parse_datetime(prop->value, prop->value_len, &seconds, &is_utc, &is_date)) {
+        invalid_value(p, prop, prop->value, prop->value_len);
+        p->vevent_time.has_dtstart = false;
+        return;
+    }
+
+    // Local time in the TZID zone
+    p->vevent_time.zone = value_zone(p, prop, is_utc, is_date);
+    p->vevent_time.dtstart = seconds;
+    p->vevent_time.has_dtstart = true;
+    p->current_event.all_day = is_date;
+}
+
+static void handle_dtend(ics_feed_parser_t *p, const ics_property_t *prop)
+{
+    int64_t seconds;
+    bool is_utc, is_date;
+    if (!ics_tz_parse_datetime(prop->value, prop->value_len, &seconds, &is_utc, &is_date)) {
+        invalid_value(p, prop, prop->value, prop->value_len);
+        return;
+    }
+    p->vevent_time.dtend_zone = value_zone(p, prop, is_utc, is_date);
+    p->vevent_time.dtend = seconds;
+    p->vevent_time.dtend_is_date = is_date;
+    p->vevent_time.has_dtend = true;
+}
+
+static void handle_duration(ics_feed_parser_t *p, const ics_property_t *prop)
+{
+    p->vevent_time.has_duration = ics_tz_parse_duration(prop->value, prop->value_len, &p->vevent_time.duration_days,
+                                                        &p->vevent_time.duration_seconds);
+    if (!p->vevent_time.has_duration) {
+        invalid_value(p, prop, prop->value, prop->value_len);
+    }
+}
+
+/*
+ * Turns DTEND or DURATION into the length of each occurrence (RFC 5545
+ * 3.6.1): without either, a timed event has none and an all-day event lasts
+ * its day. Days are nominal, so an occurrence that spans a DST change still
+ * ends at the same wall-clock time; a timed DTEND gives an exact length.
+ */
+static void resolve_duration(ics_feed_parser_t *p)
+{
+    int32_t days = 0;
+    int64_t seconds = 0;
+    if (p->vevent_time.has_duration) {
+        days = p->vevent_time.duration_days;
+        seconds = p->vevent_time.duration_seconds;
+    } else if (p->vevent_time.has_dtend && p->current_event.all_day) {
+        days = (int32_t)(civil_days_from_seconds(p->vevent_time.dtend) -
+                         civil_days_from_seconds(p->vevent_time.dtstart));
+    } else if (p->vevent_time.has_dtend) {
+        seconds = ics_tz_local_to_utc(p->vevent_time.dtend_zone, p->vevent_time.dtend) -
+                  ics_tz_local_to_utc(p->vevent_time.zone, p->vevent_time.dtstart);
+    } else if (p->current_event.all_day) {
+        days = 1;
+    }
+    if (days < 0 || seconds < 0 || seconds > INT32_MAX) {
+        p->stats.ends_before_start++;
+        days = p->current_event.all_day ? 1 : 0;
+        seconds = 0;
+    }
+    p->vevent_time.duration_days = days;
+    p->vevent_time.duration_seconds = (int32_t)seconds;
+}
+
+static time_t occurrence_end(const ics_feed_parser_t *p, time_t start)
+{
+    const ics_tz_zone_t *zone = p->vevent_time.zone;
+    int64_t end = start;
+    if (p->vevent_time.duration_days != 0) {
+        int64_t local = start + ics_tz_offset_at(zone, start);
+        end = ics_tz_local_to_utc(zone, local + (int64_t)p->vevent_time.duration_days * CIVIL_SECS_PER_DAY);
+    }
+    return (time_t)(end + p->vevent_time.duration_seconds);
+}
+
+static void handle_uid(ics_feed_parser_t *p, const ics_property_t *prop)
+{
+    p->vevent_time.uid_hash = ics_span_hash(prop->value, prop->value_len);
+    p->vevent_time.has_uid = true;
+
+    for (int i = 0; i < p->vevent_time.pending_exdate_count; i++) {
+        exclude_occurrence(p, p->vevent_time.pending_exdates[i]);
+    }
+    p->vevent_time.pending_exdate_count = 0;
+}
+
+static void handle_exdate(ics_feed_parser_t *p, const ics_property_t *prop)
+{
+    // EXDATE may list several comma-separated values
+    const char *s = prop->value;
+    const char *end = prop->value + prop->value_len;
+    while (s < end) {
+        const char *comma = memchr(s, ',', (size_t)(end - s));
+        const char *item_end = comma ? comma : end;
+        int64_t utc;
+        if (!parse_utc(p, prop, s, (size_t)(item_end - s), &utc)) {
+            invalid_value(p, prop, s, (size_t)(item_end - s));
+        } else if (!near_window(p, utc)) {
+            // Cannot affect anything shown
+        } else if (p->vevent_time.has_uid) {
+            exclude_occurrence(p, utc);
+        } else if (p->vevent_time.pending_exdate_count < ICS_FEED_PENDING_EXDATES) {
+            p->vevent_time.pending_exdates[p->vevent_time.pending_exdate_count++] = utc;
+        } else {
+            p->stats.exdates_dropped++;
+        }
+        s = item_end + 1;
+    }
+}
+
+static void handle_recurrence_id(ics_feed_parser_t *p, const ics_property_t *prop)
+{
+    p->vevent_time.has_recurrence_id = parse_utc(p, prop, prop->value, prop->value_len, &p->vevent_time.recurrence_id);
+    if (!p->vevent_time.has_recurrence_id) {
+        invalid_value(p, prop, prop->value, prop->value_len);
+    }
+}
+
+static void handle_rrule(ics_feed_parser_t *p, const ics_property_t *prop)
+{
+    p->vevent_time.has_rrule = ics_rrule_parse(prop->value, prop->value_len, &p->vevent_time.rrule);
+    if (p->vevent_time.has_rrule && p->vevent_time.rrule.unsupported) {
+        p->stats.unsupported_rrules++; // Only the first occurrence is kept
+        p->vevent_time.has_rrule = false;
+    }
+}
+
+static void hash_property(ics_feed_parser_t *p, const ics_property_t *prop)
+{
+    for (const char *const *name = event_hash_properties; *name != NULL; name++) {
+        if (ics_span_equals(prop->name, prop->name_len, *name)) {
+            uint64_t h = ics_span_hash64(ICS_SPAN_HASH64_INIT, prop->name, prop->name_len);
+            h = ics_span_hash64(h, ";", 1);
+            h = ics_span_hash64(h, prop->params, prop->params_len);
+            h = ics_span_hash64(h, ":", 1);
+            p->vevent_time.content_hash += ics_span_hash64(h, prop->value, prop->value_len);
+            return;
+        }
+    }
+}
+
+// Drops the text of evicted and removed events, moving the rest down
+static void compact_text(ics_feed_parser_t *p)
+{
+    ics_feed_t *feed = p->feed;
+    size_t n = 0;
+    for (int slot = 0; slot < EVENT_STORE_CAPACITY; slot++) {
+        if (event_heap_holds(&feed->heap, slot)) {
+            p->compact_refs[n++] = &feed->pool[slot].summary;
+            p->compact_refs[n++] = &feed->pool[slot].location;
+            p->compact_refs[n++] = &feed->pool[slot].description;
+        }
+    }
+    p->compact_refs[n++] = &p->current_event.summary;
+    p->compact_refs[n++] = &p->current_event.location;
+    p->compact_refs[n++] = &p->current_event.description;
+    text_arena_compact(&feed->text, p->compact_refs, n, feed->text_floor, &p->vevent_text_mark);
+    feed->text_garbage = false;
+}
+
+static text_ref_t store_text(ics_feed_parser_t *p, const ics_property_t *prop, size_t max_len)
+{
+    const char *start = prop->value;
+    const char *end = prop->value + prop->value_len;
+
+    // Trim surrounding whitespace
+    while (start < end && isspace((unsigned char)*start)) start++;
+    while (end > start && isspace((unsigned char)end[-1])) end--;
+
+    // Truncated lines and long values are cut at a character boundary
+    size_t len = text_utf8_prefix(start, (size_t)(end - start), max_len);
+    const text_arena_t *text = &p->feed->text;
+    if (text->top + len + 1 > text->cap && p->feed->text_garbage) {
+        compact_text(p);
+    }
+    return text_arena_intern(&p->feed->text, start, len);
+}
+
+static void add_occurrence(ics_feed_parser_t *p, time_t start)
+{
+    const ics_feed_window_t *w = p->window;
+
+    // All-day events stay upcoming for the whole local day they fall on
+    bool upcoming = p->current_event.all_day
+        ? civil_days_from_seconds(local_seconds(p, start)) >= civil_days_from_seconds(local_seconds(p, w->now))
+        : start > w->now;
+
+    if (!upcoming || start >= w->end) {
+        return;
+    }
+    p->stats.occurrences++;
+    p->current_event.start_time = start;
+    p->current_event.end_time = occurrence_end(p, start);
+    if (ics_feed_keep(p->feed, &p->current_event, p->vevent_time.uid_hash) != EVENT_HEAP_NO_SLOT) {
+        p->vevent_time.kept++;
+    }
+}
+
+// Adds an occurrence of a recurring event unless an exception already claimed it
+static void add_recurring_occurrence(ics_feed_parser_t *p, time_t start)
+{
+    if (p->vevent_time.has_uid) {
+        ics_occurrence_t *e = ics_occurrence_find(&p->occurrence_index, p->vevent_time.uid_hash, start);
+        if (e != NULL && e->flags != 0) {
+            return; // Excluded or overridden
+        }
+    }
+    add_occurrence(p, start);
+}
+
+// A RECURRENCE-ID instance replaces one occurrence of its master, which may come before or after it
+static void apply_override(ics_feed_parser_t *p)
+{
+    ics_feed_t *feed = p->feed;
+    int64_t original = p->vevent_time.recurrence_id;
+    if (near_window(p, original)) {
+        // A full index is counted in its statistics; a master that comes later may then show the original
+        ics_occurrence_t *e = ics_occurrence_insert(&p->occurrence_index, p->vevent_time.uid_hash, original);
+        if (e != NULL) {
+            e->flags |= ICS_OCCURRENCE_OVERRIDDEN;
+        }
+
+        // A master that came first may hold the original in the heap; the pool identifies it
+        for (int slot = 0; slot < EVENT_STORE_CAPACITY; slot++) {
+            if (event_heap_holds(&feed->heap, slot) && feed->pool[slot].start_time == original &&
+                feed->pool_uid[slot] == p->vevent_time.uid_hash) {
+                event_heap_remove(&feed->heap, slot);
+                feed->text_garbage = true;
+                break;
+            }
+        }
+    }
+    if (!p->vevent_time.cancelled && p->vevent_time.has_dtstart) {
+        resolve_duration(p);
+        add_occurrence(p, (time_t)ics_tz_local_to_utc(p->vevent_time.zone, p->vevent_time.dtstart));
+    }
+}
+
+static void handle_end_vevent(ics_feed_parser_t *p)
+{
+    if (p->vevent_time.has_recurrence_id && p->vevent_time.has_uid) {
+        apply_override(p);
+        return;
+    }
+    if (!p->vevent_time.has_dtstart || p->vevent_time.cancelled) {
+        return;
+    }
+    resolve_duration(p);
+    const ics_tz_zone_t *zone = p->vevent_time.zone;
+    if (!p->vevent_time.has_rrule) {
+        add_occurrence(p, (time_t)ics_tz_local_to_utc(zone, p->vevent_time.dtstart));
+        return;
+    }
+
+    // Expand in the event's own wall-clock time, only across the window.
+    // A day of slack on each side covers offset differences between zones.
+    ics_rrule_t *rule = &p->vevent_time.rrule;
+    if (rule->until_utc && rule->until != INT64_MAX) {
+        rule->until += ics_tz_offset_at(zone, rule->until);
+    }
+    int64_t from = p->window->now + ics_tz_offset_at(zone, p->window->now) - CIVIL_SECS_PER_DAY;
+    int64_t to = p->window->end + ics_tz_offset_at(zone, p->window->end) + CIVIL_SECS_PER_DAY;
+
+    ics_rrule_iter_t it;
+    int64_t occurrence;
+    ics_rrule_iter_init(&it, rule, p->vevent_time.dtstart, from, to);
+    while (ics_rrule_iter_next(&it, &occurrence)) {
+        add_recurring_occurrence(p, (time_t)ics_tz_local_to_utc(zone, occurrence));
+    }
+}
+
+static bool on_ics_property(const ics_property_t *prop, void *ctx)
+{
+    ics_feed_parser_t *p = ctx;
+    if (p->in_vtimezone) {
+        ics_tz_builder_property(&p->tz_builder, prop);
+        if (ics_span_equals(prop->name, prop->name_len, "END") &&
+            ics_span_equals(prop->value, prop->value_len, "VTIMEZONE")) {
+            ics_tz_builder_end(&p->tz_builder);
+            ics_tz_zone_t *zone = &p->tz_zones[p->tz_zone_count];
+            if (zone->overflow) {
+                p->stats.zones_truncated++; // Later transitions are dropped
+            }
+            // CalDAV repeats the zone in every resource that uses it
+            if (ics_tz_find(p->tz_zones, p->tz_zone_count, zone->tzid_hash) == NULL) {
+                p->tz_zone_count++;
+            }
+            p->in_vtimezone = false;
+        }
+        return true;
+    }
+
+    if (ics_span_equals(prop->name, prop->name_len, "BEGIN")) {
+        if (ics_span_equals(prop->value, prop->value_len, "VTIMEZONE")) {
+            if (p->tz_zone_count < ICS_TZ_MAX_ZONES) {
+                ics_tz_builder_begin(&p->tz_builder, &p->tz_zones[p->tz_zone_count],
+                                     p->window->first_year, p->window->last_year);
+                p->in_vtimezone = true;
+            } else {
+                p->stats.zones_dropped++;
+            }
+        } else if (ics_span_equals(prop->value, prop->value_len, "VEVENT")) {
+            p->in_vevent = true;
+            memset(&p->current_event, 0, sizeof(p->current_event));
+            p->current_event.href = p->href;
+            p->vevent_text_mark = text_arena_mark(&p->feed->text);
+            memset(&p->vevent_time, 0, sizeof(p->vevent_time));
+        }
+    } else if (ics_span_equals(prop->name, prop->name_len, "END")) {
+        if (p->in_vevent && ics_span_equals(prop->value, prop->value_len, "VEVENT")) {
+            p->stats.vevents++;
+            p->current_event.hash = p->vevent_time.content_hash;
+            handle_end_vevent(p);
+            if (p->vevent_time.kept == 0) {
+                text_arena_release(&p->feed->text, p->vevent_text_mark);
+            }
+            p->in_vevent = false;
+        }
+    } else if (p->in_vevent) {
+        hash_property(p, prop);
+        if (ics_span_equals(prop->name, prop->name_len, "SUMMARY")) {
+            p->current_event.summary = store_text(p, prop, MAX_SUMMARY_LEN);
+        } else if (ics_span_equals(prop->name, prop->name_len, "LOCATION")) {
+            p->current_event.location = store_text(p, prop, MAX_SUMMARY_LEN);
+        } else if (ics_span_equals(prop->name, prop->name_len, "DESCRIPTION")) {
+            p->current_event.description = store_text(p, prop, MAX_DESCRIPTION_LEN);
+        } else if (ics_span_equals(prop->name, prop->name_len, "DTSTART")) {
+            handle_dtstart(p, prop);
+        } else if (ics_span_equals(prop->name, prop->name_len, "DTEND")) {
+            handle_dtend(p, prop);
+        } else if (ics_span_equals(prop->name, prop->name_len, "DURATION")) {
+            handle_duration(p, prop);
+        } else if (ics_span_equals(prop->name, prop->name_len, "RRULE")) {
+            handle_rrule(p, prop);
+        } else if (ics_span_equals(prop->name, prop->name_len, "UID")) {
+            handle_uid(p, prop);
+        } else if (ics_span_equals(prop->name, prop->name_len, "EXDATE")) {
+            handle_exdate(p, prop);
+        } else if (ics_span_equals(prop->name, prop->name_len, "RECURRENCE-ID")) {
+            handle_recurrence_id(p, prop);
+        } else if (ics_span_equals(prop->name, prop->name_len, "STATUS")) {
+            p->vevent_time.cancelled = ics_span_equals(prop->value, prop->value_len, "CANCELLED");
+        }
+    }
+    return true;
+}
+
+void ics_feed_init(ics_feed_t *feed, char *text_buf, size_t text_cap, text_intern_t *intern, uint32_t intern_slots)
+{
+    memset(feed, 0, sizeof(*feed));
+    text_arena_init(&feed->text, text_buf, text_cap, intern, intern_slots);
+    ics_feed_reset(feed);
+}
+
+void ics_feed_reset(ics_feed_t *feed)
+{
+    text_arena_reset(&feed->text);
+    feed->text_floor = text_arena_mark(&feed->text);
+    feed->text_garbage = false;
+    event_heap_init(&feed->heap, feed->keys, feed->heap_slots, feed->heap_pos, EVENT_STORE_CAPACITY);
+}
+
+void ics_feed_pin_text(ics_feed_t *feed)
+{
+    feed->text_floor = text_arena_mark(&feed->text);
+}
+
+int ics_feed_keep(ics_feed_t *feed, const ics_feed_event_t *event, uint32_t uid)
+{
+    uint32_t evicted = feed->heap.evicted;
+    int slot = event_heap_offer(&feed->heap, event->start_time);
+    if (feed->heap.evicted != evicted) {
+        feed->text_garbage = true;
+    }
+    if (slot != EVENT_HEAP_NO_SLOT) {
+        feed->pool[slot] = *event;
+        feed->pool_uid[slot] = uid;
+    }
+    return slot;
+}
+
+int ics_feed_drain(ics_feed_t *feed, int16_t *order)
+{
+    return event_heap_drain(&feed->heap, order);
+}
+
+void ics_feed_parser_begin(ics_feed_parser_t *p, ics_feed_t *feed, const ics_feed_window_t *window,
+                           ics_occurrence_t *occurrences, uint32_t occurrence_capacity)
+{
+    p->feed = feed;
+    p->window = window;
+    p->href = 0;
+    ics_feed_reset(feed);
+
+    p->in_vevent = false;
+    p->in_vtimezone = false;
+    p->tz_zone_count = 0;
+    p->known_zone_count = 0;
+    p->known_zone_clock = 0;
+    memset(&p->stats, 0, sizeof(p->stats));
+    ics_occurrence_index_init(&p->occurrence_index, occurrences, occurrence_capacity);
+    ics_tokenizer_init(&p->tokenizer, p->line_spill, sizeof(p->line_spill), on_ics_property, p);
+    ics_tokenizer_set_filter(&p->tokenizer, &ics_filter);
+}
+
+bool ics_feed_parser_feed(ics_feed_parser_t *p, const char *data, size_t len)
+{
+    return ics_tokenizer_feed(&p->tokenizer, data, len);
+}
+
+void ics_feed_parser_finish(ics_feed_parser_t *p)
+{
+    ics_tokenizer_finish(&p->tokenizer);
+}
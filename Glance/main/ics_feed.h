@@ -0,0 +1,232 @@
+#ifndef ICS_FEED_H
+#define ICS_FEED_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+#include "event_heap.h"
+#include "event_store.h"
+#include "ics_occurrence.h"
+#include "ics_rrule.h"
+#include "ics_tokenizer.h"
+#include "ics_tz.h"
+#include "text_arena.h"
+
+/*
+ * Events of an ICS feed, read as it streams: everything a calendar sync does
+ * with the bytes of a feed once they have arrived.
+ *
+ * The tokenizer is set up with a filter for the properties used. VTIMEZONEs
+ * are compiled as they arrive; a TZID the feed does not define is looked up
+ * by its IANA or Windows name in tz_posix.h. At END:VEVENT the event's start,
+ * end and recurrences are resolved across the window, EXDATE and
+ * RECURRENCE-ID are applied through an occurrence index, and each occurrence
+ * is offered to a heap of the EVENT_STORE_CAPACITY earliest. Text goes to
+ * the feed's arena; an event none of whose occurrences was kept takes its
+ * text back out. Text of events pushed out of the heap by earlier ones is
+ * squeezed out when the arena runs full.
+ *
+ * This module depends on the C standard library only, so the host benchmark
+ * and fuzz target in playground/host_bench run exactly what the device runs.
+ * Problems with a feed are counted in the statistics rather than logged.
+ */
+
+#define ICS_FEED_LINE_MAX       1024 // Spill buffer for lines split across chunks or folded
+#define ICS_FEED_PENDING_EXDATES 8   // EXDATEs held until the event's UID is known
+#define ICS_FEED_KNOWN_ZONES    ICS_TZ_MAX_ZONES // Zones compiled from tz_posix.h at a time
+#define ICS_FEED_NOTE_MAX       48   // Bytes kept of a value quoted in the statistics
+
+#define MAX_SUMMARY_LEN         256  // Bytes kept of a summary or location, cut at a character boundary
+#define MAX_DESCRIPTION_LEN     512  // Bytes kept of a description
+
+/**
+ * @brief An event kept from a feed, one per occurrence.
+ */
+typedef struct {
+    time_t start_time;              // UTC
+    time_t end_time;                // UTC, exclusive
+    bool all_day;                   // DTSTART was a DATE; start_time is local midnight
+    text_ref_t summary;
+    text_ref_t location;
+    text_ref_t description;
+    uint64_t hash;                  // Content hash of the VEVENT
+    uint32_t href;                  // Hash of the CalDAV resource, or of the ICS feed's URL
+} ics_feed_event_t;
+
+/**
+ * @brief Window and zones of a sync, shared by all its feeds.
+ */
+typedef struct {
+    int64_t now;                    // Events are kept if they start in [now, end)
+    int64_t end;
+    const ics_tz_zone_t *local;     // Device zone, for floating times and dates
+    int first_year;                 // Years that zones are compiled for
+    int last_year;
+} ics_feed_window_t;
+
+/**
+ * @brief The earliest events of one feed and their text.
+ *
+ * Events are held in heap slots until drained. Treat as opaque apart from
+ * pool, pool_uid and the statistics of heap and text.
+ */
+typedef struct {
+    ics_feed_event_t pool[EVENT_STORE_CAPACITY];
+    uint32_t pool_uid[EVENT_STORE_CAPACITY];    // UID hash of the event in each slot
+    int64_t keys[EVENT_STORE_CAPACITY];
+    int16_t heap_slots[EVENT_STORE_CAPACITY];
+    int16_t heap_pos[EVENT_STORE_CAPACITY];
+    event_heap_t heap;
+    text_arena_t text;
+    size_t text_floor;              // Text below this is kept in place, e.g. saved events
+    bool text_garbage;              // Events were evicted or removed since the text was last compacted
+} ics_feed_t;
+
+/**
+ * @brief What went wrong in a feed, for the log.
+ */
+typedef struct {
+    uint32_t vevents;
+    uint32_t occurrences;           // Occurrences in the window offered to the heap
+    uint32_t invalid_values;        // DTSTART, DTEND, DURATION, EXDATE or RECURRENCE-ID values that did not parse
+    char first_invalid[ICS_FEED_NOTE_MAX]; // e.g. "DTSTART:2025-10-01"
+    uint32_t unknown_tzids;         // Times in an undefined, unknown zone, read as device time
+    char first_unknown_tzid[ICS_FEED_NOTE_MAX];
+    uint32_t unsupported_rrules;    // Events shown at their first occurrence only
+    uint32_t ends_before_start;     // Events whose end was ignored
+    uint32_t exdates_dropped;       // EXDATEs before UID beyond ICS_FEED_PENDING_EXDATES
+    uint32_t zones_dropped;         // VTIMEZONEs beyond ICS_TZ_MAX_ZONES
+    uint32_t zones_truncated;       // VTIMEZONEs with more transitions than fit
+    uint32_t known_zones_evicted;   // Zones from tz_posix.h dropped for another, to be compiled again if named
+} ics_feed_stats_t;
+
+/**
+ * @brief Parser state. Treat as opaque apart from href, the statistics and
+ * those of the tokenizer and occurrence index.
+ */
+typedef struct {
+    ics_feed_t *feed;
+    const ics_feed_window_t *window;
+    uint32_t href;                  // Stored with the events read next
+
+    ics_tokenizer_t tokenizer;
+    char line_spill[ICS_FEED_LINE_MAX];
+
+    bool in_vevent;
+    ics_feed_event_t current_event;
+    size_t vevent_text_mark;
+
+    // Start, end and recurrence of the VEVENT being parsed, resolved at END:VEVENT
+    struct {
+        int64_t dtstart;            // Local time in zone
+        bool has_dtstart;
+        const ics_tz_zone_t *zone;
+        int64_t dtend;              // Local time in dtend_zone
+        const ics_tz_zone_t *dtend_zone;
+        bool has_dtend;
+        bool dtend_is_date;
+        int32_t duration_days;      // DURATION, or the length of each occurrence once resolved
+        int32_t duration_seconds;
+        bool has_duration;
+        bool has_rrule;
+        ics_rrule_t rrule;
+        uint32_t uid_hash;
+        bool has_uid;
+        int64_t recurrence_id;      // UTC start of the occurrence this instance replaces
+        bool has_recurrence_id;
+        bool cancelled;
+        int64_t pending_exdates[ICS_FEED_PENDING_EXDATES]; // UTC, seen before UID
+        int pending_exdate_count;
+        int kept;                   // Occurrences added to the heap
+        uint64_t content_hash;      // Sum of the property hashes, independent of their order
+    } vevent_time;
+
+    // EXDATEs and RECURRENCE-IDs near the window, keyed by UID and start
+    ics_occurrence_index_t occurrence_index;
+
+    // Zones defined by the feed
+    ics_tz_zone_t tz_zones[ICS_TZ_MAX_ZONES];
+    int tz_zone_count;
+    ics_tz_builder_t tz_builder;
+    bool in_vtimezone;
+
+    // Zones named by IANA or Windows TZIDs that the feed does not define, least recently used replaced
+    ics_tz_zone_t known_zones[ICS_FEED_KNOWN_ZONES];
+    uint32_t known_zone_used[ICS_FEED_KNOWN_ZONES];
+    uint32_t known_zone_clock;
+    int known_zone_count;
+
+    // Text of the held events and of the VEVENT being read, gathered for compaction
+    text_ref_t *compact_refs[EVENT_STORE_CAPACITY * 3 + 3];
+
+    ics_feed_stats_t stats;
+} ics_feed_parser_t;
+
+/**
+ * @brief Initializes a feed over caller-provided text storage.
+ *
+ * @param feed          Feed to initialize.
+ * @param text_buf      Buffer for the text of the events, e.g. in PSRAM.
+ * @param text_cap      Size of text_buf in bytes.
+ * @param intern        Intern table storage for the text.
+ * @param intern_slots  Number of entries in intern.
+ */
+void ics_feed_init(ics_feed_t *feed, char *text_buf, size_t text_cap, text_intern_t *intern, uint32_t intern_slots);
+
+/**
+ * @brief Drops all events and their text.
+ */
+void ics_feed_reset(ics_feed_t *feed);
+
+/**
+ * @brief Keeps the text stored so far where it is, e.g. saved events loaded
+ * into the arena after ics_feed_parser_begin(), whose references are held
+ * outside the feed.
+ */
+void ics_feed_pin_text(ics_feed_t *feed);
+
+/**
+ * @brief Offers an event whose text is already in the feed's arena, e.g.
+ * one saved by an earlier sync.
+ *
+ * @return The slot it was kept in, or EVENT_HEAP_NO_SLOT if it is not among
+ *         the earliest.
+ */
+int ics_feed_keep(ics_feed_t *feed, const ics_feed_event_t *event, uint32_t uid);
+
+/**
+ * @brief Empties the heap, listing the slots of the kept events by start.
+ *
+ * The events stay in pool until the feed is reset.
+ *
+ * @param[out] order Array of EVENT_STORE_CAPACITY entries.
+ * @return The number of events.
+ */
+int ics_feed_drain(ics_feed_t *feed, int16_t *order);
+
+/**
+ * @brief Starts reading a feed into an emptied feed.
+ *
+ * @param p                   Parser to set up.
+ * @param feed                Where the events go; reset here.
+ * @param window              Window of the sync, kept by reference.
+ * @param occurrences         Storage for the occurrence index.
+ * @param occurrence_capacity Entries in occurrences; only the largest power of two that fits is used.
+ */
+void ics_feed_parser_begin(ics_feed_parser_t *p, ics_feed_t *feed, const ics_feed_window_t *window,
+                           ics_occurrence_t *occurrences, uint32_t occurrence_capacity);
+
+/**
+ * @brief Processes the next chunk of the feed, of any size.
+ *
+ * @return false if tokenizing was aborted.
+ */
+bool ics_feed_parser_feed(ics_feed_parser_t *p, const char *data, size_t len);
+
+/**
+ * @brief Ends the feed, processing a last line without a line break.
+ */
+void ics_feed_parser_finish(ics_feed_parser_t *p);
+
+#endif // ICS_FEED_H
@@ -0,0 +1,63 @@
+#include "ics_occurrence.h"
+#include <string.h>
+
+static uint32_t key_hash(uint32_t uid_hash, int64_t start)
+{
+    // Occurrences of one series differ only in start; mix it so they spread
+    uint64_t x = ((uint64_t)uid_hash << 32) ^ (uint64_t)start;
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdull;
+    x ^= x >> 33;
+    return (uint32_t)x;
+}
+
+void ics_occurrence_index_init(ics_occurrence_index_t *index, ics_occurrence_t *storage, uint32_t capacity)
+{
+    uint32_t size = 1;
+    while (size <= capacity / 2) {
+        size <<= 1;
+    }
+    memset(storage, 0, size * sizeof(*storage));
+    index->entries = storage;
+    index->mask = size - 1;
+    index->count = 0;
+    index->limit = size - size / 4;     // Keep probes short
+    index->dropped = 0;
+}
+
+// Returns the entry for the key, or the empty entry where it would go
+static ics_occurrence_t *probe(ics_occurrence_index_t *index, uint32_t uid_hash, int64_t start)
+{
+    uint32_t i = key_hash(uid_hash, start) & index->mask;
+    for (;;) {
+        ics_occurrence_t *e = &index->entries[i];
+        if (!e->used || (e->uid_hash == uid_hash && e->start == start)) {
+            return e;
+        }
+        i = (i + 1) & index->mask;
+    }
+}
+
+ics_occurrence_t *ics_occurrence_find(ics_occurrence_index_t *index, uint32_t uid_hash, int64_t start)
+{
+    ics_occurrence_t *e = probe(index, uid_hash, start);
+    return e->used ? e : NULL;
+}
+
+ics_occurrence_t *ics_occurrence_insert(ics_occurrence_index_t *index, uint32_t uid_hash, int64_t start)
+{
+    ics_occurrence_t *e = probe(index, uid_hash, start);
+    if (e->used) {
+        return e;
+    }
+    if (index->count >= index->limit) {
+        index->dropped++;
+        return NULL;
+    }
+    e->used = true;
+    e->uid_hash = uid_hash;
+    e->start = start;
+    e->flags = 0;
+    index->count++;
+    return e;
+}
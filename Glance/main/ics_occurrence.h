@@ -0,0 +1,69 @@
+#ifndef ICS_OCCURRENCE_H
+#define ICS_OCCURRENCE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Occurrence index for recurrence exceptions.
+ *
+ * An open-addressing hash table keyed by (UID hash, occurrence start) that
+ * lets EXDATE and RECURRENCE-ID be applied while the feed streams past:
+ * each marks its key, so a master expanded later skips that occurrence on
+ * lookup. An override that arrives after its master finds the original among
+ * the kept events instead, so occurrences themselves take no entries.
+ *
+ * The table lives in caller-provided storage and never grows; only keys that
+ * fall inside the display window need to be inserted.
+ */
+
+#define ICS_OCCURRENCE_EXCLUDED     0x01    // Removed by EXDATE
+#define ICS_OCCURRENCE_OVERRIDDEN   0x02    // Replaced by a RECURRENCE-ID instance
+
+/**
+ * @brief One index entry.
+ */
+typedef struct {
+    int64_t start;          // Occurrence start, UTC
+    uint32_t uid_hash;      // ics_span_hash() of the UID
+    uint8_t flags;          // ICS_OCCURRENCE_* flags
+    bool used;
+} ics_occurrence_t;
+
+/**
+ * @brief The index. Treat as opaque apart from the statistics.
+ */
+typedef struct {
+    ics_occurrence_t *entries;
+    uint32_t mask;          // Capacity - 1, capacity is a power of two
+    uint32_t count;
+    uint32_t limit;         // Inserts are refused beyond this load
+    uint32_t dropped;       // Inserts refused because the index was full
+} ics_occurrence_index_t;
+
+/**
+ * @brief Initializes an empty index over caller-provided storage.
+ *
+ * @param index    Index to initialize.
+ * @param storage  Entry array; only the largest power of two that fits is used.
+ * @param capacity Number of entries in storage, at least 4.
+ */
+void ics_occurrence_index_init(ics_occurrence_index_t *index, ics_occurrence_t *storage, uint32_t capacity);
+
+/**
+ * @brief Finds the entry for an occurrence.
+ *
+ * @return The entry, or NULL if the occurrence is not in the index.
+ */
+ics_occurrence_t *ics_occurrence_find(ics_occurrence_index_t *index, uint32_t uid_hash, int64_t start);
+
+/**
+ * @brief Finds or adds the entry for an occurrence.
+ *
+ * New entries have no flags.
+ *
+ * @return The entry, or NULL if the index is full.
+ */
+ics_occurrence_t *ics_occurrence_insert(ics_occurrence_index_t *index, uint32_t uid_hash, int64_t start);
+
+#endif // ICS_OCCURRENCE_H
@@ -0,0 +1,481 @@
+#include "ics_rrule.h"
+#include "civil_time.h"
+#include "ics_tokenizer.h"
+#include "ics_tz.h"
+#include <string.h>
+
+static int parse_weekday(const char *p)
+{
+    static const char names[7][2] = {{'S', 'U'}, {'M', 'O'}, {'T', 'U'}, {'W', 'E'}, {'T', 'H'}, {'F', 'R'}, {'S', 'A'}};
+    for (int i = 0; i < 7; i++) {
+        if ((p[0] & ~0x20) == names[i][0] && (p[1] & ~0x20) == names[i][1]) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Parses an optionally signed integer and advances *p past it.
+ */
+static bool parse_int(const char **p, const char *end, int *out)
+{
+    const char *q = *p;
+    int sign = 1, v = 0;
+    if (q < end && (*q == '+' || *q == '-')) {
+        sign = *q++ == '-' ? -1 : 1;
+    }
+    if (q == end || *q < '0' || *q > '9') {
+        return false;
+    }
+    while (q < end && *q >= '0' && *q <= '9') {
+        v = v * 10 + (*q++ - '0');
+    }
+    *out = sign * v;
+    *p = q;
+    return true;
+}
+
+static void parse_part(ics_rrule_t *rule, const char *key, size_t key_len, const char *val, const char *end)
+{
+    int n;
+
+    if (ics_span_equals(key, key_len, "FREQ")) {
+        size_t len = (size_t)(end - val);
+        if (ics_span_equals(val, len, "DAILY")) {
+            rule->freq = ICS_FREQ_DAILY;
+        } else if (ics_span_equals(val, len, "WEEKLY")) {
+            rule->freq = ICS_FREQ_WEEKLY;
+        } else if (ics_span_equals(val, len, "MONTHLY")) {
+            rule->freq = ICS_FREQ_MONTHLY;
+        } else if (ics_span_equals(val, len, "YEARLY")) {
+            rule->freq = ICS_FREQ_YEARLY;
+        } else {
+            rule->unsupported = true; // HOURLY and finer
+        }
+    } else if (ics_span_equals(key, key_len, "INTERVAL")) {
+        if (parse_int(&val, end, &n) && n > 0) {
+            rule->interval = (uint16_t)n;
+        }
+    } else if (ics_span_equals(key, key_len, "COUNT")) {
+        if (parse_int(&val, end, &n) && n > 0) {
+            rule->count = (uint32_t)n;
+        }
+    } else if (ics_span_equals(key, key_len, "UNTIL")) {
+        int64_t until;
+        bool is_utc = false, is_date = false;
+        // Parsed like a DATE-TIME; a DATE bound includes the whole day
+        if (ics_tz_parse_datetime(val, (size_t)(end - val), &until, &is_utc, &is_date)) {
+            rule->until = is_date ? until + CIVIL_SECS_PER_DAY - 1 : until;
+            rule->until_utc = is_utc;
+        }
+    } else if (ics_span_equals(key, key_len, "WKST")) {
+        if (end - val >= 2 && parse_weekday(val) >= 0) {
+            rule->wkst = (uint8_t)parse_weekday(val);
+        }
+    } else if (ics_span_equals(key, key_len, "BYMONTH")) {
+        while (val < end) {
+            if (parse_int(&val, end, &n) && n >= 1 && n <= 12) {
+                rule->bymonth_mask |= (uint16_t)(1u << n);
+            }
+            val++; // Skip ','
+        }
+    } else if (ics_span_equals(key, key_len, "BYMONTHDAY")) {
+        while (val < end) {
+            if (parse_int(&val, end, &n)) {
+                if (n >= 1 && n <= 31) {
+                    rule->bymonthday_mask |= 1u << n;
+                } else if (n <= -1 && n >= -31) {
+                    rule->bymonthday_neg_mask |= 1u << -n;
+                }
+            }
+            val++;
+        }
+    } else if (ics_span_equals(key, key_len, "BYDAY")) {
+        while (val < end) {
+            int nth = 0;
+            const char *item_end = memchr(val, ',', (size_t)(end - val));
+            if (item_end == NULL) {
+                item_end = end;
+            }
+            if (*val == '+' || *val == '-' || (*val >= '0' && *val <= '9')) {
+                parse_int(&val, item_end, &nth);
+            }
+            if (item_end - val >= 2 && parse_weekday(val) >= 0 && rule->byday_count < ICS_RRULE_MAX_BYDAY) {
+                rule->byday[rule->byday_count++] = (ics_rrule_byday_t){
+                    .weekday = (int8_t)parse_weekday(val),
+                    .nth = (int8_t)nth,
+                };
+            }
+            val = item_end + 1;
+        }
+    } else {
+        // BYSETPOS, BYWEEKNO, BYYEARDAY and the time-of-day parts
+        rule->unsupported = true;
+    }
+}
+
+bool ics_rrule_parse(const char *value, size_t len, ics_rrule_t *rule)
+{
+    const char *p = value;
+    const char *end = value + len;
+
+    memset(rule, 0, sizeof(*rule));
+    rule->interval = 1;
+    rule->until = INT64_MAX;
+    rule->wkst = 1;
+
+    while (p < end) {
+        const char *part_end = memchr(p, ';', (size_t)(end - p));
+        if (part_end == NULL) {
+            part_end = end;
+        }
+        const char *eq = memchr(p, '=', (size_t)(part_end - p));
+        if (eq != NULL) {
+            parse_part(rule, p, (size_t)(eq - p), eq + 1, part_end);
+        }
+        p = part_end + 1;
+    }
+    return rule->freq != ICS_FREQ_NONE;
+}
+
+// --- Iteration ---
+
+/**
+ * @brief Index of the FREQ period (day, week, month or year) containing a day.
+ */
+static int64_t period_of(const ics_rrule_iter_t *it, int64_t day)
+{
+    int32_t y;
+    int8_t m, d;
+
+    switch (it->rule.freq) {
+        case ICS_FREQ_DAILY:
+            return day;
+        case ICS_FREQ_WEEKLY:
+            return civil_floor_div(day + 4 - it->rule.wkst, 7);
+        case ICS_FREQ_MONTHLY:
+            civil_date_from_days(day, &y, &m, &d);
+            return (int64_t)y * 12 + m - 1;
+        default:
+            civil_date_from_days(day, &y, &m, &d);
+            return y;
+    }
+}
+
+static int64_t period_first_day(const ics_rrule_iter_t *it, int64_t period)
+{
+    switch (it->rule.freq) {
+        case ICS_FREQ_DAILY:
+            return period;
+        case ICS_FREQ_WEEKLY:
+            return period * 7 - 4 + it->rule.wkst;
+        case ICS_FREQ_MONTHLY:
+            return civil_days_from_date((int32_t)civil_floor_div(period, 12), (int)(period - civil_floor_div(period, 12) * 12) + 1, 1);
+        default:
+            return civil_days_from_date((int32_t)period, 1, 1);
+    }
+}
+
+static bool day_matches(const ics_rrule_iter_t *it, int64_t day, int32_t y, int m, int d)
+{
+    const ics_rrule_t *r = &it->rule;
+    int dim = civil_days_in_month(y, m);
+
+    if (r->bymonth_mask && !(r->bymonth_mask & (1u << m))) {
+        return false;
+    }
+    if ((r->bymonthday_mask || r->bymonthday_neg_mask) &&
+        !((r->bymonthday_mask >> d) & 1) && !((r->bymonthday_neg_mask >> (dim - d + 1)) & 1)) {
+        return false;
+    }
+    if (r->byday_count == 0) {
+        return true;
+    }
+
+    // Ordinals count within the month, or within the year for a plain YEARLY rule
+    int wd = civil_weekday(day);
+    int pos, neg;
+    if (r->freq == ICS_FREQ_YEARLY && !r->bymonth_mask) {
+        int yday = civil_day_of_year(y, m, d);
+        int ylen = 365 + civil_is_leap(y);
+        pos = yday / 7 + 1;
+        neg = -((ylen - 1 - yday) / 7 + 1);
+    } else {
+        pos = (d - 1) / 7 + 1;
+        neg = -((dim - d) / 7 + 1);
+    }
+    for (int i = 0; i < r->byday_count; i++) {
+        const ics_rrule_byday_t *e = &r->byday[i];
+        if (e->weekday == wd && (e->nth == 0 || e->nth == pos || e->nth == neg)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Tests a day against the interval and the BY rules, advancing
+ * it->day past any stretch that cannot contain occurrences.
+ *
+ * @return true if the day is an occurrence.
+ */
+static bool step_day(ics_rrule_iter_t *it)
+{
+    int64_t day = it->day;
+    int64_t off = period_of(it, day) - it->start_period;
+
+    if (off % it->rule.interval != 0) {
+        // Jump to the first day of the next period the interval selects
+        int64_t next = it->start_period + (off / it->rule.interval + 1) * it->rule.interval;
+        it->day = period_first_day(it, next);
+        if (it->day <= day) {
+            it->day = day + 1;
+        }
+        return false;
+    }
+
+    int32_t y;
+    int8_t m, d;
+    civil_date_from_days(day, &y, &m, &d);
+    if (it->rule.bymonth_mask && !(it->rule.bymonth_mask & (1u << m))) {
+        it->day = day + civil_days_in_month(y, m) - d + 1; // Next month
+        return false;
+    }
+    it->day = day + 1;
+    // DTSTART is always the first occurrence, even if it does not match
+    return day == it->start_day || day_matches(it, day, y, m, d);
+}
+
+/**
+ * @brief Counts occurrences in [from, to) by walking days; only used on
+ * stretches within one period.
+ */
+static uint32_t count_days(ics_rrule_iter_t *it, int64_t from, int64_t to)
+{
+    uint32_t n = 0;
+    it->day = from;
+    while (it->day < to) {
+        n += step_day(it);
+    }
+    return n;
+}
+
+/**
+ * @brief The days of a month that day_matches() accepts, as bit d for day d.
+ */
+static uint32_t month_matches(const ics_rrule_iter_t *it, int32_t y, int m)
+{
+    const ics_rrule_t *r = &it->rule;
+    if (r->bymonth_mask && !(r->bymonth_mask & (1u << m))) {
+        return 0;
+    }
+    int dim = civil_days_in_month(y, m);
+    uint32_t days = (uint32_t)((2ull << dim) - 2); // Days 1 to dim
+    if (r->bymonthday_mask || r->bymonthday_neg_mask) {
+        uint32_t by_day = r->bymonthday_mask & days;
+        for (int k = 1; k <= dim; k++) {
+            if ((r->bymonthday_neg_mask >> k) & 1) {
+                by_day |= 1u << (dim - k + 1);
+            }
+        }
+        days = by_day;
+    }
+    if (r->byday_count == 0) {
+        return days;
+    }
+
+    // Ordinals count within the month, or within the year for a plain YEARLY rule
+    int64_t first = civil_days_from_date(y, m, 1);
+    int64_t jan1 = civil_days_from_date(y, 1, 1);
+    bool in_year = r->freq == ICS_FREQ_YEARLY && !r->bymonth_mask;
+    uint32_t weekdays = 0;
+    for (int i = 0; i < r->byday_count; i++) {
+        const ics_rrule_byday_t *e = &r->byday[i];
+        int d0 = 1 + (e->weekday - civil_weekday(first) + 7) % 7;
+        if (e->nth == 0) {
+            for (int d = d0; d <= dim; d += 7) {
+                weekdays |= 1u << d;
+            }
+        } else if (!in_year) {
+            int n = (dim - d0) / 7 + 1;
+            int nth = e->nth > 0 ? e->nth : n + 1 + e->nth;
+            if (nth >= 1 && nth <= n) {
+                weekdays |= 1u << (d0 + 7 * (nth - 1));
+            }
+        } else {
+            int yd0 = (e->weekday - civil_weekday(jan1) + 7) % 7;
+            int n = (365 + civil_is_leap(y) - 1 - yd0) / 7 + 1;
+            int nth = e->nth > 0 ? e->nth : n + 1 + e->nth;
+            int64_t day = jan1 + yd0 + 7 * (nth - 1);
+            if (nth >= 1 && nth <= n && day >= first && day < first + dim) {
+                weekdays |= 1u << (day - first + 1);
+            }
+        }
+    }
+    return days & weekdays;
+}
+
+/**
+ * @brief Counts the occurrences in a whole MONTHLY or YEARLY period.
+ */
+static uint32_t period_matches(const ics_rrule_iter_t *it, int64_t period)
+{
+    if (it->rule.freq == ICS_FREQ_MONTHLY) {
+        int64_t y = civil_floor_div(period, 12);
+        return (uint32_t)__builtin_popcount(month_matches(it, (int32_t)y, (int)(period - y * 12) + 1));
+    }
+    uint32_t n = 0;
+    for (int m = 1; m <= 12; m++) {
+        n += (uint32_t)__builtin_popcount(month_matches(it, (int32_t)period, m));
+    }
+    return n;
+}
+
+/**
+ * @brief Builds the weekday mask of a BYDAY without ordinals, all days if
+ * there is no BYDAY.
+ *
+ * @return false if an entry has an ordinal.
+ */
+static bool weekday_mask(const ics_rrule_t *r, uint8_t *mask)
+{
+    *mask = r->byday_count ? 0 : 0x7F;
+    for (int i = 0; i < r->byday_count; i++) {
+        if (r->byday[i].nth != 0) {
+            return false;
+        }
+        *mask |= (uint8_t)(1u << r->byday[i].weekday);
+    }
+    return true;
+}
+
+/**
+ * @brief Counts the occurrences before the window without walking their
+ * history, so COUNT-bounded series cost the same whatever their age.
+ *
+ * Only the partial first and last periods are walked. Whole DAILY and
+ * WEEKLY periods are counted from the BYDAY weekdays, whole MONTHLY and
+ * YEARLY periods one period at a time from the days each month matches.
+ *
+ * @return true if the count was computed and it->day moved to the window.
+ */
+static bool skip_to_window(ics_rrule_iter_t *it, int64_t ws_day)
+{
+    const ics_rrule_t *r = &it->rule;
+    bool by_month = r->bymonth_mask || r->bymonthday_mask || r->bymonthday_neg_mask;
+
+    if (r->count == 0) {
+        it->day = ws_day; // Nothing to count, earlier occurrences are irrelevant
+        return true;
+    }
+
+    int64_t first = it->start_period;
+    int64_t last = period_of(it, ws_day);
+    uint64_t n;
+    if (last == first) {
+        n = count_days(it, it->start_day, ws_day);
+    } else {
+        uint8_t mask = 0;
+        bool by_weekday = r->freq == ICS_FREQ_DAILY || r->freq == ICS_FREQ_WEEKLY;
+        if (by_weekday && (by_month || !weekday_mask(r, &mask))) {
+            return false;
+        }
+
+        // Partial first period, whole periods the interval selects, partial last period
+        int64_t whole = (last - 1 - first) / r->interval;
+        n = count_days(it, it->start_day, period_first_day(it, first + 1));
+        if (r->freq == ICS_FREQ_WEEKLY) {
+            n += (uint64_t)whole * (uint64_t)__builtin_popcount(mask);
+        } else if (r->freq == ICS_FREQ_DAILY) {
+            // The weekdays of the selected days repeat every seven of them
+            int wd = civil_weekday(it->start_day);
+            int per_cycle = 0, rest = 0;
+            for (int k = 1; k <= 7; k++) {
+                bool match = (mask >> ((wd + (int64_t)k * r->interval) % 7)) & 1;
+                per_cycle += match;
+                rest += match && k <= whole % 7;
+            }
+            n += (uint64_t)(whole / 7) * (uint64_t)per_cycle + (uint64_t)rest;
+        } else {
+            for (int64_t k = 1; k <= whole && n < r->count; k++) {
+                n += period_matches(it, first + k * r->interval);
+            }
+        }
+        n += count_days(it, period_first_day(it, last), ws_day);
+    }
+    it->emitted = n > r->count ? r->count : (uint32_t)n;
+    it->day = ws_day;
+    return true;
+}
+
+void ics_rrule_iter_init(ics_rrule_iter_t *it, const ics_rrule_t *rule, int64_t dtstart,
+                         int64_t window_start, int64_t window_end)
+{
+    memset(it, 0, sizeof(*it));
+    it->rule = *rule;
+    it->dtstart = dtstart;
+    it->start_day = civil_days_from_seconds(dtstart);
+    it->time_of_day = (int32_t)(dtstart - it->start_day * CIVIL_SECS_PER_DAY);
+    it->start_period = period_of(it, it->start_day);
+    it->window_start = window_start;
+    it->window_end = window_end;
+    it->day = it->start_day;
+
+    ics_rrule_t *r = &it->rule;
+    if (r->interval == 0) {
+        r->interval = 1;
+    }
+
+    // Fill in the parts RFC 5545 takes from DTSTART when they are absent
+    int32_t y;
+    int8_t m, d;
+    civil_date_from_days(it->start_day, &y, &m, &d);
+    bool has_day_rule = r->byday_count || r->bymonthday_mask || r->bymonthday_neg_mask;
+    if (r->freq == ICS_FREQ_WEEKLY && r->byday_count == 0) {
+        r->byday[r->byday_count++] = (ics_rrule_byday_t){.weekday = (int8_t)civil_weekday(it->start_day)};
+    } else if (r->freq == ICS_FREQ_MONTHLY && !has_day_rule) {
+        r->bymonthday_mask = 1u << d;
+    } else if (r->freq == ICS_FREQ_YEARLY && !has_day_rule) {
+        if (!r->bymonth_mask) {
+            r->bymonth_mask = (uint16_t)(1u << m);
+        }
+        r->bymonthday_mask = 1u << d;
+    }
+
+    int64_t ws_day = civil_days_from_seconds(window_start);
+    if (ws_day > it->start_day && !skip_to_window(it, ws_day)) {
+        it->day = it->start_day; // Walk from the start to count occurrences
+        it->emitted = 0;
+    }
+    if (it->rule.count && it->emitted >= it->rule.count) {
+        it->done = true;
+    }
+}
+
+bool ics_rrule_iter_next(ics_rrule_iter_t *it, int64_t *start)
+{
+    const ics_rrule_t *r = &it->rule;
+
+    while (!it->done) {
+        int64_t day = it->day;
+        int64_t occ = day * CIVIL_SECS_PER_DAY + it->time_of_day;
+        if (occ >= it->window_end || occ > r->until) {
+            it->done = true;
+            break;
+        }
+        if (!step_day(it)) {
+            continue;
+        }
+        if (r->count && it->emitted >= r->count) {
+            it->done = true;
+            break;
+        }
+        it->emitted++;
+        if (occ >= it->window_start && occ >= it->dtstart) {
+            *start = occ;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,100 @@
+#ifndef ICS_RRULE_H
+#define ICS_RRULE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Lazy RRULE expansion.
+ *
+ * The iterator yields only the occurrences that start inside a window, in
+ * order, and never materializes the recurrence set. Periods before the
+ * window are skipped arithmetically, so an open-ended daily series that began
+ * years ago costs the same as one that began yesterday. With COUNT, the
+ * occurrences before the window still have to be counted: whole DAILY and
+ * WEEKLY periods from their BYDAY weekdays, whole MONTHLY and YEARLY periods
+ * one at a time, and only the partial first and last periods by a day walk.
+ * DAILY and WEEKLY rules with BYMONTH or BYMONTHDAY are walked throughout.
+ *
+ * All times are local wall-clock seconds (see ics_tz.h); the caller converts
+ * occurrences to UTC with the event's zone.
+ */
+
+#define ICS_RRULE_MAX_BYDAY 7
+
+typedef enum {
+    ICS_FREQ_NONE,
+    ICS_FREQ_DAILY,
+    ICS_FREQ_WEEKLY,
+    ICS_FREQ_MONTHLY,
+    ICS_FREQ_YEARLY,
+} ics_freq_t;
+
+typedef struct {
+    int8_t weekday;         // 0 = Sunday
+    int8_t nth;             // 0 for every such weekday, negative counts from the end
+} ics_rrule_byday_t;
+
+/**
+ * @brief A parsed recurrence rule.
+ */
+typedef struct {
+    ics_freq_t freq;
+    uint16_t interval;
+    uint32_t count;                 // 0 if unbounded
+    int64_t until;                  // INT64_MAX if unbounded
+    bool until_utc;                 // UNTIL ended in 'Z'; convert before iterating
+    uint16_t bymonth_mask;          // Bit m set for month m (1-12)
+    uint32_t bymonthday_mask;       // Bit d set for day d (1-31)
+    uint32_t bymonthday_neg_mask;   // Bit d set for day -d
+    uint8_t byday_count;
+    ics_rrule_byday_t byday[ICS_RRULE_MAX_BYDAY];
+    uint8_t wkst;                   // Week start, 0 = Sunday; defaults to Monday
+    bool unsupported;               // Uses parts this iterator does not implement
+} ics_rrule_t;
+
+/**
+ * @brief Iterator state. Treat as opaque.
+ */
+typedef struct {
+    ics_rrule_t rule;
+    int64_t dtstart;
+    int64_t start_day;
+    int32_t time_of_day;
+    int64_t start_period;
+    int64_t window_start;
+    int64_t window_end;
+    int64_t day;            // Next day to examine
+    uint32_t emitted;       // Occurrences so far, including those before the window
+    bool done;
+} ics_rrule_iter_t;
+
+/**
+ * @brief Parses an RRULE value such as FREQ=WEEKLY;INTERVAL=2;BYDAY=MO,WE.
+ *
+ * @return true if the rule has a supported FREQ.
+ */
+bool ics_rrule_parse(const char *value, size_t len, ics_rrule_t *rule);
+
+/**
+ * @brief Starts iterating the occurrences that begin in [window_start, window_end).
+ *
+ * @param it           Iterator to initialize.
+ * @param rule         Rule to expand; UNTIL must already be local time.
+ * @param dtstart      Local start of the first occurrence.
+ * @param window_start Local start of the window.
+ * @param window_end   Local end of the window, exclusive.
+ */
+void ics_rrule_iter_init(ics_rrule_iter_t *it, const ics_rrule_t *rule, int64_t dtstart,
+                         int64_t window_start, int64_t window_end);
+
+/**
+ * @brief Produces the next occurrence in the window.
+ *
+ * @param[out] start Local start of the occurrence.
+ * @return false when there are no more occurrences in the window.
+ */
+bool ics_rrule_iter_next(ics_rrule_iter_t *it, int64_t *start);
+
+#endif // ICS_RRULE_H
@@ -0,0 +1,94 @@
+#include "ics_scan.h"
+#include <stdint.h>
+#include <string.h>
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+#if !defined(CONFIG_GLANCE_ICS_SCAN_SCALAR) && defined(__BYTE_ORDER__) && \
+    __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define ICS_SCAN_SWAR 1
+#endif
+
+#ifdef ICS_SCAN_SWAR
+typedef uintptr_t scan_word_t;
+
+#define WORD_ONES   ((scan_word_t)-1 / 0xFF)    // 0x0101...01
+#define WORD_HIGHS  (WORD_ONES * 0x80)          // 0x8080...80
+
+/**
+ * @brief Flags the high bit of every byte in w that equals c.
+ *
+ * Bytes above a real match may be flagged spuriously, but the lowest flagged
+ * byte is always exact, which is all the callers need.
+ */
+static inline scan_word_t match_byte(scan_word_t w, unsigned char c)
+{
+    scan_word_t x = w ^ (WORD_ONES * c);
+    return (x - WORD_ONES) & ~x & WORD_HIGHS;
+}
+
+static inline size_t first_match(scan_word_t m)
+{
+    return (size_t)__builtin_ctzl((unsigned long)m) / 8;
+}
+#endif
+
+/**
+ * @brief Finds the first byte equal to any of a, b or c.
+ */
+static const char *scan_any(const char *p, const char *end,
+                            unsigned char a, unsigned char b, unsigned char c)
+{
+#ifdef ICS_SCAN_SWAR
+    // Step bytewise up to a word boundary, then test one aligned word at a time
+    while (p < end && ((uintptr_t)p & (sizeof(scan_word_t) - 1)) != 0) {
+        unsigned char ch = (unsigned char)*p;
+        if (ch == a || ch == b || ch == c) {
+            return p;
+        }
+        p++;
+    }
+    while ((size_t)(end - p) >= sizeof(scan_word_t)) {
+        scan_word_t w;
+        memcpy(&w, p, sizeof(w));
+        scan_word_t m = match_byte(w, a) | match_byte(w, b) | match_byte(w, c);
+        if (m != 0) {
+            return p + first_match(m);
+        }
+        p += sizeof(scan_word_t);
+    }
+#endif
+    for (; p < end; p++) {
+        unsigned char ch = (unsigned char)*p;
+        if (ch == a || ch == b || ch == c) {
+            return p;
+        }
+    }
+    return end;
+}
+
+const char *ics_scan_eol(const char *p, const char *end)
+{
+    return scan_any(p, end, '\n', '\n', '\n');
+}
+
+const char *ics_scan_line(const char *p, const char *end, const char **delim)
+{
+    const char *hit = scan_any(p, end, '\n', ':', ';');
+    *delim = hit;
+    if (hit == end || *hit == '\n') {
+        return hit;
+    }
+    return ics_scan_eol(hit + 1, end);
+}
+
+const char *ics_scan_delim(const char *p, const char *end)
+{
+    return scan_any(p, end, ':', ';', ';');
+}
+
+const char *ics_scan_param_end(const char *p, const char *end)
+{
+    return scan_any(p, end, ':', '"', '"');
+}
@@ -0,0 +1,43 @@
+#ifndef ICS_SCAN_H
+#define ICS_SCAN_H
+
+/*
+ * Delimiter search kernels used by the ICS tokenizer.
+ *
+ * On little-endian targets the kernels test a whole machine word per step
+ * (SWAR: SIMD within a register); elsewhere, or when
+ * CONFIG_GLANCE_ICS_SCAN_SCALAR is set, a byte-at-a-time fallback is used.
+ * Both variants return identical results.
+ */
+
+/**
+ * @brief Finds the next line feed.
+ *
+ * @return Pointer to the '\n', or end if there is none.
+ */
+const char *ics_scan_eol(const char *p, const char *end);
+
+/**
+ * @brief Finds the next line feed and the first ':' or ';' before it in a single pass.
+ *
+ * @param[out] delim Set to the first ':' or ';' before the line feed, or to the
+ *                   returned pointer if there is none.
+ * @return Pointer to the '\n', or end if there is none.
+ */
+const char *ics_scan_line(const char *p, const char *end, const char **delim);
+
+/**
+ * @brief Finds the first ':' or ';'.
+ *
+ * @return Pointer to the delimiter, or end if there is none.
+ */
+const char *ics_scan_delim(const char *p, const char *end);
+
+/**
+ * @brief Finds the first ':' or '"', used to skip over parameter lists.
+ *
+ * @return Pointer to the character, or end if there is none.
+ */
+const char *ics_scan_param_end(const char *p, const char *end);
+
+#endif // ICS_SCAN_H
@@ -0,0 +1,418 @@
+#include "ics_tokenizer.h"
+#include "ics_scan.h"
+#include <string.h>
+
+static bool is_fold_char(char c)
+{
+    return c == ' ' || c == '\t';
+}
+
+static char ascii_upper(char c)
+{
+    return (c >= 'a' && c <= 'z') ? (char)(c - 'a' + 'A') : c;
+}
+
+bool ics_span_equals(const char *span, size_t span_len, const char *str)
+{
+    size_t i = 0;
+    for (; i < span_len; i++) {
+        if (str[i] == '\0' || ascii_upper(span[i]) != ascii_upper(str[i])) {
+            return false;
+        }
+    }
+    return str[i] == '\0';
+}
+
+uint32_t ics_span_hash(const char *span, size_t span_len)
+{
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < span_len; i++) {
+        h ^= (uint8_t)span[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+uint64_t ics_span_hash64(uint64_t hash, const char *span, size_t span_len)
+{
+    for (size_t i = 0; i < span_len; i++) {
+        hash ^= (uint8_t)span[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+bool ics_param_get(const ics_property_t *prop, const char *name,
+                   const char **value, size_t *value_len)
+{
+    const char *p = prop->params;
+    const char *end = prop->params + prop->params_len;
+
+    while (p < end) {
+        // Each parameter is NAME=VALUE, VALUE may be quoted and contain ';'
+        const char *param_name = p;
+        while (p < end && *p != '=' && *p != ';') {
+            p++;
+        }
+        size_t name_len = (size_t)(p - param_name);
+        if (p == end || *p == ';') {
+            p++;
+            continue;
+        }
+
+        const char *val = ++p;
+        bool quoted = false;
+        while (p < end && (quoted || *p != ';')) {
+            if (*p == '"') {
+                quoted = !quoted;
+            }
+            p++;
+        }
+        const char *val_end = p++;
+
+        if (ics_span_equals(param_name, name_len, name)) {
+            if (val_end - val >= 2 && *val == '"' && val_end[-1] == '"') {
+                val++;
+                val_end--;
+            }
+            *value = val;
+            *value_len = (size_t)(val_end - val);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ics_tokenizer_init(ics_tokenizer_t *tok, char *spill, size_t spill_cap,
+                        ics_property_cb_t on_property, void *ctx)
+{
+    memset(tok, 0, sizeof(*tok));
+    tok->spill = spill;
+    tok->spill_cap = spill_cap;
+    tok->on_property = on_property;
+    tok->ctx = ctx;
+}
+
+void ics_tokenizer_set_filter(ics_tokenizer_t *tok, const ics_filter_t *filter)
+{
+    tok->filter = filter;
+}
+
+static bool list_contains(const char *const *list, const char *span, size_t len)
+{
+    if (list == NULL) {
+        return true;
+    }
+    for (; *list != NULL; list++) {
+        if (ics_span_equals(span, len, *list)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Decides from its name whether a line is reported.
+ *
+ * Called once per line; tracks nesting while inside a skipped component.
+ */
+static bool line_wanted(ics_tokenizer_t *tok, const char *name, size_t len)
+{
+    bool begin = ics_span_equals(name, len, "BEGIN");
+    bool end = !begin && ics_span_equals(name, len, "END");
+
+    if (tok->skip_depth > 0) {
+        if (begin) {
+            tok->skip_depth++;
+        } else if (end) {
+            tok->skip_depth--;
+        }
+        return false;
+    }
+    return begin || end || tok->filter == NULL || list_contains(tok->filter->properties, name, len);
+}
+
+/**
+ * @brief Discards the rest of a skipped line, including continuation lines.
+ *
+ * @return Where the next line starts, or end if the line may continue in the
+ *         next chunk.
+ */
+static const char *skip_line(ics_tokenizer_t *tok, const char *p, const char *end)
+{
+    const char *start = p;
+    for (;;) {
+        const char *lf = ics_scan_eol(p, end);
+        if (lf == end) {
+            p = end;
+            break;
+        }
+        p = lf + 1;
+        if (p == end) {
+            tok->pending_eol = true;
+            break;
+        }
+        if (!is_fold_char(*p)) {
+            tok->skipping = false;
+            tok->lines_skipped++;
+            break;
+        }
+        p++;
+    }
+    tok->bytes_skipped += (size_t)(p - start);
+    return p;
+}
+
+/**
+ * @brief Switches the current line to skipping, dropping anything spilled.
+ */
+static void start_skipping(ics_tokenizer_t *tok)
+{
+    tok->bytes_skipped += tok->spill_len;
+    tok->spill_len = 0;
+    tok->line_len = 0;
+    tok->last_cr = false;
+    tok->name_pending = false;
+    tok->skipping = true;
+}
+
+/**
+ * @brief Appends part of the current line to the spill buffer.
+ *
+ * Bytes that do not fit are dropped but still counted in line_len, so the
+ * line can be reported as truncated instead of resetting the parser state.
+ */
+static void spill_append(ics_tokenizer_t *tok, const char *data, size_t len)
+{
+    size_t room = tok->spill_cap - tok->spill_len;
+    size_t n = len < room ? len : room;
+
+    memcpy(tok->spill + tok->spill_len, data, n);
+    tok->spill_len += n;
+    tok->line_len += len;
+    if (len > 0) {
+        tok->last_cr = data[len - 1] == '\r';
+    }
+    if (tok->spill_len > tok->spill_high_water) {
+        tok->spill_high_water = tok->spill_len;
+    }
+}
+
+/**
+ * @brief Drops a CR that arrived at the end of the previous chunk.
+ */
+static void spill_strip_cr(ics_tokenizer_t *tok)
+{
+    if (tok->spill_len == tok->line_len) {
+        tok->spill_len--;
+    }
+    tok->line_len--;
+    tok->last_cr = false;
+}
+
+/**
+ * @brief Splits an unfolded line into name, params and value and reports it.
+ *
+ * Parameter values may be quoted and contain ':' or ';', e.g.
+ * ATTENDEE;CN="Doe: John":mailto:jd@example.com
+ */
+static bool emit_line(ics_tokenizer_t *tok, const char *line, size_t len,
+                      const char *delim, bool truncated)
+{
+    if (len == 0) {
+        return true;
+    }
+
+    const char *end = line + len;
+    const char *p = delim ? delim : ics_scan_delim(line, end);
+    if (p >= end) {
+        return true; // Not a content line, ignore it
+    }
+
+    ics_property_t prop = {
+        .name = line,
+        .name_len = (size_t)(p - line),
+        .truncated = truncated,
+    };
+
+    if (*p == ';') {
+        const char *params = ++p;
+        p = ics_scan_param_end(p, end);
+        while (p < end && *p == '"') {
+            // Skip the quoted parameter value
+            p = memchr(p + 1, '"', (size_t)(end - p - 1));
+            if (p == NULL) {
+                return true; // Unterminated quote
+            }
+            p = ics_scan_param_end(p + 1, end);
+        }
+        if (p == end) {
+            return true; // No value separator
+        }
+        prop.params = params;
+        prop.params_len = (size_t)(p - params);
+    }
+
+    prop.value = p + 1;
+    prop.value_len = (size_t)(end - prop.value);
+
+    if (tok->filter != NULL && ics_span_equals(prop.name, prop.name_len, "BEGIN") &&
+        !list_contains(tok->filter->components, prop.value, prop.value_len)) {
+        tok->skip_depth = 1;
+        tok->lines_skipped++;
+        return true;
+    }
+
+    tok->lines++;
+    if (truncated) {
+        tok->lines_truncated++;
+    }
+    if (!tok->on_property(&prop, tok->ctx)) {
+        tok->aborted = true;
+        return false;
+    }
+    return true;
+}
+
+static bool flush_spill(ics_tokenizer_t *tok)
+{
+    bool truncated = tok->line_len > tok->spill_len;
+    size_t len = tok->spill_len;
+
+    tok->spill_len = 0;
+    tok->line_len = 0;
+    tok->last_cr = false;
+    if (len > 0) {
+        tok->lines_spilled++;
+    }
+    bool ok = emit_line(tok, tok->spill, len, NULL, truncated);
+    tok->name_pending = false;
+    return ok;
+}
+
+/**
+ * @brief Completes the current line once the next one is known to start.
+ */
+static bool end_line(ics_tokenizer_t *tok)
+{
+    if (tok->skipping) {
+        tok->skipping = false;
+        tok->lines_skipped++;
+        return true;
+    }
+    return flush_spill(tok);
+}
+
+bool ics_tokenizer_feed(ics_tokenizer_t *tok, const char *data, size_t len)
+{
+    const char *p = data;
+    const char *end = data + len;
+
+    if (tok->aborted) {
+        return false;
+    }
+    tok->bytes_in += len;
+
+    while (p < end) {
+        if (tok->pending_eol) {
+            // The previous chunk ended on a line break; this byte tells
+            // whether the spilled line continues (folding) or is complete.
+            tok->pending_eol = false;
+            if (is_fold_char(*p)) {
+                p++;
+                continue;
+            }
+            if (!end_line(tok)) {
+                return false;
+            }
+        }
+
+        if (tok->skipping) {
+            p = skip_line(tok, p, end);
+            continue;
+        }
+
+        // A line starting in this chunk is searched for its end and its
+        // name delimiter in one pass; a continued line only needs its end,
+        // unless its name was cut off.
+        const char *seg = p;
+        const char *delim = NULL;
+        const char *lf;
+        if (tok->line_len == 0 || tok->name_pending) {
+            lf = ics_scan_line(p, end, &delim);
+            if (delim < lf) {
+                bool wanted;
+                if (tok->line_len == 0) {
+                    wanted = line_wanted(tok, seg, (size_t)(delim - seg));
+                } else {
+                    // Complete the name in the spill buffer
+                    spill_append(tok, seg, (size_t)(delim - seg));
+                    tok->name_pending = false;
+                    wanted = line_wanted(tok, tok->spill, tok->spill_len);
+                    seg = delim;
+                    delim = NULL;
+                }
+                if (!wanted) {
+                    start_skipping(tok);
+                    p = seg;
+                    continue;
+                }
+            } else {
+                tok->name_pending = true;
+                delim = NULL;
+            }
+        } else {
+            lf = ics_scan_eol(p, end);
+        }
+        if (lf == end) {
+            // Line continues in the next chunk
+            spill_append(tok, seg, (size_t)(end - seg));
+            break;
+        }
+
+        const char *content_end = lf;
+        p = lf + 1;
+        if (content_end > seg && content_end[-1] == '\r') {
+            content_end--;
+        } else if (content_end == seg && tok->line_len > 0 && tok->last_cr) {
+            spill_strip_cr(tok);
+        }
+
+        // Fast path: the whole line is in this chunk and the next line is
+        // not a continuation, so report it in place.
+        if (tok->line_len == 0 && p < end && !is_fold_char(*p)) {
+            tok->name_pending = false;
+            if (!emit_line(tok, seg, (size_t)(content_end - seg), delim, false)) {
+                return false;
+            }
+            continue;
+        }
+
+        spill_append(tok, seg, (size_t)(content_end - seg));
+        tok->last_cr = false;
+        if (p == end) {
+            tok->pending_eol = true;
+            break;
+        }
+        if (is_fold_char(*p)) {
+            p++; // Unfold: drop the line break and one leading whitespace
+            continue;
+        }
+        if (!flush_spill(tok)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ics_tokenizer_finish(ics_tokenizer_t *tok)
+{
+    if (tok->aborted) {
+        return false;
+    }
+    if (tok->line_len > 0 && tok->last_cr) {
+        spill_strip_cr(tok);
+    }
+    tok->pending_eol = false;
+    return end_line(tok);
+}
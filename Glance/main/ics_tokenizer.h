@@ -0,0 +1,158 @@
+#ifndef ICS_TOKENIZER_H
+#define ICS_TOKENIZER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Resumable RFC 5545 content-line tokenizer.
+ *
+ * Data is fed in arbitrary chunks (e.g. straight from HTTP_EVENT_ON_DATA).
+ * Folded lines are unfolded across chunk boundaries and every content line is
+ * reported as (name, params, value) spans. A line that lies entirely inside
+ * one chunk and is not folded is reported in place, without copying. Only
+ * lines that straddle a chunk boundary or are folded are assembled in the
+ * caller-supplied spill buffer.
+ *
+ * An optional filter names the components and properties the caller wants.
+ * Everything else is skipped as soon as its name is known: the tokenizer only
+ * searches for line breaks until the skipped line or component ends, so
+ * attachments, alarms and long descriptions are never copied or unfolded.
+ *
+ * This module depends on the C standard library only, so it can be built and
+ * measured on a host as well as on the device.
+ */
+
+/**
+ * @brief A single unfolded content line, split into its parts.
+ *
+ * The spans are not NUL-terminated and are only valid during the callback.
+ */
+typedef struct {
+    const char *name;
+    size_t name_len;
+    const char *params;     // Everything between the first ';' and the value ':'
+    size_t params_len;      // 0 if the property has no parameters
+    const char *value;
+    size_t value_len;
+    bool truncated;         // The line did not fit in the spill buffer
+} ics_property_t;
+
+/**
+ * @brief Called for every content line.
+ *
+ * @return true to continue tokenizing, false to abort the feed.
+ */
+typedef bool (*ics_property_cb_t)(const ics_property_t *prop, void *ctx);
+
+/**
+ * @brief Allow-list of components and properties to report.
+ *
+ * Both lists are NULL-terminated and matched case-insensitively; a NULL list
+ * allows everything. BEGIN and END lines of allowed components are always
+ * reported. A component that is not allowed is skipped with everything nested
+ * in it.
+ */
+typedef struct {
+    const char *const *components;  // e.g. "VCALENDAR", "VEVENT"
+    const char *const *properties;  // e.g. "SUMMARY", "DTSTART"
+} ics_filter_t;
+
+/**
+ * @brief Tokenizer state. Treat as opaque; initialize with ics_tokenizer_init().
+ */
+typedef struct {
+    ics_property_cb_t on_property;
+    void *ctx;
+
+    char *spill;            // Assembly buffer for split or folded lines
+    size_t spill_cap;
+    size_t spill_len;       // Bytes of the current line held in the spill buffer
+    size_t line_len;        // Full unfolded length of the current line, including dropped bytes
+    bool pending_eol;       // Saw a line break at the end of a chunk, next byte decides folding
+    bool last_cr;           // The spilled line ends with a CR whose LF is still to come
+    bool aborted;
+
+    const ics_filter_t *filter;
+    bool name_pending;      // The current line's name is not complete yet
+    bool skipping;          // Discarding the current line and its continuations
+    uint16_t skip_depth;    // Nesting depth inside a component that is not allowed
+
+    // Statistics
+    size_t bytes_in;
+    size_t lines;
+    size_t lines_spilled;
+    size_t lines_truncated;
+    size_t spill_high_water;
+    size_t lines_skipped;
+    size_t bytes_skipped;
+} ics_tokenizer_t;
+
+/**
+ * @brief Initializes a tokenizer.
+ *
+ * @param tok         Tokenizer to initialize.
+ * @param spill       Buffer used to assemble lines that cannot be reported in place.
+ * @param spill_cap   Size of the spill buffer. Longer lines are reported truncated.
+ * @param on_property Callback invoked for each content line.
+ * @param ctx         User pointer passed to the callback.
+ */
+void ics_tokenizer_init(ics_tokenizer_t *tok, char *spill, size_t spill_cap,
+                        ics_property_cb_t on_property, void *ctx);
+
+/**
+ * @brief Restricts the components and properties reported to the callback.
+ *
+ * Call after ics_tokenizer_init() and before feeding; the filter must outlive
+ * the tokenizer.
+ */
+void ics_tokenizer_set_filter(ics_tokenizer_t *tok, const ics_filter_t *filter);
+
+/**
+ * @brief Feeds the next chunk of the stream.
+ *
+ * @return false if the callback aborted tokenizing, true otherwise.
+ */
+bool ics_tokenizer_feed(ics_tokenizer_t *tok, const char *data, size_t len);
+
+/**
+ * @brief Flushes the last line once the stream has ended.
+ *
+ * @return false if the callback aborted tokenizing, true otherwise.
+ */
+bool ics_tokenizer_finish(ics_tokenizer_t *tok);
+
+/**
+ * @brief Case-insensitive comparison of a span against a NUL-terminated string.
+ */
+bool ics_span_equals(const char *span, size_t span_len, const char *str);
+
+/**
+ * @brief Hashes a span such as a UID or TZID (32-bit FNV-1a, case-sensitive).
+ */
+uint32_t ics_span_hash(const char *span, size_t span_len);
+
+#define ICS_SPAN_HASH64_INIT    0xCBF29CE484222325ull
+
+/**
+ * @brief Continues a 64-bit FNV-1a hash over a span, for content hashes
+ * built from several spans. Start from ICS_SPAN_HASH64_INIT.
+ */
+uint64_t ics_span_hash64(uint64_t hash, const char *span, size_t span_len);
+
+/**
+ * @brief Looks up a property parameter such as TZID or VALUE.
+ *
+ * Surrounding double quotes are removed from the returned value.
+ *
+ * @param prop           Property to search.
+ * @param name           Parameter name, matched case-insensitively.
+ * @param[out] value     Set to the parameter value.
+ * @param[out] value_len Set to the length of the value.
+ * @return true if the parameter is present.
+ */
+bool ics_param_get(const ics_property_t *prop, const char *name,
+                   const char **value, size_t *value_len);
+
+#endif // ICS_TOKENIZER_H
@@ -0,0 +1,551 @@
+#include "ics_tz.h"
+#include "civil_time.h"
+#include <string.h>
+
+static int year_of(int64_t seconds)
+{
+    civil_time_t t;
+    civil_from_seconds(seconds, &t);
+    return t.year;
+}
+
+uint32_t ics_tz_hash(const char *tzid, size_t len)
+{
+    return ics_span_hash(tzid, len);
+}
+
+static bool parse_digits(const char *s, int n, int *out)
+{
+    int v = 0;
+    for (int i = 0; i < n; i++) {
+        if (s[i] < '0' || s[i] > '9') {
+            return false;
+        }
+        v = v * 10 + (s[i] - '0');
+    }
+    *out = v;
+    return true;
+}
+
+bool ics_tz_parse_datetime(const char *value, size_t len, int64_t *seconds,
+                           bool *is_utc, bool *is_date)
+{
+    int y, mo, d, h = 0, mi = 0, s = 0;
+
+    while (len > 0 && (*value == ' ' || *value == '\t')) {
+        value++;
+        len--;
+    }
+    if (len < 8 || !parse_digits(value, 4, &y) || !parse_digits(value + 4, 2, &mo) ||
+        !parse_digits(value + 6, 2, &d)) {
+        return false;
+    }
+    *is_date = len < 15 || value[8] != 'T';
+    if (!*is_date && (!parse_digits(value + 9, 2, &h) || !parse_digits(value + 11, 2, &mi) ||
+                      !parse_digits(value + 13, 2, &s))) {
+        return false;
+    }
+    if (mo < 1 || mo > 12 || d < 1 || d > civil_days_in_month(y, mo) || h > 23 || mi > 59 || s > 60) {
+        return false;
+    }
+    *is_utc = !*is_date && len > 15 && value[15] == 'Z';
+    *seconds = civil_to_seconds(y, mo, d, h, mi, s);
+    return true;
+}
+
+bool ics_tz_parse_duration(const char *value, size_t len, int32_t *days, int32_t *seconds)
+{
+    const char *p = value;
+    const char *end = value + len;
+    while (p < end && (*p == ' ' || *p == '\t')) {
+        p++;
+    }
+    int sign = 1;
+    if (p < end && (*p == '+' || *p == '-')) {
+        sign = *p++ == '-' ? -1 : 1;
+    }
+    if (p == end || *p++ != 'P') {
+        return false;
+    }
+
+    int64_t d = 0, s = 0;
+    bool in_time = false, any = false;
+    while (p < end && *p != ' ' && *p != '\t') {
+        if (*p == 'T' && !in_time) {
+            in_time = true;
+            p++;
+            continue;
+        }
+        int64_t n = 0;
+        const char *digits = p;
+        while (p < end && *p >= '0' && *p <= '9' && n < 100000000) {
+            n = n * 10 + (*p++ - '0');
+        }
+        if (p == digits || p == end) {
+            return false;
+        }
+        char unit = *p++;
+        if (!in_time && unit == 'W') {
+            d += n * 7;
+        } else if (!in_time && unit == 'D') {
+            d += n;
+        } else if (in_time && unit == 'H') {
+            s += n * 3600;
+        } else if (in_time && unit == 'M') {
+            s += n * 60;
+        } else if (in_time && unit == 'S') {
+            s += n;
+        } else {
+            return false;
+        }
+        any = true;
+    }
+    if (!any || d > INT32_MAX || s > INT32_MAX) {
+        return false;
+    }
+    *days = (int32_t)(sign * d);
+    *seconds = (int32_t)(sign * s);
+    return true;
+}
+
+int32_t ics_tz_offset_at(const ics_tz_zone_t *zone, int64_t utc)
+{
+    // Find the last transition at or before utc
+    int lo = 0, hi = zone->count;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (zone->transitions[mid].utc <= utc) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo == 0 ? zone->initial_offset : zone->transitions[lo - 1].offset_to;
+}
+
+int64_t ics_tz_local_to_utc(const ics_tz_zone_t *zone, int64_t local)
+{
+    if (zone->count == 0) {
+        return local - zone->initial_offset;
+    }
+    // Try the offset in effect just before and just after the local time and
+    // keep the first one that is consistent.
+    int32_t before = ics_tz_offset_at(zone, local - 86400);
+    int64_t utc = local - before;
+    if (ics_tz_offset_at(zone, utc) == before) {
+        return utc;
+    }
+    int32_t after = ics_tz_offset_at(zone, local + 86400);
+    utc = local - after;
+    if (ics_tz_offset_at(zone, utc) == after) {
+        return utc;
+    }
+    return local - before; // In a gap
+}
+
+const ics_tz_zone_t *ics_tz_find(const ics_tz_zone_t *zones, int count, uint32_t tzid_hash)
+{
+    for (int i = 0; i < count; i++) {
+        if (zones[i].tzid_hash == tzid_hash) {
+            return &zones[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Inserts a transition keeping the table sorted. When the table is
+ * full the latest transition is dropped.
+ */
+static void zone_insert(ics_tz_zone_t *zone, int64_t utc, int32_t from, int32_t to)
+{
+    int i = zone->count;
+    if (i == ICS_TZ_MAX_TRANSITIONS) {
+        zone->overflow = true;
+        if (utc >= zone->transitions[i - 1].utc) {
+            return;
+        }
+        i--;
+    } else {
+        zone->count++;
+    }
+    while (i > 0 && zone->transitions[i - 1].utc > utc) {
+        zone->transitions[i] = zone->transitions[i - 1];
+        i--;
+    }
+    zone->transitions[i] = (ics_tz_transition_t){.utc = utc, .offset_from = from, .offset_to = to};
+}
+
+// --- POSIX TZ strings ---
+
+typedef struct {
+    char kind;      // 'M', 'J' or 'D' (zero-based day of year)
+    int month, week, weekday, day;
+    int32_t time;   // Local seconds after midnight
+} posix_rule_t;
+
+static const char *parse_posix_name(const char *p)
+{
+    if (*p == '<') {
+        const char *close = strchr(p, '>');
+        return close ? close + 1 : NULL;
+    }
+    const char *start = p;
+    while ((*p >= 'A' && *p <= 'Z') || (*p >= 'a' && *p <= 'z')) {
+        p++;
+    }
+    return p - start >= 3 ? p : NULL;
+}
+
+/**
+ * @brief Parses [+-]hh[:mm[:ss]] into seconds, keeping the sign as written.
+ */
+static const char *parse_posix_time(const char *p, int32_t *secs)
+{
+    int sign = 1;
+    if (*p == '+' || *p == '-') {
+        sign = *p++ == '-' ? -1 : 1;
+    }
+    if (*p < '0' || *p > '9') {
+        return NULL;
+    }
+    int32_t parts[3] = {0, 0, 0};
+    for (int i = 0; i < 3; i++) {
+        while (*p >= '0' && *p <= '9') {
+            parts[i] = parts[i] * 10 + (*p++ - '0');
+        }
+        if (i == 2 || *p != ':') {
+            break;
+        }
+        p++;
+    }
+    *secs = sign * (parts[0] * 3600 + parts[1] * 60 + parts[2]);
+    return p;
+}
+
+static const char *parse_posix_int(const char *p, int *out)
+{
+    if (*p < '0' || *p > '9') {
+        return NULL;
+    }
+    int v = 0;
+    while (*p >= '0' && *p <= '9') {
+        v = v * 10 + (*p++ - '0');
+    }
+    *out = v;
+    return p;
+}
+
+static const char *parse_posix_rule(const char *p, posix_rule_t *rule)
+{
+    memset(rule, 0, sizeof(*rule));
+    rule->time = 2 * 3600;
+    if (*p == 'M') {
+        rule->kind = 'M';
+        if (!(p = parse_posix_int(p + 1, &rule->month)) || *p++ != '.' ||
+            !(p = parse_posix_int(p, &rule->week)) || *p++ != '.' ||
+            !(p = parse_posix_int(p, &rule->weekday))) {
+            return NULL;
+        }
+        if (rule->month < 1 || rule->month > 12 || rule->week < 1 || rule->week > 5 || rule->weekday > 6) {
+            return NULL;
+        }
+    } else if (*p == 'J') {
+        rule->kind = 'J';
+        if (!(p = parse_posix_int(p + 1, &rule->day))) {
+            return NULL;
+        }
+    } else {
+        rule->kind = 'D';
+        if (!(p = parse_posix_int(p, &rule->day))) {
+            return NULL;
+        }
+    }
+    if (*p == '/') {
+        p = parse_posix_time(p + 1, &rule->time);
+    }
+    return p;
+}
+
+static int64_t posix_rule_day(const posix_rule_t *rule, int year)
+{
+    switch (rule->kind) {
+        case 'M':
+            return civil_nth_weekday(year, rule->month, rule->weekday, rule->week == 5 ? -1 : rule->week);
+        case 'J':
+            // 1-365, February 29 is never counted
+            return civil_days_from_date(year, 1, 1) + rule->day - 1 + (civil_is_leap(year) && rule->day >= 60);
+        default:
+            return civil_days_from_date(year, 1, 1) + rule->day;
+    }
+}
+
+bool ics_tz_compile_posix(ics_tz_zone_t *zone, const char *posix, int first_year, int last_year)
+{
+    memset(zone, 0, sizeof(*zone));
+
+    int32_t std_west, dst_west;
+    const char *p = parse_posix_name(posix);
+    if (p == NULL || (p = parse_posix_time(p, &std_west)) == NULL) {
+        return false;
+    }
+    // POSIX offsets count hours west of UTC, the table stores seconds east
+    int32_t std_offset = -std_west;
+    zone->initial_offset = std_offset;
+    if (*p == '\0') {
+        return true;
+    }
+
+    if ((p = parse_posix_name(p)) == NULL) {
+        return false;
+    }
+    int32_t dst_offset = std_offset + 3600;
+    if (*p != ',' && *p != '\0') {
+        if ((p = parse_posix_time(p, &dst_west)) == NULL) {
+            return false;
+        }
+        dst_offset = -dst_west;
+    }
+
+    posix_rule_t start, end;
+    if (*p != ',') {
+        // No rule given: use the current US rules, as newlib does
+        start = (posix_rule_t){.kind = 'M', .month = 3, .week = 2, .weekday = 0, .time = 7200};
+        end = (posix_rule_t){.kind = 'M', .month = 11, .week = 1, .weekday = 0, .time = 7200};
+    } else if ((p = parse_posix_rule(p + 1, &start)) == NULL || *p != ',' ||
+               (p = parse_posix_rule(p + 1, &end)) == NULL) {
+        return false;
+    }
+
+    for (int y = first_year; y <= last_year; y++) {
+        int64_t on = posix_rule_day(&start, y) * CIVIL_SECS_PER_DAY + start.time - std_offset;
+        int64_t off = posix_rule_day(&end, y) * CIVIL_SECS_PER_DAY + end.time - dst_offset;
+        zone_insert(zone, on, std_offset, dst_offset);
+        zone_insert(zone, off, dst_offset, std_offset);
+    }
+    if (zone->count > 0) {
+        zone->initial_offset = zone->transitions[0].offset_from;
+    }
+    return true;
+}
+
+// --- VTIMEZONE blocks ---
+
+/**
+ * @brief Parses a UTC offset such as +0800, -0500 or +053000.
+ */
+static bool parse_ics_offset(const char *v, size_t len, int32_t *out)
+{
+    int h, m, s = 0;
+    if (len < 5 || (v[0] != '+' && v[0] != '-') || !parse_digits(v + 1, 2, &h) ||
+        !parse_digits(v + 3, 2, &m) || (len >= 7 && !parse_digits(v + 5, 2, &s))) {
+        return false;
+    }
+    *out = (v[0] == '-' ? -1 : 1) * (h * 3600 + m * 60 + s);
+    return true;
+}
+
+static int parse_weekday(const char *p)
+{
+    static const char names[7][2] = {{'S', 'U'}, {'M', 'O'}, {'T', 'U'}, {'W', 'E'}, {'T', 'H'}, {'F', 'R'}, {'S', 'A'}};
+    for (int i = 0; i < 7; i++) {
+        if (p[0] == names[i][0] && p[1] == names[i][1]) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Parses the yearly RRULE of an observance, e.g. FREQ=YEARLY;BYMONTH=3;BYDAY=2SU
+ */
+static void parse_observance_rrule(ics_tz_builder_t *b, const char *v, size_t len)
+{
+    const char *end = v + len;
+
+    b->has_rrule = false;
+    b->rule_month = 0;
+    b->rule_weekday = -1;
+    b->rule_nth = 0;
+    b->rule_monthday = 0;
+    b->rule_until = INT64_MAX;
+
+    while (v < end) {
+        const char *part_end = memchr(v, ';', (size_t)(end - v));
+        if (part_end == NULL) {
+            part_end = end;
+        }
+        const char *eq = memchr(v, '=', (size_t)(part_end - v));
+        if (eq != NULL) {
+            const char *val = eq + 1;
+            size_t val_len = (size_t)(part_end - val);
+            if (ics_span_equals(v, (size_t)(eq - v), "FREQ")) {
+                b->has_rrule = ics_span_equals(val, val_len, "YEARLY");
+            } else if (ics_span_equals(v, (size_t)(eq - v), "BYMONTH")) {
+                int m = 0;
+                for (const char *q = val; q < part_end && *q >= '0' && *q <= '9'; q++) {
+                    m = m * 10 + (*q - '0');
+                }
+                b->rule_month = (int8_t)m;
+            } else if (ics_span_equals(v, (size_t)(eq - v), "BYMONTHDAY")) {
+                int d = 0;
+                for (const char *q = val; q < part_end && *q >= '0' && *q <= '9'; q++) {
+                    d = d * 10 + (*q - '0');
+                }
+                b->rule_monthday = (int8_t)d;
+            } else if (ics_span_equals(v, (size_t)(eq - v), "BYDAY") && val_len >= 2) {
+                int sign = 1, n = 0;
+                const char *q = val;
+                if (*q == '+' || *q == '-') {
+                    sign = *q++ == '-' ? -1 : 1;
+                }
+                while (q < part_end && *q >= '0' && *q <= '9') {
+                    n = n * 10 + (*q++ - '0');
+                }
+                if (part_end - q >= 2) {
+                    b->rule_weekday = (int8_t)parse_weekday(q);
+                    b->rule_nth = (int8_t)(sign * n);
+                }
+            } else if (ics_span_equals(v, (size_t)(eq - v), "UNTIL")) {
+                int64_t until;
+                bool is_utc, is_date;
+                if (ics_tz_parse_datetime(val, val_len, &until, &is_utc, &is_date)) {
+                    b->rule_until = until;
+                }
+            }
+        }
+        v = part_end + 1;
+    }
+    if (b->rule_month < 1 || b->rule_month > 12) {
+        b->has_rrule = false;
+    }
+}
+
+static void builder_add(ics_tz_builder_t *b, int64_t local)
+{
+    int64_t utc = local - b->offset_from;
+    if (utc < b->window_start) {
+        // Only the latest transition before the window matters
+        if (!b->has_pre || utc > b->pre_utc) {
+            b->has_pre = true;
+            b->pre_utc = utc;
+            b->zone->initial_offset = b->offset_to;
+        }
+    } else if (utc <= b->window_end) {
+        zone_insert(b->zone, utc, b->offset_from, b->offset_to);
+    }
+}
+
+/**
+ * @brief Generates the onsets of a finished STANDARD or DAYLIGHT observance.
+ */
+static void builder_flush_observance(ics_tz_builder_t *b)
+{
+    if (!b->has_dtstart) {
+        return;
+    }
+
+    for (int i = 0; i < b->rdate_count; i++) {
+        builder_add(b, b->rdates[i]);
+    }
+    if (!b->has_rrule) {
+        builder_add(b, b->dtstart);
+        return;
+    }
+
+    int64_t tod = b->dtstart - civil_floor_div(b->dtstart, CIVIL_SECS_PER_DAY) * CIVIL_SECS_PER_DAY;
+    int first = year_of(b->dtstart);
+    int from = year_of(b->window_start) - 1;
+    int last = year_of(b->window_end);
+    if (b->rule_until != INT64_MAX && year_of(b->rule_until) < from) {
+        from = year_of(b->rule_until); // Rule ended before the window, still need its last onset
+    }
+    if (from < first) {
+        from = first;
+    }
+
+    for (int y = from; y <= last; y++) {
+        int64_t day;
+        if (b->rule_weekday < 0) {
+            int d = b->rule_monthday > 0 ? b->rule_monthday : 1;
+            day = civil_days_from_date(y, b->rule_month, d);
+        } else if (b->rule_monthday > 0) {
+            // BYMONTHDAY=8,9,...,14;BYDAY=SU style: first matching weekday on or after the day
+            int64_t start = civil_days_from_date(y, b->rule_month, b->rule_monthday);
+            day = start + (b->rule_weekday - civil_weekday(start) + 7) % 7;
+        } else {
+            day = civil_nth_weekday(y, b->rule_month, b->rule_weekday, b->rule_nth);
+        }
+        int64_t local = day * CIVIL_SECS_PER_DAY + tod;
+        if (local < b->dtstart) {
+            continue;
+        }
+        if (local - b->offset_from > b->rule_until) {
+            break;
+        }
+        builder_add(b, local);
+    }
+}
+
+void ics_tz_builder_begin(ics_tz_builder_t *b, ics_tz_zone_t *zone, int first_year, int last_year)
+{
+    memset(b, 0, sizeof(*b));
+    memset(zone, 0, sizeof(*zone));
+    b->zone = zone;
+    b->window_start = civil_days_from_date(first_year, 1, 1) * CIVIL_SECS_PER_DAY;
+    b->window_end = civil_days_from_date(last_year + 1, 1, 1) * CIVIL_SECS_PER_DAY - 1;
+}
+
+void ics_tz_builder_property(ics_tz_builder_t *b, const ics_property_t *prop)
+{
+    const char *v = prop->value;
+    size_t len = prop->value_len;
+
+    if (ics_span_equals(prop->name, prop->name_len, "BEGIN")) {
+        if (ics_span_equals(v, len, "STANDARD") || ics_span_equals(v, len, "DAYLIGHT")) {
+            b->in_observance = true;
+            b->has_dtstart = false;
+            b->has_rrule = false;
+            b->rdate_count = 0;
+            b->offset_from = 0;
+            b->offset_to = 0;
+        }
+    } else if (ics_span_equals(prop->name, prop->name_len, "END")) {
+        if (b->in_observance && (ics_span_equals(v, len, "STANDARD") || ics_span_equals(v, len, "DAYLIGHT"))) {
+            builder_flush_observance(b);
+            b->in_observance = false;
+        }
+    } else if (!b->in_observance) {
+        if (ics_span_equals(prop->name, prop->name_len, "TZID")) {
+            b->zone->tzid_hash = ics_tz_hash(v, len);
+        }
+    } else if (ics_span_equals(prop->name, prop->name_len, "TZOFFSETFROM")) {
+        parse_ics_offset(v, len, &b->offset_from);
+    } else if (ics_span_equals(prop->name, prop->name_len, "TZOFFSETTO")) {
+        parse_ics_offset(v, len, &b->offset_to);
+    } else if (ics_span_equals(prop->name, prop->name_len, "DTSTART")) {
+        bool is_utc, is_date;
+        b->has_dtstart = ics_tz_parse_datetime(v, len, &b->dtstart, &is_utc, &is_date);
+    } else if (ics_span_equals(prop->name, prop->name_len, "RRULE")) {
+        parse_observance_rrule(b, v, len);
+    } else if (ics_span_equals(prop->name, prop->name_len, "RDATE")) {
+        const char *end = v + len;
+        while (v < end && b->rdate_count < sizeof(b->rdates) / sizeof(b->rdates[0])) {
+            const char *comma = memchr(v, ',', (size_t)(end - v));
+            const char *item_end = comma ? comma : end;
+            bool is_utc, is_date;
+            int64_t t;
+            if (ics_tz_parse_datetime(v, (size_t)(item_end - v), &t, &is_utc, &is_date)) {
+                b->rdates[b->rdate_count++] = t;
+            }
+            v = item_end + 1;
+        }
+    }
+}
+
+void ics_tz_builder_end(ics_tz_builder_t *b)
+{
+    if (!b->has_pre && b->zone->count > 0) {
+        b->zone->initial_offset = b->zone->transitions[0].offset_from;
+    }
+}
@@ -0,0 +1,150 @@
+#ifndef ICS_TZ_H
+#define ICS_TZ_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ics_tokenizer.h"
+
+/*
+ * Compiled time zones for ICS date-time conversion.
+ *
+ * A zone is compiled once per sync, either from a VTIMEZONE block streamed
+ * through the tokenizer or from a POSIX TZ string, into a short sorted table
+ * of UTC offset transitions covering a window of years. Converting an event
+ * time is then a binary search over that table and never touches the libc
+ * TZ environment.
+ *
+ * All times are 64-bit seconds. "Local" times are wall-clock times counted
+ * as if they were UTC, i.e. seconds since 1970-01-01T00:00:00 local.
+ */
+
+#define ICS_TZ_MAX_TRANSITIONS  16  // Two per year for an eight-year window
+#define ICS_TZ_MAX_ZONES        8   // VTIMEZONE blocks kept per sync
+
+/**
+ * @brief A change of UTC offset at a given instant.
+ */
+typedef struct {
+    int64_t utc;            // Instant the new offset takes effect
+    int32_t offset_from;    // Offset in seconds east of UTC before the change
+    int32_t offset_to;      // Offset in seconds east of UTC from this instant on
+} ics_tz_transition_t;
+
+/**
+ * @brief A compiled zone: a fixed offset plus sorted transitions.
+ */
+typedef struct {
+    uint32_t tzid_hash;     // ics_tz_hash() of the TZID, 0 for the built-in zone
+    int32_t initial_offset; // Offset before the first transition
+    uint8_t count;
+    bool overflow;          // Transitions were dropped because the table was full
+    ics_tz_transition_t transitions[ICS_TZ_MAX_TRANSITIONS];
+} ics_tz_zone_t;
+
+/**
+ * @brief Incremental VTIMEZONE compiler fed with tokenizer properties.
+ */
+typedef struct {
+    ics_tz_zone_t *zone;
+    int64_t window_start;   // Transitions before this only set the initial offset
+    int64_t window_end;     // Transitions after this are not generated
+    int64_t pre_utc;        // Latest transition before the window
+    bool has_pre;
+
+    // Current STANDARD or DAYLIGHT observance
+    bool in_observance;
+    int32_t offset_from;
+    int32_t offset_to;
+    int64_t dtstart;        // Local onset time
+    bool has_dtstart;
+    bool has_rrule;
+    int8_t rule_month;      // BYMONTH, 1-12
+    int8_t rule_weekday;    // BYDAY weekday, 0 = Sunday
+    int8_t rule_nth;        // BYDAY ordinal, negative counts from the end of the month
+    int8_t rule_monthday;   // First BYMONTHDAY, for rules written as BYMONTHDAY=8,...,14;BYDAY=SU
+    int64_t rule_until;     // UTC, INT64_MAX if unbounded
+    int64_t rdates[4];      // Local onset times listed in RDATE
+    uint8_t rdate_count;
+} ics_tz_builder_t;
+
+/**
+ * @brief Hashes a TZID (32-bit FNV-1a).
+ */
+uint32_t ics_tz_hash(const char *tzid, size_t len);
+
+/**
+ * @brief Parses an ICS DATE or DATE-TIME value.
+ *
+ * Accepts YYYYMMDD, YYYYMMDDTHHMMSS and YYYYMMDDTHHMMSSZ.
+ *
+ * @param[out] seconds Local time, or UTC if is_utc is set.
+ * @param[out] is_utc  Set if the value ends in 'Z'.
+ * @param[out] is_date Set if the value has no time part.
+ * @return true on success.
+ */
+bool ics_tz_parse_datetime(const char *value, size_t len, int64_t *seconds,
+                           bool *is_utc, bool *is_date);
+
+/**
+ * @brief Parses an ICS DURATION value, e.g. P1W, P2D, PT1H30M or P1DT12H.
+ *
+ * Days and weeks are nominal and kept apart from the exact hours, minutes
+ * and seconds, since a day across a DST change is not 24 hours.
+ *
+ * @param[out] days    Weeks and days, negative for a negative duration.
+ * @param[out] seconds Hours, minutes and seconds, with the same sign.
+ * @return true on success.
+ */
+bool ics_tz_parse_duration(const char *value, size_t len, int32_t *days, int32_t *seconds);
+
+/**
+ * @brief Returns the UTC offset of a zone at a UTC instant.
+ */
+int32_t ics_tz_offset_at(const ics_tz_zone_t *zone, int64_t utc);
+
+/**
+ * @brief Converts a local wall-clock time in a zone to UTC.
+ *
+ * Times inside a spring-forward gap resolve using the offset before the gap;
+ * ambiguous times after a fall-back resolve to the earlier instant.
+ */
+int64_t ics_tz_local_to_utc(const ics_tz_zone_t *zone, int64_t local);
+
+/**
+ * @brief Finds a compiled zone by TZID hash.
+ *
+ * @return The zone, or NULL if it is not in the list.
+ */
+const ics_tz_zone_t *ics_tz_find(const ics_tz_zone_t *zones, int count, uint32_t tzid_hash);
+
+/**
+ * @brief Compiles a POSIX TZ string such as "CST-8" or "EST5EDT,M3.2.0,M11.1.0".
+ *
+ * @param zone       Zone to fill.
+ * @param posix      TZ string.
+ * @param first_year First year for which transitions are generated.
+ * @param last_year  Last year for which transitions are generated.
+ * @return true on success, false if the string could not be parsed.
+ */
+bool ics_tz_compile_posix(ics_tz_zone_t *zone, const char *posix, int first_year, int last_year);
+
+/**
+ * @brief Starts compiling a VTIMEZONE block.
+ *
+ * Call after BEGIN:VTIMEZONE, then pass every property up to and including
+ * END:VTIMEZONE to ics_tz_builder_property().
+ */
+void ics_tz_builder_begin(ics_tz_builder_t *b, ics_tz_zone_t *zone, int first_year, int last_year);
+
+/**
+ * @brief Feeds one property of the VTIMEZONE block.
+ */
+void ics_tz_builder_property(ics_tz_builder_t *b, const ics_property_t *prop);
+
+/**
+ * @brief Finishes the block and fixes up the initial offset.
+ */
+void ics_tz_builder_end(ics_tz_builder_t *b);
+
+#endif // ICS_TZ_H
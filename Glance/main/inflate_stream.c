@@ -0,0 +1,568 @@
+#include "inflate_stream.h"
+#include <string.h>
+
+#define WINDOW_MASK     (INFLATE_STREAM_WINDOW_SIZE - 1)
+#define FAST_MASK       ((1u << INFLATE_STREAM_FAST_BITS) - 1)
+
+#define DECODE_NEED     -1      // More input is needed to decode the symbol
+#define DECODE_INVALID  -2      // No code matches the input
+
+#define GZIP_FHCRC      0x02
+#define GZIP_FEXTRA     0x04
+#define GZIP_FNAME      0x08
+#define GZIP_FCOMMENT   0x10
+
+enum {
+    STATE_GZIP_HEADER,
+    STATE_GZIP_EXTRA_LEN,
+    STATE_GZIP_EXTRA,
+    STATE_GZIP_NAME,
+    STATE_GZIP_COMMENT,
+    STATE_GZIP_HCRC,
+    STATE_ZLIB_HEADER,
+    STATE_BLOCK,
+    STATE_STORED_LEN,
+    STATE_STORED,
+    STATE_TABLE,
+    STATE_CODELENS,
+    STATE_LENS,
+    STATE_LENS_REPEAT,
+    STATE_LITLEN,
+    STATE_LENGTH_EXTRA,
+    STATE_DIST,
+    STATE_DIST_EXTRA,
+    STATE_TRAILER,
+    STATE_DONE,
+    STATE_ERROR,
+};
+
+static const uint16_t length_base[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258,
+};
+static const uint8_t length_extra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0,
+};
+static const uint16_t dist_base[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577,
+};
+static const uint8_t dist_extra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13,
+};
+
+// Order in which code length code lengths are sent
+static const uint8_t codelen_order[19] = {
+    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15,
+};
+
+// Tops up the bit buffer from the current chunk; returns true if n bits are available
+static bool need(inflate_stream_t *s, unsigned n)
+{
+    while (s->bitcnt <= 24 && s->in_pos < s->in_len) {
+        s->bitbuf |= (uint32_t)s->in[s->in_pos++] << s->bitcnt;
+        s->bitcnt += 8;
+    }
+    return s->bitcnt >= n;
+}
+
+static uint32_t bits(inflate_stream_t *s, unsigned n)
+{
+    uint32_t v = s->bitbuf & ((1u << n) - 1);
+    s->bitbuf >>= n;
+    s->bitcnt -= n;
+    return v;
+}
+
+static bool fail(inflate_stream_t *s, const char *error)
+{
+    s->error = error;
+    s->state = STATE_ERROR;
+    return false;
+}
+
+// Hands everything written since the last flush to the callback
+static bool flush(inflate_stream_t *s)
+{
+    uint32_t len = s->wpos - s->flushed;
+    if (len == 0) {
+        return true;
+    }
+    const char *start = (const char *)s->window + (s->flushed & WINDOW_MASK);
+    s->flushed = s->wpos;
+    s->bytes_out += len;
+    return s->on_output(start, len, s->ctx) || fail(s, "aborted");
+}
+
+// Spans never wrap: the window is flushed whenever writing reaches its end
+static bool put(inflate_stream_t *s, uint8_t c)
+{
+    s->window[s->wpos & WINDOW_MASK] = c;
+    s->wpos++;
+    if ((s->wpos & WINDOW_MASK) == 0) {
+        s->window_full = true;
+        return flush(s);
+    }
+    return true;
+}
+
+static bool build_code(inflate_stream_code_t *code, const uint8_t *lens, unsigned n)
+{
+    memset(code->count, 0, sizeof(code->count));
+    for (unsigned i = 0; i < n; i++) {
+        code->count[lens[i]]++;
+    }
+    code->count[0] = 0;
+
+    // Over-subscribed lengths cannot form a prefix code; incomplete ones are allowed
+    int left = 1;
+    for (int len = 1; len < 16; len++) {
+        left = (left << 1) - code->count[len];
+        if (left < 0) {
+            return false;
+        }
+    }
+
+    uint16_t offs[16];
+    offs[1] = 0;
+    for (int len = 1; len < 15; len++) {
+        offs[len + 1] = offs[len] + code->count[len];
+    }
+    for (unsigned i = 0; i < n; i++) {
+        if (lens[i] != 0) {
+            code->symbol[offs[lens[i]]++] = (uint16_t)i;
+        }
+    }
+
+    // Codes are sent MSB first, so the lookup is indexed by their bit-reversed value
+    memset(code->fast, 0, sizeof(code->fast));
+    unsigned next = 0;
+    unsigned index = 0;
+    for (unsigned len = 1; len <= INFLATE_STREAM_FAST_BITS; len++) {
+        for (unsigned k = 0; k < code->count[len]; k++, next++, index++) {
+            unsigned rev = 0;
+            for (unsigned b = 0; b < len; b++) {
+                rev |= ((next >> b) & 1u) << (len - 1 - b);
+            }
+            for (unsigned r = rev; r <= FAST_MASK; r += 1u << len) {
+                code->fast[r] = (uint16_t)(code->symbol[index] | len << 9);
+            }
+        }
+        next <<= 1;
+    }
+    return true;
+}
+
+// Decodes one symbol, consuming its bits only if it is complete
+static int decode(inflate_stream_t *s, const inflate_stream_code_t *code)
+{
+    need(s, 15);
+    uint16_t entry = code->fast[s->bitbuf & FAST_MASK];
+    if (entry != 0) {
+        unsigned len = entry >> 9;
+        if (len > s->bitcnt) {
+            return DECODE_NEED;
+        }
+        bits(s, len);
+        return entry & 0x1FF;
+    }
+
+    // Longer codes: walk the canonical code one bit at a time
+    uint32_t buf = s->bitbuf;
+    int value = 0;
+    int first = 0;
+    int index = 0;
+    for (unsigned len = 1; len < 16; len++) {
+        if (len > s->bitcnt) {
+            return DECODE_NEED;
+        }
+        value |= buf & 1u;
+        buf >>= 1;
+        int count = code->count[len];
+        if (value - count < first) {
+            bits(s, len);
+            return code->symbol[index + (value - first)];
+        }
+        index += count;
+        first = (first + count) << 1;
+        value <<= 1;
+    }
+    return DECODE_INVALID;
+}
+
+static void build_fixed(inflate_stream_t *s)
+{
+    uint8_t *lens = s->lens;
+    memset(lens, 8, 144);
+    memset(lens + 144, 9, 112);
+    memset(lens + 256, 7, 24);
+    memset(lens + 280, 8, 8);
+    build_code(&s->lencode, lens, 288);
+    memset(lens, 5, 30);
+    build_code(&s->distcode, lens, 30);
+}
+
+void inflate_stream_init(inflate_stream_t *s, inflate_stream_format_t format, uint8_t *window,
+                         inflate_stream_output_cb_t on_output, void *ctx)
+{
+    memset(s, 0, sizeof(*s));
+    s->format = format;
+    s->window = window;
+    s->on_output = on_output;
+    s->ctx = ctx;
+    s->state = format == INFLATE_STREAM_GZIP ? STATE_GZIP_HEADER
+             : format == INFLATE_STREAM_ZLIB ? STATE_ZLIB_HEADER
+             : STATE_BLOCK;
+    s->count = 10;
+}
+
+// Runs the state machine until the chunk is used up; false on error
+static bool run(inflate_stream_t *s)
+{
+    for (;;) {
+        switch (s->state) {
+        case STATE_GZIP_HEADER:
+            // ID1 ID2 CM FLG MTIME(4) XFL OS
+            while (s->count > 0) {
+                if (!need(s, 8)) {
+                    return true;
+                }
+                uint8_t b = (uint8_t)bits(s, 8);
+                unsigned i = 10 - s->count--;
+                if ((i == 0 && b != 0x1F) || (i == 1 && b != 0x8B) || (i == 2 && b != 8)) {
+                    return fail(s, "not a gzip stream");
+                }
+                if (i == 3) {
+                    s->gzip_flags = b;
+                }
+            }
+            s->count = 2;
+            s->state = STATE_GZIP_EXTRA_LEN;
+            break;
+
+        case STATE_GZIP_EXTRA_LEN:
+            if (s->gzip_flags & GZIP_FEXTRA) {
+                if (!need(s, 16)) {
+                    return true;
+                }
+                s->count = bits(s, 16);
+            } else {
+                s->count = 0;
+            }
+            s->state = STATE_GZIP_EXTRA;
+            break;
+
+        case STATE_GZIP_EXTRA:
+            while (s->count > 0) {
+                if (!need(s, 8)) {
+                    return true;
+                }
+                bits(s, 8);
+                s->count--;
+            }
+            s->state = STATE_GZIP_NAME;
+            break;
+
+        case STATE_GZIP_NAME:
+        case STATE_GZIP_COMMENT: {
+            uint8_t flag = s->state == STATE_GZIP_NAME ? GZIP_FNAME : GZIP_FCOMMENT;
+            if (s->gzip_flags & flag) {
+                // Zero-terminated
+                for (;;) {
+                    if (!need(s, 8)) {
+                        return true;
+                    }
+                    if (bits(s, 8) == 0) {
+                        break;
+                    }
+                }
+            }
+            s->state++;
+            break;
+        }
+
+        case STATE_GZIP_HCRC:
+            if (s->gzip_flags & GZIP_FHCRC) {
+                if (!need(s, 16)) {
+                    return true;
+                }
+                bits(s, 16);
+            }
+            s->state = STATE_BLOCK;
+            break;
+
+        case STATE_ZLIB_HEADER: {
+            if (!need(s, 16)) {
+                return true;
+            }
+            uint32_t cmf = bits(s, 8);
+            uint32_t flg = bits(s, 8);
+            if ((cmf & 0x0F) != 8 || (cmf >> 4) > 7 || (cmf << 8 | flg) % 31 != 0 || (flg & 0x20)) {
+                return fail(s, "not a zlib stream");
+            }
+            s->state = STATE_BLOCK;
+            break;
+        }
+
+        case STATE_BLOCK: {
+            if (s->last_block) {
+                s->bitbuf >>= s->bitcnt & 7; // The trailer starts on a byte boundary
+                s->bitcnt -= s->bitcnt & 7;
+                s->count = s->format == INFLATE_STREAM_GZIP ? 8 : s->format == INFLATE_STREAM_ZLIB ? 4 : 0;
+                s->state = STATE_TRAILER;
+                break;
+            }
+            if (!need(s, 3)) {
+                return true;
+            }
+            s->last_block = bits(s, 1);
+            uint32_t type = bits(s, 2);
+            if (type == 0) {
+                bits(s, s->bitcnt & 7);
+                s->state = STATE_STORED_LEN;
+            } else if (type == 1) {
+                build_fixed(s);
+                s->state = STATE_LITLEN;
+            } else if (type == 2) {
+                s->state = STATE_TABLE;
+            } else {
+                return fail(s, "invalid block type");
+            }
+            break;
+        }
+
+        case STATE_STORED_LEN: {
+            if (!need(s, 32)) {
+                return true;
+            }
+            uint32_t len = bits(s, 16);
+            uint32_t nlen = bits(s, 16);
+            if (len != (~nlen & 0xFFFF)) {
+                return fail(s, "stored block length mismatch");
+            }
+            s->count = len;
+            s->state = STATE_STORED;
+            break;
+        }
+
+        case STATE_STORED:
+            // Bytes already in the bit buffer first, then straight from the chunk
+            while (s->count > 0 && s->bitcnt >= 8) {
+                if (!put(s, (uint8_t)bits(s, 8))) {
+                    return false;
+                }
+                s->count--;
+            }
+            while (s->count > 0 && s->in_pos < s->in_len) {
+                size_t n = s->in_len - s->in_pos;
+                size_t room = INFLATE_STREAM_WINDOW_SIZE - (s->wpos & WINDOW_MASK);
+                n = n < s->count ? n : s->count;
+                n = n < room ? n : room;
+                memcpy(s->window + (s->wpos & WINDOW_MASK), s->in + s->in_pos, n);
+                s->in_pos += n;
+                s->count -= (uint32_t)n;
+                s->wpos += (uint32_t)n;
+                if ((s->wpos & WINDOW_MASK) == 0) {
+                    s->window_full = true;
+                    if (!flush(s)) {
+                        return false;
+                    }
+                }
+            }
+            if (s->count > 0) {
+                return true;
+            }
+            s->state = STATE_BLOCK;
+            break;
+
+        case STATE_TABLE:
+            if (!need(s, 14)) {
+                return true;
+            }
+            s->hlit = (uint16_t)(bits(s, 5) + 257);
+            s->hdist = (uint16_t)(bits(s, 5) + 1);
+            s->hclen = (uint16_t)(bits(s, 4) + 4);
+            if (s->hlit > 286 || s->hdist > 30) {
+                return fail(s, "too many length or distance codes");
+            }
+            memset(s->lens, 0, 19);
+            s->index = 0;
+            s->state = STATE_CODELENS;
+            break;
+
+        case STATE_CODELENS:
+            while (s->index < s->hclen) {
+                if (!need(s, 3)) {
+                    return true;
+                }
+                s->lens[codelen_order[s->index++]] = (uint8_t)bits(s, 3);
+            }
+            // The code length code is kept in lencode until the real one is built
+            if (!build_code(&s->lencode, s->lens, 19)) {
+                return fail(s, "invalid code length code");
+            }
+            s->index = 0;
+            s->state = STATE_LENS;
+            break;
+
+        case STATE_LENS:
+            while (s->index < s->hlit + s->hdist) {
+                int sym = decode(s, &s->lencode);
+                if (sym == DECODE_NEED) {
+                    return true;
+                }
+                if (sym < 0) {
+                    return fail(s, "invalid code length");
+                }
+                if (sym < 16) {
+                    s->lens[s->index++] = (uint8_t)sym;
+                } else {
+                    s->symbol = (uint16_t)sym;
+                    s->state = STATE_LENS_REPEAT;
+                    break;
+                }
+            }
+            if (s->state == STATE_LENS_REPEAT) {
+                break;
+            }
+            if (s->lens[256] == 0) {
+                return fail(s, "no end-of-block code");
+            }
+            if (!build_code(&s->lencode, s->lens, s->hlit) ||
+                !build_code(&s->distcode, s->lens + s->hlit, s->hdist)) {
+                return fail(s, "invalid literal/length or distance code");
+            }
+            s->state = STATE_LITLEN;
+            break;
+
+        case STATE_LENS_REPEAT: {
+            // 16: copy the previous length 3-6 times, 17: 3-10 zeros, 18: 11-138 zeros
+            unsigned extra = s->symbol == 16 ? 2 : s->symbol == 17 ? 3 : 7;
+            if (!need(s, extra)) {
+                return true;
+            }
+            unsigned repeat = bits(s, extra) + (s->symbol == 18 ? 11 : 3);
+            uint8_t len = 0;
+            if (s->symbol == 16) {
+                if (s->index == 0) {
+                    return fail(s, "repeat with no previous length");
+                }
+                len = s->lens[s->index - 1];
+            }
+            if (s->index + repeat > (unsigned)(s->hlit + s->hdist)) {
+                return fail(s, "too many code lengths");
+            }
+            memset(s->lens + s->index, len, repeat);
+            s->index += (uint16_t)repeat;
+            s->state = STATE_LENS;
+            break;
+        }
+
+        case STATE_LITLEN:
+            // Literals are the bulk of the work, so they stay in this loop
+            for (;;) {
+                int sym = decode(s, &s->lencode);
+                if (sym == DECODE_NEED) {
+                    return true;
+                }
+                if (sym < 0) {
+                    return fail(s, "invalid literal/length code");
+                }
+                if (sym < 256) {
+                    if (!put(s, (uint8_t)sym)) {
+                        return false;
+                    }
+                    continue;
+                }
+                if (sym == 256) {
+                    s->state = STATE_BLOCK;
+                } else if (sym - 257 < 29) {
+                    s->symbol = (uint16_t)(sym - 257);
+                    s->state = STATE_LENGTH_EXTRA;
+                } else {
+                    return fail(s, "invalid length symbol");
+                }
+                break;
+            }
+            break;
+
+        case STATE_LENGTH_EXTRA:
+            if (!need(s, length_extra[s->symbol])) {
+                return true;
+            }
+            s->length = (uint16_t)(length_base[s->symbol] + bits(s, length_extra[s->symbol]));
+            s->state = STATE_DIST;
+            break;
+
+        case STATE_DIST: {
+            int sym = decode(s, &s->distcode);
+            if (sym == DECODE_NEED) {
+                return true;
+            }
+            if (sym < 0 || sym >= 30) {
+                return fail(s, "invalid distance code");
+            }
+            s->symbol = (uint16_t)sym;
+            s->state = STATE_DIST_EXTRA;
+            break;
+        }
+
+        case STATE_DIST_EXTRA: {
+            if (!need(s, dist_extra[s->symbol])) {
+                return true;
+            }
+            uint32_t dist = dist_base[s->symbol] + bits(s, dist_extra[s->symbol]);
+            if (!s->window_full && dist > s->wpos) {
+                return fail(s, "distance too far back");
+            }
+            for (unsigned i = 0; i < s->length; i++) {
+                if (!put(s, s->window[(s->wpos - dist) & WINDOW_MASK])) {
+                    return false;
+                }
+            }
+            s->state = STATE_LITLEN;
+            break;
+        }
+
+        case STATE_TRAILER:
+            // gzip: CRC-32 then ISIZE; zlib: Adler-32. Only ISIZE is checked.
+            while (s->count > 0) {
+                if (!need(s, 8)) {
+                    return true;
+                }
+                s->trailer = s->trailer >> 8 | bits(s, 8) << 24;
+                s->count--;
+            }
+            if (s->format == INFLATE_STREAM_GZIP && s->trailer != s->wpos) {
+                return fail(s, "length mismatch");
+            }
+            s->state = STATE_DONE;
+            break;
+
+        case STATE_DONE:
+            return true;
+
+        default:
+            return false;
+        }
+    }
+}
+
+bool inflate_stream_feed(inflate_stream_t *s, const void *data, size_t len)
+{
+    if (s->state == STATE_ERROR) {
+        return false;
+    }
+    s->in = data;
+    s->in_len = len;
+    s->in_pos = 0;
+    s->bytes_in += len;
+    bool ok = run(s);
+    s->in = NULL;
+    return ok && flush(s);
+}
+
+bool inflate_stream_done(const inflate_stream_t *s)
+{
+    return s->state == STATE_DONE;
+}
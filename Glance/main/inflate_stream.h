@@ -0,0 +1,111 @@
+#ifndef INFLATE_STREAM_H
+#define INFLATE_STREAM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Streaming DEFLATE decoder (RFC 1951) for gzip (RFC 1952) and zlib
+ * (RFC 1950) encoded HTTP bodies.
+ *
+ * Input is pushed in chunks of any size as they arrive; decoding stops at the
+ * end of a chunk, even mid-symbol, and resumes with the next one, so the
+ * compressed body is never buffered. Output is written into the 32 KB history
+ * window that back-references need anyway and handed to a callback in spans,
+ * so there is no separate output buffer either. The window is caller-provided
+ * and may live in PSRAM.
+ *
+ * Checksums in the gzip and zlib trailers are not verified; the gzip length
+ * is. Bodies arrive over TLS, which already guards their integrity.
+ */
+
+#define INFLATE_STREAM_WINDOW_SIZE  32768   // The largest distance DEFLATE can refer back
+#define INFLATE_STREAM_FAST_BITS    9       // Codes up to this long decode with one table lookup
+
+typedef enum {
+    INFLATE_STREAM_GZIP,
+    INFLATE_STREAM_ZLIB,
+    INFLATE_STREAM_RAW,
+} inflate_stream_format_t;
+
+/**
+ * @brief Receives decoded bytes. The span is only valid during the call.
+ *
+ * @return true to continue decoding, false to abort.
+ */
+typedef bool (*inflate_stream_output_cb_t)(const char *data, size_t len, void *ctx);
+
+/**
+ * @brief A canonical Huffman code.
+ */
+typedef struct {
+    uint16_t fast[1 << INFLATE_STREAM_FAST_BITS];  // Symbol | length << 9, 0 for longer codes
+    uint16_t count[16];                             // Number of codes of each length
+    uint16_t symbol[288];                           // Symbols in code order
+} inflate_stream_code_t;
+
+/**
+ * @brief Decoder state. Treat as opaque apart from the statistics.
+ */
+typedef struct {
+    inflate_stream_format_t format;
+    inflate_stream_output_cb_t on_output;
+    void *ctx;
+
+    uint8_t state;
+    bool last_block;
+    uint32_t bitbuf;            // Input bits not yet consumed, LSB first
+    uint8_t bitcnt;
+    const uint8_t *in;          // Chunk being decoded
+    size_t in_len;
+    size_t in_pos;
+
+    uint8_t gzip_flags;
+    uint32_t count;             // Bytes left in the current header, stored block or trailer field
+    uint32_t trailer;
+    uint16_t hlit, hdist, hclen, index;
+    uint16_t symbol;            // Length or repeat symbol awaiting its extra bits
+    uint16_t length;            // Match length awaiting its distance
+    uint8_t lens[286 + 30];
+    inflate_stream_code_t lencode;
+    inflate_stream_code_t distcode;
+
+    uint8_t *window;
+    uint32_t wpos;              // Total bytes written to the window
+    uint32_t flushed;           // Total bytes handed to on_output
+    bool window_full;           // Back-references may reach the whole window
+
+    const char *error;          // Reason decoding failed, NULL otherwise
+
+    // Statistics
+    size_t bytes_in;
+    size_t bytes_out;
+} inflate_stream_t;
+
+/**
+ * @brief Prepares a decoder for one compressed stream.
+ *
+ * @param s         Decoder to initialize.
+ * @param format    Wrapper around the DEFLATE data.
+ * @param window    INFLATE_STREAM_WINDOW_SIZE bytes of history, e.g. in PSRAM.
+ * @param on_output Called with the decoded bytes.
+ * @param ctx       Passed to on_output.
+ */
+void inflate_stream_init(inflate_stream_t *s, inflate_stream_format_t format, uint8_t *window,
+                         inflate_stream_output_cb_t on_output, void *ctx);
+
+/**
+ * @brief Decodes the next chunk of the stream. Bytes after the end of the
+ * stream are ignored.
+ *
+ * @return false once the stream is found to be corrupt or the callback aborted.
+ */
+bool inflate_stream_feed(inflate_stream_t *s, const void *data, size_t len);
+
+/**
+ * @brief true once the whole stream, trailer included, has been decoded.
+ */
+bool inflate_stream_done(const inflate_stream_t *s);
+
+#endif // INFLATE_STREAM_H
@@ -0,0 +1,269 @@
+#include "json_extract.h"
+#include <string.h>
+
+enum {
+    STATE_VALUE,        // Between tokens: whitespace and structure
+    STATE_KEY,          // Key of a top-level member
+    STATE_STRING,       // String value, emitted if selected
+    STATE_ESCAPE,       // After '\' in a key or string
+    STATE_HEX,          // Digits of a \u escape
+    STATE_LITERAL,      // Number, true, false or null
+};
+
+static bool emit(json_extract_t *x, const char *data, size_t len)
+{
+    if (len == 0 || x->member < 0 || x->aborted) {
+        return !x->aborted;
+    }
+    if (!x->on_value(x->member, data, len, x->ctx)) {
+        x->aborted = true;
+    }
+    return !x->aborted;
+}
+
+// Appends decoded characters to the key being read, or emits them from a string value
+static void put(json_extract_t *x, const char *data, size_t len)
+{
+    if (x->return_state != STATE_KEY) {
+        emit(x, data, len);
+        return;
+    }
+    for (size_t i = 0; i < len; i++) {
+        if (x->key_len < JSON_EXTRACT_KEY_MAX) {
+            x->key[x->key_len] = data[i];
+        }
+        if (x->key_len < 255) {
+            x->key_len++;
+        }
+    }
+}
+
+// Index of the selected member with the key just read, -1 if none
+static int find_key(const json_extract_t *x)
+{
+    if (x->key_len > JSON_EXTRACT_KEY_MAX) {
+        return -1;
+    }
+    for (int i = 0; x->keys[i] != NULL; i++) {
+        if (strlen(x->keys[i]) == x->key_len && memcmp(x->keys[i], x->key, x->key_len) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void end_value(json_extract_t *x)
+{
+    if (x->member >= 0) {
+        x->values++;
+        if (!x->on_value(x->member, NULL, 0, x->ctx)) {
+            x->aborted = true;
+        }
+        x->member = -1;
+    }
+    x->state = STATE_VALUE;
+}
+
+static void put_code_point(json_extract_t *x, uint32_t cp)
+{
+    char utf8[4];
+    size_t n;
+    if (cp < 0x80) {
+        utf8[0] = (char)cp;
+        n = 1;
+    } else if (cp < 0x800) {
+        utf8[0] = (char)(0xC0 | cp >> 6);
+        utf8[1] = (char)(0x80 | (cp & 0x3F));
+        n = 2;
+    } else if (cp < 0x10000) {
+        utf8[0] = (char)(0xE0 | cp >> 12);
+        utf8[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        utf8[2] = (char)(0x80 | (cp & 0x3F));
+        n = 3;
+    } else {
+        utf8[0] = (char)(0xF0 | cp >> 18);
+        utf8[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+        utf8[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        utf8[3] = (char)(0x80 | (cp & 0x3F));
+        n = 4;
+    }
+    put(x, utf8, n);
+}
+
+// A high surrogate not followed by its low half stands for nothing valid
+static void flush_surrogate(json_extract_t *x)
+{
+    if (x->high_surrogate != 0) {
+        x->high_surrogate = 0;
+        put_code_point(x, 0xFFFD);
+    }
+}
+
+static void end_hex(json_extract_t *x)
+{
+    uint32_t cp = 0;
+    for (int i = 0; i < 4; i++) {
+        char c = x->hex[i];
+        cp = cp << 4 | (uint32_t)(c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10);
+    }
+    if (cp >= 0xDC00 && cp <= 0xDFFF && x->high_surrogate != 0) {
+        cp = 0x10000 + ((uint32_t)(x->high_surrogate - 0xD800) << 10) + (cp - 0xDC00);
+        x->high_surrogate = 0;
+    } else {
+        flush_surrogate(x);
+        if (cp >= 0xD800 && cp <= 0xDBFF) {
+            x->high_surrogate = (uint16_t)cp;
+            return;
+        }
+        if (cp >= 0xDC00 && cp <= 0xDFFF) {
+            cp = 0xFFFD;
+        }
+    }
+    put_code_point(x, cp);
+}
+
+void json_extract_init(json_extract_t *x, const char *const *keys, json_extract_cb_t on_value, void *ctx)
+{
+    memset(x, 0, sizeof(*x));
+    x->keys = keys;
+    x->on_value = on_value;
+    x->ctx = ctx;
+    x->state = STATE_VALUE;
+    x->member = -1;
+    x->key_member = -1;
+}
+
+bool json_extract_feed(json_extract_t *x, const char *data, size_t len)
+{
+    const char *p = data;
+    const char *end = data + len;
+    x->bytes_in += len;
+
+    while (p < end && !x->aborted) {
+        switch (x->state) {
+        case STATE_VALUE: {
+            char c = *p++;
+            if (c == '"') {
+                if (x->depth == 1 && x->expect_key) {
+                    x->expect_key = false;
+                    x->key_len = 0;
+                    x->state = x->return_state = STATE_KEY;
+                } else {
+                    x->member = x->depth == 1 ? x->key_member : -1;
+                    x->key_member = -1;
+                    x->state = x->return_state = STATE_STRING;
+                }
+            } else if (c == '{' || c == '[') {
+                if (x->depth == 0) {
+                    x->object = c == '{';
+                    x->expect_key = x->object;
+                }
+                x->key_member = -1; // Objects and arrays are never passed on
+                if (x->depth < UINT16_MAX) {
+                    x->depth++;
+                }
+            } else if (c == '}' || c == ']') {
+                if (x->depth > 0) {
+                    x->depth--;
+                }
+            } else if (c == ',') {
+                x->expect_key = x->depth == 1 && x->object;
+            } else if (c != ':' && c != ' ' && c != '\t' && c != '\r' && c != '\n') {
+                x->member = x->depth == 1 ? x->key_member : -1;
+                x->key_member = -1;
+                x->state = STATE_LITERAL;
+                p--; // The first character is part of the value
+            }
+            break;
+        }
+
+        case STATE_KEY:
+        case STATE_STRING: {
+            // Runs without escapes are passed on without copying
+            const char *run = p;
+            while (p < end && *p != '"' && *p != '\\') {
+                p++;
+            }
+            if (p > run) {
+                flush_surrogate(x);
+                put(x, run, (size_t)(p - run));
+            }
+            if (p == end) {
+                break;
+            }
+            if (*p++ == '\\') {
+                x->state = STATE_ESCAPE;
+                break;
+            }
+            flush_surrogate(x);
+            if (x->state == STATE_KEY) {
+                x->key_member = find_key(x);
+                x->state = STATE_VALUE;
+            } else {
+                end_value(x);
+            }
+            x->return_state = STATE_VALUE;
+            break;
+        }
+
+        case STATE_ESCAPE: {
+            static const char from[] = "bfnrt";
+            static const char to[] = "\b\f\n\r\t";
+            char c = *p++;
+            if (c == 'u') {
+                x->hex_len = 0;
+                x->state = STATE_HEX;
+                break;
+            }
+            flush_surrogate(x);
+            const char *simple = memchr(from, c, sizeof(from) - 1);
+            put(x, simple ? &to[simple - from] : &c, 1); // '"', '\' and '/' stand for themselves
+            x->state = x->return_state;
+            break;
+        }
+
+        case STATE_HEX: {
+            char c = *p;
+            if ((c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'f')) {
+                x->hex[x->hex_len++] = c;
+                p++;
+                if (x->hex_len == 4) {
+                    end_hex(x);
+                    x->state = x->return_state;
+                }
+            } else {
+                // Not an escape after all; re-examine this character in the string
+                flush_surrogate(x);
+                put_code_point(x, 0xFFFD);
+                x->state = x->return_state;
+            }
+            break;
+        }
+
+        case STATE_LITERAL: {
+            const char *run = p;
+            while (p < end && *p != ',' && *p != '}' && *p != ']' &&
+                   *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n') {
+                p++;
+            }
+            emit(x, run, (size_t)(p - run));
+            if (p < end) {
+                end_value(x); // The delimiter is handled between tokens
+            }
+            break;
+        }
+
+        default:
+            return false;
+        }
+    }
+    return !x->aborted;
+}
+
+bool json_extract_finish(json_extract_t *x)
+{
+    if (x->state == STATE_LITERAL && !x->aborted) {
+        end_value(x);
+    }
+    return !x->aborted;
+}
@@ -0,0 +1,85 @@
+#ifndef JSON_EXTRACT_H
+#define JSON_EXTRACT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Streaming extractor for selected members of a JSON object, such as the
+ * timezone and offset of a geolocation response.
+ *
+ * Only the members of the top-level object are matched, by exact key; nested
+ * objects and arrays are skipped whole. The document is pushed in chunks of
+ * any size and is never buffered: plain string runs are passed on straight
+ * from the chunk, and only escapes are decoded along the way. Numbers, true,
+ * false and null are passed on as they are written. This is not a validating
+ * parser; it assumes well-formed input.
+ */
+
+#define JSON_EXTRACT_KEY_MAX    32  // Longer keys never match
+
+/**
+ * @brief Receives the value of a selected member.
+ *
+ * Called any number of times per value with consecutive pieces of it, then
+ * once with data == NULL when the value ends. Object and array values are
+ * not passed on.
+ *
+ * @param member Index of the member's key in the list given to init.
+ * @return true to continue, false to abort.
+ */
+typedef bool (*json_extract_cb_t)(int member, const char *data, size_t len, void *ctx);
+
+/**
+ * @brief Extractor state. Treat as opaque apart from the statistics.
+ */
+typedef struct {
+    const char *const *keys;    // NULL-terminated member keys to extract
+    json_extract_cb_t on_value;
+    void *ctx;
+
+    uint8_t state;
+    uint8_t return_state;       // State to go back to after an escape
+    uint16_t depth;             // Nesting of objects and arrays
+    bool object;                // The document is an object
+    bool expect_key;            // The next string at depth 1 is a key
+    int member;                 // Selected member whose value is being read, -1 outside
+    int key_member;             // Selected member named by the key just read
+    char key[JSON_EXTRACT_KEY_MAX];
+    uint8_t key_len;
+    char hex[4];                // Digits of a \u escape
+    uint8_t hex_len;
+    uint16_t high_surrogate;    // First half of a \u pair, 0 if none
+    bool aborted;
+
+    // Statistics
+    size_t bytes_in;
+    uint32_t values;
+} json_extract_t;
+
+/**
+ * @brief Prepares an extractor for one document.
+ *
+ * @param x        Extractor to initialize.
+ * @param keys     NULL-terminated list of member keys to extract.
+ * @param on_value Called with the values of the selected members.
+ * @param ctx      Passed to on_value.
+ */
+void json_extract_init(json_extract_t *x, const char *const *keys, json_extract_cb_t on_value, void *ctx);
+
+/**
+ * @brief Processes the next chunk of the document.
+ *
+ * @return false if the callback aborted.
+ */
+bool json_extract_feed(json_extract_t *x, const char *data, size_t len);
+
+/**
+ * @brief Ends the document, completing a number that was still being read.
+ *
+ * @return false if the callback aborted.
+ */
+bool json_extract_finish(json_extract_t *x);
+
+#endif // JSON_EXTRACT_H
@@ -0,0 +1,155 @@
+#include "lunar_calendar.h"
+#include "civil_time.h"
+#include "lunar_table.h"
+
+#include <stdio.h>
+
+#define MONTH_LENGTHS(word) ((word) & 0x1FFF)
+#define LEAP_MONTH(word)    ((int)((word) >> 13 & 0xF))
+#define NEW_YEAR_DAY(word)  ((int)((word) >> 17 & 0x3F))
+#define QINGMING_DAY(word)  (4 + (int)((word) >> 23 & 0x3))
+
+// Day number of the lunar New Year in a Gregorian year
+static int64_t new_year_of(int year)
+{
+    return civil_days_from_date(year, 1, 1) + NEW_YEAR_DAY(lunar_years[year - LUNAR_TABLE_FIRST_YEAR]);
+}
+
+// Days from New Year to the start of the index-th month, leap month included
+static int month_start(uint32_t lengths, int index)
+{
+    return 29 * index + __builtin_popcount(lengths & ((1u << index) - 1));
+}
+
+bool lunar_date_from_days(int64_t day, lunar_date_t *out)
+{
+    int32_t y;
+    int8_t m, d;
+    civil_date_from_days(day, &y, &m, &d);
+    if (y < LUNAR_FIRST_YEAR || y > LUNAR_LAST_YEAR) {
+        return false;
+    }
+    if (day < new_year_of(y)) {
+        y--;
+    }
+    uint32_t word = lunar_years[y - LUNAR_TABLE_FIRST_YEAR];
+    uint32_t lengths = MONTH_LENGTHS(word);
+    int offset = (int)(day - new_year_of(y));
+
+    // Months are 29 or 30 days, so offset / 29 is the month or one past it
+    int index = offset / 29;
+    if (month_start(lengths, index) > offset) {
+        index--;
+    }
+    int leap = LEAP_MONTH(word);
+    out->year = (int16_t)y;
+    out->month = (int8_t)(leap != 0 && index >= leap ? index : index + 1);
+    out->leap = leap != 0 && index == leap;
+    out->day = (int8_t)(offset - month_start(lengths, index) + 1);
+    out->month_long = lengths >> index & 1;
+    return true;
+}
+
+void lunar_day_label(const lunar_date_t *date, char *buf, size_t len)
+{
+    static const char *const digits[] = {"", "一", "二", "三", "四", "五", "六", "七", "八", "九", "十"};
+    static const char *const months[] = {"", "正", "二", "三", "四", "五", "六", "七", "八", "九", "十", "十一", "十二"};
+
+    if (date->day == 1) {
+        snprintf(buf, len, "%s%s月", date->leap ? "閏" : "", months[date->month]);
+    } else if (date->day <= 10) {
+        snprintf(buf, len, "初%s", digits[date->day]);
+    } else if (date->day < 20) {
+        snprintf(buf, len, "十%s", digits[date->day - 10]);
+    } else if (date->day == 20) {
+        snprintf(buf, len, "二十");
+    } else if (date->day < 30) {
+        snprintf(buf, len, "廿%s", digits[date->day - 20]);
+    } else {
+        snprintf(buf, len, "三十");
+    }
+}
+
+bool taiwan_is_day_off(int64_t day)
+{
+    int32_t y;
+    int8_t m, d;
+    civil_date_from_days(day, &y, &m, &d);
+    if (y < HOLIDAY_TABLE_FIRST_YEAR || y >= HOLIDAY_TABLE_FIRST_YEAR + HOLIDAY_TABLE_YEARS) {
+        return false;
+    }
+    int doy = civil_day_of_year(y, m, d);
+    return holiday_bits[y - HOLIDAY_TABLE_FIRST_YEAR][doy / 8] >> (doy % 8) & 1;
+}
+
+taiwan_holiday_t taiwan_holiday(int64_t day)
+{
+    int32_t y;
+    int8_t m, d;
+    civil_date_from_days(day, &y, &m, &d);
+    lunar_date_t lunar;
+    if (!lunar_date_from_days(day, &lunar)) {
+        return TAIWAN_HOLIDAY_NONE;
+    }
+
+    static const struct {
+        int8_t month, day;
+        taiwan_holiday_t holiday;
+    } fixed[] = {
+        {1, 1, TAIWAN_HOLIDAY_FOUNDING_DAY},
+        {2, 28, TAIWAN_HOLIDAY_PEACE_MEMORIAL_DAY},
+        {4, 4, TAIWAN_HOLIDAY_CHILDRENS_DAY},
+        {5, 1, TAIWAN_HOLIDAY_LABOUR_DAY},
+        {9, 28, TAIWAN_HOLIDAY_TEACHERS_DAY},
+        {10, 10, TAIWAN_HOLIDAY_NATIONAL_DAY},
+        {10, 25, TAIWAN_HOLIDAY_RETROCESSION_DAY},
+        {12, 25, TAIWAN_HOLIDAY_CONSTITUTION_DAY},
+    };
+    for (size_t i = 0; i < sizeof(fixed) / sizeof(fixed[0]); i++) {
+        if (fixed[i].month == m && fixed[i].day == d) {
+            return fixed[i].holiday;
+        }
+    }
+    if (m == 4 && d == QINGMING_DAY(lunar_years[y - LUNAR_TABLE_FIRST_YEAR])) {
+        return TAIWAN_HOLIDAY_TOMB_SWEEPING_DAY;
+    }
+    if (!lunar.leap) {
+        if (lunar.month == 1 && lunar.day <= 3) {
+            return TAIWAN_HOLIDAY_LUNAR_NEW_YEAR;
+        }
+        if (lunar.month == 5 && lunar.day == 5) {
+            return TAIWAN_HOLIDAY_DRAGON_BOAT;
+        }
+        if (lunar.month == 8 && lunar.day == 15) {
+            return TAIWAN_HOLIDAY_MID_AUTUMN;
+        }
+    }
+    // The last two days of the year; a leap twelfth month would come last
+    bool last_month = LEAP_MONTH(lunar_years[lunar.year - LUNAR_TABLE_FIRST_YEAR]) == 12 ? lunar.leap : !lunar.leap;
+    if (lunar.month == 12 && last_month && lunar.day >= 28 + lunar.month_long) {
+        return TAIWAN_HOLIDAY_LUNAR_NEW_YEAR_EVE;
+    }
+    return taiwan_is_day_off(day) ? TAIWAN_HOLIDAY_MAKE_UP : TAIWAN_HOLIDAY_NONE;
+}
+
+const char *taiwan_holiday_name(taiwan_holiday_t holiday)
+{
+    static const char *const names[] = {
+        [TAIWAN_HOLIDAY_NONE] = "",
+        [TAIWAN_HOLIDAY_FOUNDING_DAY] = "開國紀念日",
+        [TAIWAN_HOLIDAY_LUNAR_NEW_YEAR_EVE] = "除夕",
+        [TAIWAN_HOLIDAY_LUNAR_NEW_YEAR] = "春節",
+        [TAIWAN_HOLIDAY_PEACE_MEMORIAL_DAY] = "和平紀念日",
+        [TAIWAN_HOLIDAY_CHILDRENS_DAY] = "兒童節",
+        [TAIWAN_HOLIDAY_TOMB_SWEEPING_DAY] = "清明節",
+        [TAIWAN_HOLIDAY_LABOUR_DAY] = "勞動節",
+        [TAIWAN_HOLIDAY_DRAGON_BOAT] = "端午節",
+        [TAIWAN_HOLIDAY_TEACHERS_DAY] = "教師節",
+        [TAIWAN_HOLIDAY_MID_AUTUMN] = "中秋節",
+        [TAIWAN_HOLIDAY_NATIONAL_DAY] = "國慶日",
+        [TAIWAN_HOLIDAY_RETROCESSION_DAY] = "光復節",
+        [TAIWAN_HOLIDAY_CONSTITUTION_DAY] = "行憲紀念日",
+        [TAIWAN_HOLIDAY_MAKE_UP] = "補假",
+    };
+    return (unsigned)holiday < sizeof(names) / sizeof(names[0]) ? names[holiday] : "";
+}
@@ -0,0 +1,87 @@
+#ifndef LUNAR_CALENDAR_H
+#define LUNAR_CALENDAR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Chinese lunar dates and Taiwan public holidays for the day cells of the
+ * display, from 1970 to 2100.
+ *
+ * Nothing is computed astronomically on the device. lunar_table.h, generated
+ * by playground/lunar_table_tool, packs each lunar year into 4 bytes (month
+ * lengths, leap month, New Year and Qingming) and the days off of each year
+ * into a 366-bit set. A lookup from a day number is a table read and a few
+ * bit operations.
+ *
+ * Days are counted from 1970-01-01, as in civil_time.h.
+ */
+
+#define LUNAR_FIRST_YEAR    1970
+#define LUNAR_LAST_YEAR     2100
+
+/**
+ * @brief A date in the lunar calendar.
+ */
+typedef struct {
+    int16_t year;       // Gregorian year the lunar year begins in
+    int8_t month;       // 1-12
+    int8_t day;         // 1-30
+    bool leap;          // In the leap month that follows month
+    bool month_long;    // The month has 30 days
+} lunar_date_t;
+
+/**
+ * @brief Festivals and memorial days that are public holidays in Taiwan.
+ */
+typedef enum {
+    TAIWAN_HOLIDAY_NONE,
+    TAIWAN_HOLIDAY_FOUNDING_DAY,        // January 1
+    TAIWAN_HOLIDAY_LUNAR_NEW_YEAR_EVE,  // The last day of the lunar year and the day before it
+    TAIWAN_HOLIDAY_LUNAR_NEW_YEAR,      // First to third of the first lunar month
+    TAIWAN_HOLIDAY_PEACE_MEMORIAL_DAY,  // February 28
+    TAIWAN_HOLIDAY_CHILDRENS_DAY,       // April 4
+    TAIWAN_HOLIDAY_TOMB_SWEEPING_DAY,   // Qingming
+    TAIWAN_HOLIDAY_LABOUR_DAY,          // May 1
+    TAIWAN_HOLIDAY_DRAGON_BOAT,         // Fifth of the fifth lunar month
+    TAIWAN_HOLIDAY_TEACHERS_DAY,        // September 28
+    TAIWAN_HOLIDAY_MID_AUTUMN,          // Fifteenth of the eighth lunar month
+    TAIWAN_HOLIDAY_NATIONAL_DAY,        // October 10
+    TAIWAN_HOLIDAY_RETROCESSION_DAY,    // October 25
+    TAIWAN_HOLIDAY_CONSTITUTION_DAY,    // December 25
+    TAIWAN_HOLIDAY_MAKE_UP,             // Day off for a holiday on a weekend or shared with another
+} taiwan_holiday_t;
+
+/**
+ * @brief Converts a day number to its lunar date.
+ *
+ * @return false outside 1970-2100.
+ */
+bool lunar_date_from_days(int64_t day, lunar_date_t *out);
+
+/**
+ * @brief Writes the label of a day cell: the month name on the first day of
+ * a month (e.g. "閏六月"), the day name otherwise (e.g. "初八", "廿三").
+ */
+void lunar_day_label(const lunar_date_t *date, char *buf, size_t len);
+
+/**
+ * @brief true if the day is a public holiday or a make-up day off.
+ *
+ * Weekends are not included, nor the extra bridge days that are announced
+ * year by year.
+ */
+bool taiwan_is_day_off(int64_t day);
+
+/**
+ * @brief The holiday a day is, TAIWAN_HOLIDAY_NONE if it is a normal day.
+ */
+taiwan_holiday_t taiwan_holiday(int64_t day);
+
+/**
+ * @brief Short name of a holiday in Traditional Chinese, e.g. "中秋節"; "" for none.
+ */
+const char *taiwan_holiday_name(taiwan_holiday_t holiday);
+
+#endif // LUNAR_CALENDAR_H
@@ -0,0 +1,174 @@
+// Generated by playground/lunar_table_tool/lunar_table.c. Do not edit.
+#ifndef LUNAR_TABLE_H
+#define LUNAR_TABLE_H
+
+#include <stdint.h>
+
+#define LUNAR_TABLE_FIRST_YEAR  1969   // Gregorian year of the first lunar New Year
+#define LUNAR_TABLE_YEARS       132
+#define HOLIDAY_TABLE_FIRST_YEAR 1970
+#define HOLIDAY_TABLE_YEARS     131
+
+/*
+ * Lunar year starting in each Gregorian year:
+ *   bits 0-12   month lengths in order, leap month included; 1 = 30 days
+ *   bits 13-16  leap month: it follows this month, 0 if none
+ *   bits 17-22  New Year as the zero-based day of the Gregorian year
+ *   bits 23-24  Qingming in April of the Gregorian year, minus 4
+ */
+static const uint32_t lunar_years[LUNAR_TABLE_YEARS] = {
+    0x0de056a, 0x0c80b69, 0x0b4b752, 0x0da0b52, 0x0c20b25, 0x0ac964b, 0x0d20a4b, 0x03d14ab,
+    0x0e002ad, 0x0ca056d, 0x0b6cb69, 0x05c0da9, 0x0c60d92, 0x0b09d25, 0x0d60d25, 0x0415a4d,
+    0x0e40a56, 0x0ce02b6, 0x0b8e5b5, 0x05e06d5, 0x0c80ea9, 0x0b4be92, 0x0da0e92, 0x0440d26,
+    0x0ac6a56, 0x0d00a57, 0x0bd14d6, 0x062035a, 0x0ca06d5, 0x0b6b6c9, 0x0dc0749, 0x0460693,
+    0x0ae952b, 0x0d4052b, 0x0be0a5b, 0x02a555a, 0x0ce056a, 0x0b8fb55, 0x0e00ba4, 0x04a0b49,
+    0x032ba93, 0x0d80a95, 0x0c2052d, 0x02c8aad, 0x0500ab5, 0x0bd35aa, 0x0e205d2, 0x04c0da5,
+    0x036dd4a, 0x0dc0d4a, 0x0c60c95, 0x030952e, 0x0540556, 0x0be0ab5, 0x0aa55b2, 0x05006d2,
+    0x038cea5, 0x0de0725, 0x0c8064b, 0x032ac97, 0x0560cab, 0x0c2055a, 0x0ac6ad6, 0x0520b69,
+    0x03d7752, 0x0e20b52, 0x0cc0b25, 0x036da4b, 0x05a0a4b, 0x0c404ab, 0x0aea55b, 0x05405ad,
+    0x03e0b6a, 0x02a5b52, 0x0d00d92, 0x03afd25, 0x05e0d25, 0x0480a55, 0x0b2b4ad, 0x05804b6,
+    0x04005b5, 0x02c6daa, 0x0d20ec9, 0x03f1e92, 0x0620e92, 0x04c0d26, 0x0b6ca56, 0x05a0a57,
+    0x0440556, 0x02e86d5, 0x0d40755, 0x0400749, 0x0286e93, 0x04e0693, 0x0b8f52b, 0x05e052b,
+    0x0460a5b, 0x032b55a, 0x0d8056a, 0x0420b65, 0x02c974a, 0x0520b4a, 0x0bd1a95, 0x0620a95,
+    0x04a052d, 0x034caad, 0x05a0ab5, 0x04605aa, 0x02e8ba5, 0x0540da5, 0x0400d4a, 0x02a7c95,
+    0x04e0c96, 0x038f94e, 0x05e0556, 0x0480ab5, 0x032b5b2, 0x05806d2, 0x0420ea5, 0x02e8e4a,
+    0x050068b, 0x03b0c97, 0x06004ab, 0x04a055b, 0x034cad6, 0x05a0b6a, 0x0460752, 0x0309725,
+    0x0540b45, 0x03e0a8b, 0x028549b, 0x0ce04ab,
+};
+
+// Days off by day of the year, bit 0 of byte 0 being January 1; weekends are not included
+static const uint8_t holiday_bits[HOLIDAY_TABLE_YEARS][46] = {
+    {0x01,0x00,0x00,0x00,0xfc,0x01,0x00,0x06,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x40,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 1970
+    {0x01,0x00,0x00,0x1f,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x60,0x00,0x00,0x80,0x01,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x0c,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10}, // 1971
+    {0x01,0x00,0x00,0x00,0x00,0xf8,0x01,0x04,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 1972
+    {0x01,0x00,0x00,0x80,0x3f,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 1973
+    {0x01,0x00,0xf0,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x01,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 1974
+    {0x01,0x00,0x00,0x00,0x80,0x1f,0x00,0x04,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xc0,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 1975
+    {0x01,0x00,0x00,0xf0,0x07,0x00,0x00,0x06,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x18,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x20}, // 1976
+    {0x01,0x00,0x00,0x00,0x00,0xc0,0x1f,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00}, // 1977
+    {0x03,0x00,0x00,0x00,0xf8,0x01,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 1978
+    {0x01,0x00,0x00,0xfe,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 1979
+    {0x01,0x00,0x00,0x00,0x00,0xf0,0x07,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x01,0x08,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 1980
+    {0x01,0x00,0x00,0x00,0xbe,0x00,0x00,0x06,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x40,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 1981
+    {0x01,0x00,0xc0,0x1f,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x60,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x02,0x0c,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10}, // 1982
+    {0x01,0x00,0x00,0x00,0x00,0xfe,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00}, // 1983
+    {0x03,0x00,0x00,0xc0,0x17,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x80,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 1984
+    {0x01,0x00,0x00,0x00,0x00,0x00,0x1f,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x01,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 1985
+    {0x01,0x00,0x00,0x00,0xe0,0x0f,0x00,0x04,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xc0,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 1986
+    {0x01,0x00,0x00,0x7c,0x01,0x00,0x00,0x06,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0x01,0x00,0x00,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x80,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 1987
+    {0x01,0x00,0x00,0x00,0x00,0xe0,0x03,0x0c,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb0,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x01}, // 1988
+    {0x03,0x00,0x00,0x00,0xfc,0x01,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 1989
+    {0x01,0x00,0x00,0x7f,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x08,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 1990
+    {0x01,0x00,0x00,0x00,0x00,0xf8,0x03,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 1991
+    {0x01,0x00,0x00,0x00,0x3f,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x80,0x00,0x0c,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 1992
+    {0x01,0x00,0xf0,0x07,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x60,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x01,0x0c,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10}, // 1993
+    {0x01,0x00,0x00,0x00,0xc0,0x17,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00}, // 1994
+    {0x03,0x00,0x00,0xf0,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 1995
+    {0x01,0x00,0x00,0x00,0x00,0x80,0x3f,0x04,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 1996
+    {0x01,0x00,0x00,0x00,0xf8,0x03,0x00,0x04,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xc0,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 1997
+    {0x01,0x00,0x00,0x3e,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0x01,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 1998
+    {0x01,0x00,0x00,0x00,0x00,0xf0,0x03,0x0c,0x00,0x00,0x00,0x60,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x00,0x0c,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10}, // 1999
+    {0x01,0x00,0x00,0x00,0xfe,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x80,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 2000
+    {0x01,0x00,0xe0,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x02,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2001
+    {0x01,0x00,0x00,0x00,0x00,0x3f,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x60,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2002
+    {0x01,0x00,0x00,0xe0,0x0f,0x00,0x00,0x04,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xc0,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2003
+    {0x01,0x00,0xf8,0x02,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x18,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x20}, // 2004
+    {0x01,0x00,0x00,0x00,0xe0,0x03,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00}, // 2005
+    {0x03,0x00,0x00,0xfc,0x01,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2006
+    {0x01,0x00,0x00,0x00,0x00,0xc0,0x1f,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2007
+    {0x01,0x00,0x00,0x00,0xf8,0x02,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x80,0x01,0x08,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 2008
+    {0x01,0x00,0x80,0x3f,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x0c,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2009
+    {0x01,0x00,0x00,0x00,0x00,0xfc,0x01,0x0c,0x00,0x00,0x00,0x60,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x0c,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10}, // 2010
+    {0x01,0x00,0x00,0x80,0x2f,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00}, // 2011
+    {0x03,0x00,0xf0,0x07,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x06,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 2012
+    {0x01,0x00,0x00,0x00,0xc0,0x1f,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x60,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2013
+    {0x01,0x00,0x00,0xf0,0x07,0x00,0x00,0x04,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0xc0,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2014
+    {0x01,0x00,0x00,0x00,0x00,0x80,0x2f,0x06,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2015
+    {0x01,0x00,0x00,0x00,0xf0,0x07,0x00,0x0c,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x80,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x01}, // 2016
+    {0x03,0x00,0x00,0xfe,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2017
+    {0x01,0x00,0x00,0x00,0x00,0xf0,0x07,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2018
+    {0x01,0x00,0x00,0x00,0x7e,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x60,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2019
+    {0x01,0x00,0xc0,0x1f,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x04,0x0c,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 2020
+    {0x01,0x00,0x00,0x00,0x00,0x7f,0x00,0x0c,0x00,0x00,0x00,0x60,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x40,0x00,0x0c,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10}, // 2021
+    {0x01,0x00,0x00,0xe0,0x07,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00}, // 2022
+    {0x03,0x00,0xf8,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2023
+    {0x01,0x00,0x00,0x00,0xc0,0x1f,0x00,0x04,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xc0,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 2024
+    {0x01,0x00,0x00,0x7c,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x40,0x04,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2025
+    {0x01,0x00,0x00,0x00,0x00,0xe0,0x07,0x06,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2026
+    {0x01,0x00,0x00,0x00,0xfc,0x01,0x00,0x0c,0x00,0x00,0x00,0x60,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x40,0x00,0x0c,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10}, // 2027
+    {0x01,0x00,0x80,0x0f,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x02,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x10,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 2028
+    {0x01,0x00,0x00,0x00,0x00,0x7e,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x41,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2029
+    {0x01,0x00,0x00,0x80,0x3f,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x60,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2030
+    {0x01,0x00,0xf0,0x05,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x02,0x04,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2031
+    {0x01,0x00,0x00,0x00,0x80,0x0f,0x00,0x06,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x80,0x00,0x18,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x20}, // 2032
+    {0x01,0x00,0x00,0xf0,0x07,0x00,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x03,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00}, // 2033
+    {0x03,0x00,0x00,0x00,0x00,0x80,0x3f,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2034
+    {0x01,0x00,0x00,0x00,0xf0,0x05,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2035
+    {0x01,0x00,0x00,0xfe,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x02,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x31,0x08,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 2036
+    {0x01,0x00,0x00,0x00,0x00,0xf8,0x03,0x06,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2037
+    {0x01,0x00,0x00,0x00,0x5f,0x00,0x00,0x0c,0x00,0x00,0x00,0x60,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x40,0x00,0x0c,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10}, // 2038
+    {0x01,0x00,0xe0,0x0f,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x0c,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00}, // 2039
+    {0x03,0x00,0x00,0x00,0x00,0x7f,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 2040
+    {0x01,0x00,0x00,0xe0,0x0f,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x60,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2041
+    {0x01,0x00,0xf8,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x01,0x04,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2042
+    {0x01,0x00,0x00,0x00,0xc0,0x0f,0x00,0x06,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2043
+    {0x01,0x00,0x00,0xf8,0x03,0x00,0x00,0x0c,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x06,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x40,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x01}, // 2044
+    {0x03,0x00,0x00,0x00,0x00,0xe0,0x0f,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2045
+    {0x01,0x00,0x00,0x00,0xfc,0x00,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2046
+    {0x01,0x00,0x80,0x3f,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2047
+    {0x01,0x00,0x00,0x00,0x00,0xfc,0x01,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x00,0x0c,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 2048
+    {0x01,0x00,0x00,0xc0,0x0f,0x00,0x00,0x0c,0x00,0x00,0x00,0x60,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x40,0x00,0x0c,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10}, // 2049
+    {0x01,0x00,0xf0,0x07,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x01,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00}, // 2050
+    {0x03,0x00,0x00,0x00,0x80,0x3f,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2051
+    {0x01,0x00,0x00,0xe0,0x0b,0x00,0x00,0x04,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x02,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0xc0,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 2052
+    {0x01,0x00,0x00,0x00,0x00,0x80,0x0f,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd0,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2053
+    {0x01,0x00,0x00,0x00,0xf0,0x07,0x00,0x06,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x40,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2054
+    {0x01,0x00,0x00,0xbe,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x60,0x00,0x00,0x80,0x01,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x0c,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10}, // 2055
+    {0x01,0x00,0x00,0x00,0x00,0xf8,0x01,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x98,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 2056
+    {0x01,0x00,0x00,0x00,0x7f,0x00,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2057
+    {0x01,0x00,0xe0,0x0b,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x04,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2058
+    {0x01,0x00,0x00,0x00,0x00,0x1f,0x00,0x04,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xc1,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2059
+    {0x01,0x00,0x00,0xc0,0x1f,0x00,0x00,0x06,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x80,0x00,0x18,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x20}, // 2060
+    {0x01,0x00,0xfc,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00}, // 2061
+    {0x03,0x00,0x00,0x00,0xe0,0x0b,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2062
+    {0x01,0x00,0x00,0xfc,0x01,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x60,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2063
+    {0x01,0x00,0x00,0x00,0x00,0xe0,0x0f,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x01,0x08,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 2064
+    {0x01,0x00,0x00,0x00,0xbe,0x00,0x00,0x06,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x40,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2065
+    {0x01,0x00,0x80,0x1f,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x60,0x00,0x00,0x80,0x01,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x0c,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10}, // 2066
+    {0x01,0x00,0x00,0x00,0x00,0xfc,0x01,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00}, // 2067
+    {0x03,0x00,0x00,0x80,0x3f,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x80,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 2068
+    {0x01,0x00,0xf0,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x01,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2069
+    {0x01,0x00,0x00,0x00,0x80,0x1f,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xc0,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2070
+    {0x01,0x00,0x00,0xf0,0x07,0x00,0x00,0x06,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x40,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2071
+    {0x01,0x00,0x00,0x00,0x00,0x80,0x3f,0x0c,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x01}, // 2072
+    {0x03,0x00,0x00,0x00,0xf8,0x01,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2073
+    {0x01,0x00,0x00,0x7f,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2074
+    {0x01,0x00,0x00,0x00,0x00,0xf8,0x03,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2075
+    {0x01,0x00,0x00,0x00,0x3e,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00,0x80,0x00,0x0c,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 2076
+    {0x01,0x00,0xe0,0x0f,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x60,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x02,0x0c,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10}, // 2077
+    {0x01,0x00,0x00,0x00,0x00,0x7f,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00}, // 2078
+    {0x03,0x00,0x00,0xc0,0x17,0x00,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2079
+    {0x01,0x00,0xf8,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 2080
+    {0x01,0x00,0x00,0x00,0xe0,0x0f,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xc0,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2081
+    {0x01,0x00,0x00,0x7c,0x01,0x00,0x00,0x06,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2082
+    {0x01,0x00,0x00,0x00,0x00,0xe0,0x03,0x0c,0x00,0x00,0x00,0x60,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x0c,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10}, // 2083
+    {0x01,0x00,0x00,0x00,0xfc,0x01,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x80,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 2084
+    {0x01,0x00,0x80,0x3f,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x08,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2085
+    {0x01,0x00,0x00,0x00,0x00,0x7c,0x01,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2086
+    {0x01,0x00,0x00,0x80,0x3f,0x00,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xc0,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2087
+    {0x01,0x00,0xe0,0x0f,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x01,0x18,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x20}, // 2088
+    {0x01,0x00,0x00,0x00,0xc0,0x17,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00}, // 2089
+    {0x03,0x00,0x00,0xf8,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2090
+    {0x01,0x00,0x00,0x00,0x00,0xc0,0x1f,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2091
+    {0x01,0x00,0x00,0x00,0xf8,0x02,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x80,0x01,0x08,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 2092
+    {0x01,0x00,0x00,0x3f,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2093
+    {0x01,0x00,0x00,0x00,0x00,0xf8,0x03,0x0c,0x00,0x00,0x00,0x60,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x00,0x0c,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10}, // 2094
+    {0x01,0x00,0x00,0x00,0xfe,0x00,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x40,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00}, // 2095
+    {0x03,0x00,0xc0,0x07,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x06,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00}, // 2096
+    {0x01,0x00,0x00,0x00,0x00,0x3f,0x00,0x04,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x60,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2097
+    {0x01,0x00,0x00,0xe0,0x0f,0x00,0x00,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0xc0,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2098
+    {0x01,0x00,0x7c,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00}, // 2099
+    {0x01,0x00,0x00,0x00,0xe0,0x07,0x00,0x0c,0x00,0x00,0x00,0x60,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x40,0x00,0x0c,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00}, // 2100
+};
+
+#endif // LUNAR_TABLE_H
@@ -0,0 +1,194 @@
+#include "text_arena.h"
+#include "ics_tokenizer.h"
+#include <string.h>
+
+void text_arena_init(text_arena_t *arena, char *buf, size_t cap, text_intern_t *table, uint32_t table_entries)
+{
+    uint32_t size = 1;
+    while (size <= table_entries / 2) {
+        size <<= 1;
+    }
+    memset(arena, 0, sizeof(*arena));
+    arena->buf = buf;
+    arena->cap = cap;
+    arena->table = table;
+    arena->table_mask = size - 1;
+    text_arena_reset(arena);
+}
+
+void text_arena_reset(text_arena_t *arena)
+{
+    // Offset 0 holds the empty string
+    arena->buf[0] = '\0';
+    arena->top = 1;
+    memset(arena->table, 0, (arena->table_mask + 1) * sizeof(*arena->table));
+    arena->strings = 0;
+    arena->interned = 0;
+    arena->overflows = 0;
+    arena->compactions = 0;
+}
+
+bool text_arena_load(text_arena_t *arena, const char *pool, size_t len)
+{
+    if (len == 0 || len > arena->cap) {
+        return false;
+    }
+    text_arena_reset(arena);
+    memcpy(arena->buf, pool, len);
+    arena->top = len;
+    if (arena->top > arena->high_water) {
+        arena->high_water = arena->top;
+    }
+    return true;
+}
+
+// Entries left behind by text_arena_release() point past top and are reused
+static bool entry_live(const text_arena_t *arena, const text_intern_t *e)
+{
+    return e->offset != 0 && e->offset + e->len < arena->top;
+}
+
+text_ref_t text_arena_intern(text_arena_t *arena, const char *str, size_t len)
+{
+    text_ref_t ref = {0};
+    if (len == 0) {
+        return ref;
+    }
+
+    uint32_t hash = ics_span_hash(str, len);
+    text_intern_t *slot = NULL;
+    uint32_t i = hash & arena->table_mask;
+    for (uint32_t probes = 0; probes <= arena->table_mask; probes++, i = (i + 1) & arena->table_mask) {
+        text_intern_t *e = &arena->table[i];
+        if (!entry_live(arena, e)) {
+            if (slot == NULL) {
+                slot = e;
+            }
+            if (e->offset == 0) {
+                break;
+            }
+            continue;
+        }
+        if (e->hash == hash && e->len == len && arena->buf[e->offset + len] == '\0' &&
+            memcmp(arena->buf + e->offset, str, len) == 0) {
+            arena->interned++;
+            ref.offset = e->offset;
+            ref.len = e->len;
+            return ref;
+        }
+    }
+
+    if (arena->top + len + 1 > arena->cap) {
+        arena->overflows++;
+        return ref;
+    }
+    ref.offset = (uint32_t)arena->top;
+    ref.len = (uint32_t)len;
+    memcpy(arena->buf + arena->top, str, len);
+    arena->buf[arena->top + len] = '\0';
+    arena->top += len + 1;
+    arena->strings++;
+    if (arena->top > arena->high_water) {
+        arena->high_water = arena->top;
+    }
+
+    // A full table still stores the string, it just is not shared
+    if (slot != NULL) {
+        slot->hash = hash;
+        slot->offset = ref.offset;
+        slot->len = ref.len;
+    }
+    return ref;
+}
+
+const char *text_arena_get(const text_arena_t *arena, text_ref_t ref)
+{
+    return arena->buf + ref.offset;
+}
+
+size_t text_arena_mark(const text_arena_t *arena)
+{
+    return arena->top;
+}
+
+void text_arena_release(text_arena_t *arena, size_t mark)
+{
+    if (mark < arena->top) {
+        arena->top = mark;
+    }
+}
+
+// Adds a string already in the arena to the intern table
+static void intern_stored(text_arena_t *arena, text_ref_t ref)
+{
+    uint32_t hash = ics_span_hash(arena->buf + ref.offset, ref.len);
+    uint32_t i = hash & arena->table_mask;
+    for (uint32_t probes = 0; probes <= arena->table_mask; probes++, i = (i + 1) & arena->table_mask) {
+        text_intern_t *e = &arena->table[i];
+        if (e->offset == 0) {
+            e->hash = hash;
+            e->offset = ref.offset;
+            e->len = ref.len;
+            return;
+        }
+    }
+}
+
+void text_arena_compact(text_arena_t *arena, text_ref_t **refs, size_t count, size_t floor, size_t *mark)
+{
+    // Insertion sort by offset: the references of a few dozen events, mostly in order already
+    for (size_t i = 1; i < count; i++) {
+        text_ref_t *ref = refs[i];
+        size_t k = i;
+        for (; k > 0 && refs[k - 1]->offset > ref->offset; k--) {
+            refs[k] = refs[k - 1];
+        }
+        refs[k] = ref;
+    }
+
+    // Moving strings to lower offsets in ascending order never overwrites one not yet moved
+    memset(arena->table, 0, (arena->table_mask + 1) * sizeof(*arena->table));
+    size_t top = floor;
+    size_t new_mark = SIZE_MAX;
+    uint32_t last_from = 0, last_to = 0;
+    for (size_t i = 0; i < count; i++) {
+        text_ref_t *ref = refs[i];
+        if (ref->len == 0 || ref->offset < floor) {
+            continue;
+        }
+        if (ref->offset == last_from) {
+            ref->offset = last_to;
+            continue;
+        }
+        if (mark != NULL && new_mark == SIZE_MAX && ref->offset >= *mark) {
+            new_mark = top;
+        }
+        last_from = ref->offset;
+        memmove(arena->buf + top, arena->buf + ref->offset, ref->len + 1);
+        ref->offset = last_to = (uint32_t)top;
+        top += ref->len + 1;
+        intern_stored(arena, *ref);
+    }
+    if (mark != NULL) {
+        *mark = new_mark != SIZE_MAX ? new_mark : top;
+    }
+    arena->top = top;
+    arena->compactions++;
+}
+
+size_t text_utf8_prefix(const char *str, size_t len, size_t max)
+{
+    size_t n = len < max ? len : max;
+
+    // Find the lead byte of the last character and drop the character if it is incomplete
+    size_t i = n;
+    while (i > 0 && n - i < 3 && ((uint8_t)str[i - 1] & 0xC0) == 0x80) {
+        i--;
+    }
+    if (i == 0) {
+        return n;
+    }
+    uint8_t lead = (uint8_t)str[i - 1];
+    size_t need = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 1;
+    return n - (i - 1) < need ? i - 1 : n;
+}
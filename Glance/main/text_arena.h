@@ -0,0 +1,120 @@
+#ifndef TEXT_ARENA_H
+#define TEXT_ARENA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Bump-pointer arena for event text, reset once per sync.
+ *
+ * Strings are appended NUL-terminated and referred to by offset and length,
+ * so storing one costs no malloc and no per-event buffer. Repeated strings
+ * (locations, recurring titles) are interned through a small open-addressing
+ * table and stored once. Everything appended since a mark can be released
+ * again, e.g. when an event turns out to be outside the display window.
+ */
+
+/**
+ * @brief A string in the arena. The zero value is the empty string.
+ */
+typedef struct {
+    uint32_t offset;
+    uint32_t len;
+} text_ref_t;
+
+/**
+ * @brief One intern table entry.
+ */
+typedef struct {
+    uint32_t hash;
+    uint32_t offset;        // 0 for an unused entry
+    uint32_t len;
+} text_intern_t;
+
+/**
+ * @brief Arena state. Treat as opaque apart from the statistics.
+ */
+typedef struct {
+    char *buf;
+    size_t cap;
+    size_t top;             // Next free byte
+    text_intern_t *table;
+    uint32_t table_mask;    // Table entries - 1, a power of two
+
+    // Statistics
+    size_t high_water;
+    uint32_t strings;       // Strings appended
+    uint32_t interned;      // Strings found already stored
+    uint32_t overflows;     // Strings that did not fit
+    uint32_t compactions;   // Times unused strings were squeezed out
+} text_arena_t;
+
+/**
+ * @brief Initializes an arena over caller-provided memory.
+ *
+ * @param arena         Arena to initialize.
+ * @param buf           Backing buffer, e.g. in PSRAM.
+ * @param cap           Size of buf in bytes.
+ * @param table         Intern table storage.
+ * @param table_entries Number of entries in table; only the largest power of two that fits is used.
+ */
+void text_arena_init(text_arena_t *arena, char *buf, size_t cap, text_intern_t *table, uint32_t table_entries);
+
+/**
+ * @brief Drops all strings, keeping the high-water mark.
+ */
+void text_arena_reset(text_arena_t *arena);
+
+/**
+ * @brief Replaces the contents with a pool saved from another arena.
+ *
+ * References into the saved pool stay valid. Loaded strings are not interned.
+ *
+ * @return false if the pool does not fit.
+ */
+bool text_arena_load(text_arena_t *arena, const char *pool, size_t len);
+
+/**
+ * @brief Stores a string, or finds an identical one already stored.
+ *
+ * @return The stored string, or the empty string if it does not fit.
+ */
+text_ref_t text_arena_intern(text_arena_t *arena, const char *str, size_t len);
+
+/**
+ * @brief Returns the NUL-terminated text of a string.
+ */
+const char *text_arena_get(const text_arena_t *arena, text_ref_t ref);
+
+/**
+ * @brief Returns a mark that text_arena_release() can roll back to.
+ */
+size_t text_arena_mark(const text_arena_t *arena);
+
+/**
+ * @brief Drops every string stored since the mark was taken.
+ */
+void text_arena_release(text_arena_t *arena, size_t mark);
+
+/**
+ * @brief Moves the strings still referred to down to floor, dropping the rest.
+ *
+ * The references are updated in place and may share a string. Strings below
+ * floor stay where they are, and only the moved ones are interned again.
+ *
+ * @param arena  Arena to compact.
+ * @param refs   Every reference to a string at or above floor that is still in use; reordered.
+ * @param count  Number of entries in refs.
+ * @param floor  Offset below which nothing moves, at least 1.
+ * @param mark   A mark to carry over: afterwards it precedes the moved strings that followed it. May be NULL.
+ */
+void text_arena_compact(text_arena_t *arena, text_ref_t **refs, size_t count, size_t floor, size_t *mark);
+
+/**
+ * @brief Length of the longest prefix of a UTF-8 string that is at most
+ * max bytes and does not end inside a character.
+ */
+size_t text_utf8_prefix(const char *str, size_t len, size_t max);
+
+#endif // TEXT_ARENA_H
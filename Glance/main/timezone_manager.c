@@ -0,0 +1,262 @@
+#include "timezone_manager.h"
+#include "json_extract.h"
+#include "tz_posix.h"
+#include "wifi_manager.h"
+#include "esp_http_client.h"
+#include "esp_log.h"
+#include "nvs_flash.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define NVS_NAMESPACE       "timezone"
+#define NVS_KEY             "saved"
+
+// Only the fields used are asked for; offset is not in the default response
+#define LOOKUP_URL          "http://ip-api.com/json/?fields=status,message,timezone,offset,query"
+
+#define TIMEZONE_NAME_MAX   48  // IANA names are at most 30 characters
+#define PUBLIC_IP_MAX       46  // An IPv6 address in text
+#define POSIX_TZ_MAX        64
+#define FIXED_OFFSET_MAX_AGE    (24 * 3600)
+#define CLOCK_SET_AFTER     1704067200  // 2024-01-01; earlier times mean the clock was never set
+
+static const char *TAG = "timezone_manager";
+
+/**
+ * @brief Result of the last lookup, as saved in NVS.
+ */
+typedef struct {
+    uint8_t bssid[6];                   // Access point the lookup went through
+    char public_ip[PUBLIC_IP_MAX];
+    char timezone[TIMEZONE_NAME_MAX];   // IANA name, e.g. "Asia/Taipei"
+    int32_t offset;                     // Seconds east of UTC at the time of the lookup
+    int64_t looked_up;                  // Unix time of the lookup, 0 if the clock was not set
+    char posix_tz[POSIX_TZ_MAX];        // What TZ is set to
+} saved_timezone_t;
+
+enum {
+    FIELD_STATUS,
+    FIELD_MESSAGE,
+    FIELD_TIMEZONE,
+    FIELD_OFFSET,
+    FIELD_QUERY,
+    FIELD_COUNT,
+};
+
+static const char *const lookup_fields[] = {"status", "message", "timezone", "offset", "query", NULL};
+
+#define FIELD_MAX   64  // Longer values are cut, which only matters for messages
+
+/**
+ * @brief Fields of the lookup response, read as it arrives.
+ */
+typedef struct {
+    json_extract_t json;
+    char values[FIELD_COUNT][FIELD_MAX];
+    uint8_t lengths[FIELD_COUNT];
+} lookup_t;
+
+static lookup_t lookup;
+
+static bool on_field(int field, const char *data, size_t len, void *ctx)
+{
+    lookup_t *l = ctx;
+    if (data != NULL) {
+        size_t room = FIELD_MAX - 1 - l->lengths[field];
+        len = len < room ? len : room;
+        memcpy(l->values[field] + l->lengths[field], data, len);
+        l->lengths[field] += len;
+        l->values[field][l->lengths[field]] = '\0';
+    }
+    return true;
+}
+
+static esp_err_t lookup_event_handler(esp_http_client_event_t *evt)
+{
+    if (evt->event_id == HTTP_EVENT_ON_DATA) {
+        json_extract_feed(&lookup.json, evt->data, evt->data_len);
+    }
+    return ESP_OK;
+}
+
+static esp_err_t load_saved(saved_timezone_t *saved)
+{
+    memset(saved, 0, sizeof(*saved));
+
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs_handle);
+    if (err != ESP_OK) {
+        return err == ESP_ERR_NVS_NOT_INITIALIZED ? err : ESP_ERR_NVS_NOT_FOUND;
+    }
+    size_t len = sizeof(*saved);
+    err = nvs_get_blob(nvs_handle, NVS_KEY, saved, &len);
+    nvs_close(nvs_handle);
+
+    // A blob of another size was written by a different layout
+    if (err != ESP_OK || len != sizeof(*saved) || saved->posix_tz[0] == '\0') {
+        memset(saved, 0, sizeof(*saved));
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    saved->public_ip[PUBLIC_IP_MAX - 1] = '\0';
+    saved->timezone[TIMEZONE_NAME_MAX - 1] = '\0';
+    saved->posix_tz[POSIX_TZ_MAX - 1] = '\0';
+    return ESP_OK;
+}
+
+static esp_err_t save(const saved_timezone_t *saved)
+{
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error (%s) opening NVS handle!", esp_err_to_name(err));
+        return err;
+    }
+    err = nvs_set_blob(nvs_handle, NVS_KEY, saved, sizeof(*saved));
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs_handle);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error (%s) saving time zone to NVS!", esp_err_to_name(err));
+    }
+    nvs_close(nvs_handle);
+    return err;
+}
+
+static void apply(const saved_timezone_t *saved)
+{
+    setenv("TZ", saved->posix_tz, 1);
+    tzset();
+    ESP_LOGI(TAG, "Time zone %s, TZ=%s", saved->timezone[0] ? saved->timezone : "unknown", saved->posix_tz);
+}
+
+// A zone that stays at this offset all year, e.g. "<+0530>-5:30" for UTC+5:30
+static void posix_fixed_offset(int32_t offset, char *out, size_t len)
+{
+    int32_t abs_offset = offset < 0 ? -offset : offset;
+    int hours = (int)(abs_offset / 3600);
+    int minutes = (int)(abs_offset / 60 % 60);
+    char sign = offset < 0 ? '-' : '+';
+
+    // POSIX offsets count west of UTC, so the sign is flipped
+    if (minutes != 0) {
+        snprintf(out, len, "<%c%02d%02d>%s%d:%02d", sign, hours, minutes, offset > 0 ? "-" : "", hours, minutes);
+    } else {
+        snprintf(out, len, "<%c%02d>%s%d", sign, hours, offset > 0 ? "-" : "", hours);
+    }
+}
+
+// Whether the saved zone still holds on the network reached through this access point
+static bool saved_is_current(const saved_timezone_t *saved, const uint8_t bssid[6], bool has_bssid)
+{
+    if (!has_bssid || memcmp(saved->bssid, bssid, sizeof(saved->bssid)) != 0) {
+        return false;
+    }
+    if (tz_posix_lookup(saved->timezone, strlen(saved->timezone)) != NULL) {
+        return true; // The TZ string carries the zone's rules
+    }
+    // Before SNTP has run after a power-on, the age cannot be told
+    time_t now = time(NULL);
+    if (now < CLOCK_SET_AFTER) {
+        return true;
+    }
+    return saved->looked_up >= CLOCK_SET_AFTER && now - saved->looked_up < FIXED_OFFSET_MAX_AGE;
+}
+
+static bool look_up(saved_timezone_t *result)
+{
+    memset(&lookup, 0, sizeof(lookup));
+    json_extract_init(&lookup.json, lookup_fields, on_field, &lookup);
+
+    esp_http_client_config_t config = {
+        .url = LOOKUP_URL,
+        .event_handler = lookup_event_handler,
+    };
+    esp_http_client_handle_t client = esp_http_client_init(&config);
+    if (client == NULL) {
+        ESP_LOGE(TAG, "Failed to initialize HTTP client");
+        return false;
+    }
+    esp_err_t err = esp_http_client_perform(client);
+    int status_code = esp_http_client_get_status_code(client);
+    esp_http_client_cleanup(client);
+    json_extract_finish(&lookup.json);
+
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Time zone lookup failed: %s", esp_err_to_name(err));
+        return false;
+    }
+    if (status_code != 200) {
+        ESP_LOGE(TAG, "Time zone lookup failed with status %d", status_code);
+        return false;
+    }
+    if (strcmp(lookup.values[FIELD_STATUS], "success") != 0) {
+        ESP_LOGE(TAG, "Time zone lookup failed: %s", lookup.values[FIELD_MESSAGE]);
+        return false;
+    }
+
+    char *end;
+    long offset = strtol(lookup.values[FIELD_OFFSET], &end, 10);
+    if (lookup.lengths[FIELD_OFFSET] == 0 || *end != '\0' || offset < -18 * 3600 || offset > 18 * 3600) {
+        ESP_LOGE(TAG, "Time zone lookup gave no usable offset: [%s]", lookup.values[FIELD_OFFSET]);
+        return false;
+    }
+
+    snprintf(result->public_ip, sizeof(result->public_ip), "%s", lookup.values[FIELD_QUERY]);
+    snprintf(result->timezone, sizeof(result->timezone), "%s", lookup.values[FIELD_TIMEZONE]);
+    result->offset = (int32_t)offset;
+    time_t now = time(NULL);
+    result->looked_up = now < CLOCK_SET_AFTER ? 0 : (int64_t)now;
+    const char *rules = tz_posix_lookup(result->timezone, strlen(result->timezone));
+    if (rules != NULL) {
+        snprintf(result->posix_tz, sizeof(result->posix_tz), "%s", rules);
+    } else {
+        ESP_LOGW(TAG, "%s is not in tzdata %s, using its current offset", result->timezone, tz_posix_version());
+        posix_fixed_offset(result->offset, result->posix_tz, sizeof(result->posix_tz));
+    }
+    ESP_LOGI(TAG, "Public IP %s is in %s, offset %" PRId32 " s",
+             result->public_ip, result->timezone, result->offset);
+    return true;
+}
+
+bool glance_timezone_load_saved(void)
+{
+    saved_timezone_t saved;
+    if (load_saved(&saved) != ESP_OK) {
+        return false;
+    }
+    apply(&saved);
+    return true;
+}
+
+bool glance_timezone_sync(void)
+{
+    saved_timezone_t saved;
+    bool has_saved = load_saved(&saved) == ESP_OK;
+    uint8_t bssid[6] = {0};
+    bool has_bssid = wifi_get_ap_bssid(bssid);
+
+    if (has_saved && saved_is_current(&saved, bssid, has_bssid)) {
+        ESP_LOGI(TAG, "Same network as the last lookup, reusing its time zone");
+        apply(&saved);
+        return true;
+    }
+
+    saved_timezone_t result = {0};
+    if (!look_up(&result)) {
+        if (has_saved) {
+            ESP_LOGW(TAG, "Using the saved time zone");
+            apply(&saved);
+        }
+        return has_saved;
+    }
+    if (has_bssid) {
+        memcpy(result.bssid, bssid, sizeof(result.bssid));
+    }
+    apply(&result);
+    save(&result);
+    return true;
+}
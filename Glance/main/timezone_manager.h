@@ -0,0 +1,35 @@
+#ifndef TIMEZONE_MANAGER_H
+#define TIMEZONE_MANAGER_H
+
+#include <stdbool.h>
+
+/*
+ * Local time zone of the device, looked up from its public IP address and
+ * applied by setting TZ. The result is kept in NVS together with the BSSID
+ * of the access point it was looked up through, so the lookup only runs
+ * again once the device is on another network, where its public IP address
+ * differs. The zone name is turned into a POSIX TZ string with daylight
+ * saving rules through tz_posix.h; a zone missing from that table is known
+ * only by its current UTC offset, so it is trusted for a day.
+ */
+
+/**
+ * @brief Sets TZ from the time zone saved by the last lookup.
+ *
+ * Does not need a network; used when waking without a sync.
+ *
+ * @return false if no time zone is saved.
+ */
+bool glance_timezone_load_saved(void);
+
+/**
+ * @brief Sets TZ for the current network, looking it up if needed.
+ *
+ * This is a blocking function. It assumes that Wi-Fi is already connected.
+ * If the lookup fails, the saved time zone is used.
+ *
+ * @return true if TZ was set.
+ */
+bool glance_timezone_sync(void);
+
+#endif // TIMEZONE_MANAGER_H
@@ -0,0 +1,34 @@
+#include "tz_posix.h"
+#include "ics_tz.h"
+#include "tz_posix_table.h"
+
+// Finalizer of MurmurHash3, spreading the FNV-1a bits over the table
+static uint32_t tz_mix(uint32_t h)
+{
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
+
+const char *tz_posix_lookup_hash(uint32_t hash)
+{
+    uint32_t displacement = tz_posix_displacements[tz_mix(hash) % TZ_POSIX_BUCKETS];
+    uint32_t slot = tz_mix(hash ^ (displacement * 0x9E3779B9u)) % TZ_POSIX_COUNT;
+    if (tz_posix_hashes[slot] != hash) {
+        return NULL; // Every name has a slot, so any other hash is not a zone
+    }
+    return tz_posix_rules[tz_posix_rule_of[slot]];
+}
+
+const char *tz_posix_lookup(const char *name, size_t len)
+{
+    return tz_posix_lookup_hash(ics_tz_hash(name, len));
+}
+
+const char *tz_posix_version(void)
+{
+    return TZ_POSIX_VERSION;
+}
@@ -0,0 +1,37 @@
+#ifndef TZ_POSIX_H
+#define TZ_POSIX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * POSIX TZ strings of the IANA time zones, e.g. "CST-8" for "Asia/Taipei",
+ * for setting TZ or for ics_tz_compile_posix(). The Windows zone names that
+ * Exchange and Outlook write as TZIDs, e.g. "Taipei Standard Time", map to
+ * the string of their IANA zone as CLDR's windowsZones pairs them.
+ *
+ * The table in tz_posix_table.h is generated from a tzdata release by
+ * playground/tz_table_tool and covers every zone and link name. It is all
+ * const data, so it stays in flash. Names are found by their ics_tz_hash()
+ * through a minimal perfect hash: a lookup reads two table entries and
+ * compares one hash, with no string compares and no allocation.
+ */
+
+/**
+ * @brief POSIX TZ string of an IANA or Windows zone name.
+ *
+ * @return The TZ string, or NULL if the name is unknown.
+ */
+const char *tz_posix_lookup(const char *name, size_t len);
+
+/**
+ * @brief Same as tz_posix_lookup(), for a name already hashed with ics_tz_hash().
+ */
+const char *tz_posix_lookup_hash(uint32_t hash);
+
+/**
+ * @brief The tzdata release the table was generated from, e.g. "2025b".
+ */
+const char *tz_posix_version(void);
+
+#endif // TZ_POSIX_H
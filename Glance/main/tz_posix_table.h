@@ -0,0 +1,910 @@
+// Generated by playground/tz_table_tool/tz_table.py from tzdata 2025b and CLDR windowsZones. Do not edit.
+#ifndef TZ_POSIX_TABLE_H
+#define TZ_POSIX_TABLE_H
+
+#include <stdint.h>
+
+#define TZ_POSIX_VERSION    "2025b"
+#define TZ_POSIX_COUNT      735
+#define TZ_POSIX_BUCKETS    184
+
+static const char *const tz_posix_rules[94] = {
+    "<+00>0<+02>-2,M3.5.0/1,M10.5.0/3",
+    "<+01>-1",
+    "<+02>-2",
+    "<+0330>-3:30",
+    "<+03>-3",
+    "<+0430>-4:30",
+    "<+04>-4",
+    "<+0530>-5:30",
+    "<+0545>-5:45",
+    "<+05>-5",
+    "<+0630>-6:30",
+    "<+06>-6",
+    "<+07>-7",
+    "<+0845>-8:45",
+    "<+08>-8",
+    "<+09>-9",
+    "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0",
+    "<+10>-10",
+    "<+11>-11",
+    "<+11>-11<+12>,M10.1.0,M4.1.0/3",
+    "<+1245>-12:45<+1345>,M9.5.0/2:45,M4.1.0/3:45",
+    "<+12>-12",
+    "<+13>-13",
+    "<+14>-14",
+    "<-01>1",
+    "<-01>1<+00>,M3.5.0/0,M10.5.0/1",
+    "<-02>2",
+    "<-02>2<-01>,M3.5.0/-1,M10.5.0/0",
+    "<-03>3",
+    "<-03>3<-02>,M3.2.0,M11.1.0",
+    "<-04>4",
+    "<-04>4<-03>,M9.1.6/24,M4.1.6/24",
+    "<-05>5",
+    "<-06>6",
+    "<-06>6<-05>,M9.1.6/22,M4.1.6/22",
+    "<-07>7",
+    "<-08>8",
+    "<-0930>9:30",
+    "<-09>9",
+    "<-10>10",
+    "<-11>11",
+    "<-12>12",
+    "ACST-9:30",
+    "ACST-9:30ACDT,M10.1.0,M4.1.0/3",
+    "AEST-10",
+    "AEST-10AEDT,M10.1.0,M4.1.0/3",
+    "AKST9AKDT,M3.2.0,M11.1.0",
+    "AST4",
+    "AST4ADT,M3.2.0,M11.1.0",
+    "AWST-8",
+    "CAT-2",
+    "CET-1",
+    "CET-1CEST,M3.5.0,M10.5.0/3",
+    "CST-8",
+    "CST5CDT,M3.2.0/0,M11.1.0/1",
+    "CST6",
+    "CST6CDT,M3.2.0,M11.1.0",
+    "ChST-10",
+    "EAT-3",
+    "EET-2",
+    "EET-2EEST,M3.4.4/50,M10.4.4/50",
+    "EET-2EEST,M3.5.0,M10.5.0/3",
+    "EET-2EEST,M3.5.0/0,M10.5.0/0",
+    "EET-2EEST,M3.5.0/3,M10.5.0/4",
+    "EET-2EEST,M4.5.5/0,M10.5.4/24",
+    "EST5",
+    "EST5EDT,M3.2.0,M11.1.0",
+    "GMT0",
+    "GMT0BST,M3.5.0/1,M10.5.0",
+    "HKT-8",
+    "HST10",
+    "HST10HDT,M3.2.0,M11.1.0",
+    "IST-1GMT0,M10.5.0,M3.5.0/1",
+    "IST-2IDT,M3.4.4/26,M10.5.0",
+    "IST-5:30",
+    "JST-9",
+    "KST-9",
+    "MET-1MEST,M3.5.0,M10.5.0/3",
+    "MSK-3",
+    "MST7",
+    "MST7MDT,M3.2.0,M11.1.0",
+    "NST3:30NDT,M3.2.0,M11.1.0",
+    "NZST-12NZDT,M9.5.0,M4.1.0/3",
+    "PKT-5",
+    "PST-8",
+    "PST8PDT,M3.2.0,M11.1.0",
+    "SAST-2",
+    "SST11",
+    "UTC0",
+    "WAT-1",
+    "WET0WEST,M3.5.0/1,M10.5.0",
+    "WIB-7",
+    "WIT-9",
+    "WITA-8",
+};
+
+static const uint16_t tz_posix_displacements[TZ_POSIX_BUCKETS] = {
+    12, 1, 18, 22, 125, 0, 50, 96, 59, 1, 30, 99, 21, 29, 0, 124,
+    21, 0, 35, 173, 3, 150, 169, 3, 33, 63, 5, 9, 10, 29, 2, 0,
+    164, 1, 11, 166, 41, 47, 10, 0, 35, 95, 3, 142, 0, 12, 117, 0,
+    141, 5, 3, 2, 0, 152, 20, 154, 0, 0, 0, 5, 91, 60, 478, 35,
+    82, 413, 161, 210, 0, 22, 84, 48, 71, 240, 41, 0, 1, 108, 51, 77,
+    104, 20, 6, 29, 189, 28, 119, 13, 16, 218, 75, 5, 389, 36, 1852, 5,
+    1265, 34, 84, 4, 1, 68, 0, 16, 3, 9, 55, 59, 9, 2, 190, 567,
+    148, 105, 190, 22, 190, 2, 3, 273, 495, 1379, 42, 12, 8, 42, 11, 9,
+    7, 298, 55, 14, 107, 317, 1530, 238, 19, 0, 475, 1302, 55, 30, 2291, 129,
+    42, 74, 140, 0, 569, 2, 0, 0, 2, 0, 143, 81, 7, 1508, 225, 43,
+    788, 1251, 24, 2, 247, 911, 157, 19, 6, 1137, 28, 1539, 404, 285, 1950, 143,
+    1272, 66, 162, 0, 2, 0, 3, 121,
+};
+
+static const uint32_t tz_posix_hashes[TZ_POSIX_COUNT] = {
+    0xf114226d, // America/Eirunepe
+    0x0bf3f15f, // Kwajalein
+    0xc64adc6c, // Asia/Almaty
+    0x45f57a07, // Tokyo Standard Time -> Asia/Tokyo
+    0xeb60a919, // US/Mountain
+    0x5576ea63, // Atlantic Standard Time -> America/Halifax
+    0x45f18d03, // Line Islands Standard Time -> Pacific/Kiritimati
+    0x2b7ab00a, // Mountain Standard Time (Mexico) -> America/Mazatlan
+    0x949d098a, // Asia/Phnom_Penh
+    0x89e41efb, // America/Iqaluit
+    0xb52adee7, // Africa/Khartoum
+    0xe617ca18, // Atlantic/Azores
+    0xe340dd05, // America/Guatemala
+    0x6dcc0f29, // Australia/West
+    0x3498ac69, // America/Glace_Bay
+    0x7ea12f63, // Asia/Ust-Nera
+    0xfd0ed995, // America/Kentucky/Monticello
+    0x1f1dd566, // Magallanes Standard Time -> America/Punta_Arenas
+    0xa82aef65, // Indian/Antananarivo
+    0x546bdfd3, // Atlantic/St_Helena
+    0x718c28c3, // Asia/Khandyga
+    0x8479eb87, // Africa/Luanda
+    0x4c928285, // Antarctica/Rothera
+    0x9131db9a, // Sri Lanka Standard Time -> Asia/Colombo
+    0xed1ec704, // Pacific/Kosrae
+    0x2756f85d, // Indian/Christmas
+    0x4faf37fe, // America/Dominica
+    0xfd3ce6a4, // Europe/Skopje
+    0x792dcbeb, // Canada/Saskatchewan
+    0x2f9e372b, // Fiji Standard Time -> Pacific/Fiji
+    0x6ca8e69d, // Pacific/Yap
+    0x960d7242, // Pacific/Apia
+    0x689f7bcc, // Alaskan Standard Time -> America/Anchorage
+    0xd6283302, // America/Chihuahua
+    0xc89ec203, // Asia/Damascus
+    0x3b531e62, // Asia/Pyongyang
+    0x8718d7c6, // UTC-11 -> Etc/GMT+11
+    0xf61bdde8, // Tonga Standard Time -> Pacific/Tongatapu
+    0x24cf1036, // Europe/Saratov
+    0x184f91ea, // US/Arizona
+    0xd2596768, // America/Knox_IN
+    0x1436f39f, // MST
+    0x26d08f98, // Africa/Banjul
+    0x54072282, // Atlantic/Canary
+    0x151e5589, // America/Cayman
+    0xe0bb4979, // Europe/Busingen
+    0x8fb2e4ff, // Pacific/Honolulu
+    0x47a1e57e, // Africa/Freetown
+    0xb689169e, // America/Rankin_Inlet
+    0x668a0926, // Africa/Mbabane
+    0xf60b26b3, // Pacific/Tarawa
+    0xc7321684, // America/Merida
+    0xa8f0fa30, // Asia/Yerevan
+    0x3552a188, // America/Santa_Isabel
+    0x97f3c9d7, // Africa/Algiers
+    0xee9fc839, // Omsk Standard Time -> Asia/Omsk
+    0x58d0a44c, // Etc/GMT+7
+    0x964f2bbb, // Asia/Calcutta
+    0x93f9a8c6, // Egypt Standard Time -> Africa/Cairo
+    0x3ee4bb8b, // America/Argentina/San_Juan
+    0x73ea5cb8, // Europe/Copenhagen
+    0xda5ab2b2, // Asia/Singapore
+    0x3254d54d, // Europe/Andorra
+    0x63e7d6ca, // Asia/Samarkand
+    0x7d1a9566, // America/Managua
+    0xe23de65d, // Asia/Srednekolymsk
+    0x2021d904, // Atlantic/Stanley
+    0xea3b33b6, // E. Africa Standard Time -> Africa/Nairobi
+    0x00ffa612, // Asia/Tehran
+    0x9a576d50, // Namibia Standard Time -> Africa/Windhoek
+    0x62f59f62, // America/Bahia_Banderas
+    0xda64945d, // Canada/Central
+    0xf792be2b, // America/Havana
+    0x8b9466e7, // UCT
+    0x722a9092, // Azerbaijan Standard Time -> Asia/Baku
+    0x67afb100, // America/Regina
+    0x7ff78d16, // Samoa Standard Time -> Pacific/Apia
+    0x51cafc18, // FLE Standard Time -> Europe/Kiev
+    0xbc53c6e0, // America/Goose_Bay
+    0x7811eb5b, // Greenwich
+    0x5e5b13d2, // America/Indiana/Indianapolis
+    0xd45eb960, // America/Boa_Vista
+    0xcae2d7dd, // Europe/Rome
+    0x90118e26, // E. Europe Standard Time -> Europe/Chisinau
+    0xccabacfe, // Indian/Chagos
+    0x9dd8ecc0, // North Korea Standard Time -> Asia/Pyongyang
+    0x2d6e52ba, // America/Argentina/San_Luis
+    0xd15df27b, // Zulu
+    0x4508f384, // America/Lower_Princes
+    0xbead98ca, // Etc/GMT
+    0x77346a86, // Pacific/Gambier
+    0xa448f747, // America/Yakutat
+    0xa9ca929b, // Arctic/Longyearbyen
+    0x519b3aa2, // Indian/Mahe
+    0xafb536aa, // Bangladesh Standard Time -> Asia/Dhaka
+    0x4c688e91, // Azores Standard Time -> Atlantic/Azores
+    0xa44c9f73, // America/Buenos_Aires
+    0xc606962b, // Africa/Lome
+    0x80d4e247, // Canada/Mountain
+    0x10a0f02a, // Asia/Hebron
+    0xb38be558, // America/Cancun
+    0x9aefb58c, // Africa/El_Aaiun
+    0xbc3da52c, // Bahia Standard Time -> America/Bahia
+    0xa1b0ab93, // Saratov Standard Time -> Europe/Saratov
+    0xa4ad62b5, // Yakutsk Standard Time -> Asia/Yakutsk
+    0x5d1a2684, // Asia/Kuala_Lumpur
+    0xca6a4e5b, // Europe/Volgograd
+    0x1c558b66, // Pacific/Norfolk
+    0x6706f6bb, // Asia/Kathmandu
+    0xccbaffcc, // Australia/Queensland
+    0xe373677f, // MST7MDT
+    0xcb528c5a, // America/Caracas
+    0x59d0a5df, // Etc/GMT+6
+    0x7d7e04b5, // Indian/Kerguelen
+    0x344abdb0, // Asia/Oral
+    0x0cf5bfc1, // US/Samoa
+    0x2c198415, // Australia/Perth
+    0x686893cf, // America/Guadeloupe
+    0x9473f5d3, // Europe/Warsaw
+    0x6cad5636, // Pacific/Efate
+    0xef302bf6, // E. Australia Standard Time -> Australia/Brisbane
+    0x86ea8ca2, // Central Standard Time (Mexico) -> America/Mexico_City
+    0x1c29c09e, // America/Barbados
+    0xa81fd8cc, // Indian/Cocos
+    0xf31c1afa, // Eire
+    0x310d803d, // Pacific/Wake
+    0x2547d18e, // Etc/GMT0
+    0xcf37f849, // America/Adak
+    0x13610881, // Arabian Standard Time -> Asia/Dubai
+    0x04f252bd, // Australia/Darwin
+    0x3958e753, // CET
+    0x03f326c3, // Africa/Bujumbura
+    0xd69bf6b2, // America/Paramaribo
+    0x058b4202, // Asia/Istanbul
+    0x5dee8317, // America/Guyana
+    0xe17d1641, // Singapore
+    0xb4fce960, // Asia/Vladivostok
+    0x051cc24b, // America/Manaus
+    0xabb6332b, // America/Belize
+    0x927d2143, // US Eastern Standard Time -> America/Indianapolis
+    0x39e5c8bd, // Asia/Bangkok
+    0x2e9237d7, // Arabic Standard Time -> Asia/Baghdad
+    0x8ceab754, // America/Mazatlan
+    0xcd789167, // America/La_Paz
+    0x488f56f8, // Asia/Seoul
+    0x0c64c596, // AUS Eastern Standard Time -> Australia/Sydney
+    0xbe4a7584, // Antarctica/Vostok
+    0x1de58719, // W-SU
+    0x1573e2d2, // Asia/Aqtobe
+    0x3dcb75bf, // Asia/Ashgabat
+    0x505b70c1, // Asia/Kuching
+    0xe96a02b9, // SA Western Standard Time -> America/La_Paz
+    0x30efcd9a, // Central Brazilian Standard Time -> America/Cuiaba
+    0xad2a9fd1, // Europe/Brussels
+    0x7d5acd92, // America/North_Dakota/New_Salem
+    0x26a51eeb, // Mexico/BajaSur
+    0x4f17c560, // Africa/Juba
+    0xd0d6464f, // Asia/Hovd
+    0x9179d2a5, // America/Santo_Domingo
+    0xfda191b9, // America/Coral_Harbour
+    0xc9d160e2, // Asia/Jakarta
+    0x588dc162, // Asia/Tel_Aviv
+    0x0b093fdb, // Chatham Islands Standard Time -> Pacific/Chatham
+    0xd6457980, // Newfoundland Standard Time -> America/St_Johns
+    0xee63d499, // EST5EDT
+    0x86ec5aa7, // Africa/Mogadishu
+    0xac54b091, // E. South America Standard Time -> America/Sao_Paulo
+    0x500da217, // Atlantic/Madeira
+    0xd3c7fc14, // N. Central Asia Standard Time -> Asia/Novosibirsk
+    0x7ab7ac0f, // Europe/Oslo
+    0xebc8b203, // America/Kralendijk
+    0xdec1b290, // Pacific Standard Time (Mexico) -> America/Tijuana
+    0xe9aa7008, // Argentina Standard Time -> America/Buenos_Aires
+    0x92f733ea, // Europe/Minsk
+    0xa8f20277, // America/Cuiaba
+    0x29319a30, // Africa/Douala
+    0x1ba19858, // Asia/Dili
+    0x8b169f7b, // UTC-09 -> Etc/GMT+9
+    0x140a6620, // America/Panama
+    0x08c2854f, // America/Resolute
+    0x190bc005, // Asia/Chita
+    0x430c7d82, // India Standard Time -> Asia/Calcutta
+    0x3f4c9ff2, // Pacific/Ponape
+    0xa340648e, // Australia/Lindeman
+    0xde01881f, // Asia/Beirut
+    0x383ff75c, // Asia/Dacca
+    0xb3338427, // Africa/Porto-Novo
+    0x56c7ec1f, // America/Rosario
+    0x5c4f25d2, // Asia/Aden
+    0xbe181427, // Asia/Dhaka
+    0x7c1c00cf, // AUS Central Standard Time -> Australia/Darwin
+    0x6754e818, // Tocantins Standard Time -> America/Araguaina
+    0x8cf030be, // Europe/Tallinn
+    0xe54617ce, // Volgograd Standard Time -> Europe/Volgograd
+    0x54cf41cf, // Europe/Sarajevo
+    0xa414f107, // WET
+    0x19b04026, // Asia/Dushanbe
+    0x334a20e9, // Asia/Sakhalin
+    0x9b9f65db, // Iran Standard Time -> Asia/Tehran
+    0x89fc8fec, // Etc/UTC
+    0xd21c637a, // West Asia Standard Time -> Asia/Tashkent
+    0xdaefd3c1, // Hawaiian Standard Time -> Pacific/Honolulu
+    0x7c58b2fb, // Etc/Universal
+    0xeaddf491, // Cen. Australia Standard Time -> Australia/Adelaide
+    0x75de8761, // Antarctica/Davis
+    0xdb24e5b7, // Etc/GMT-11
+    0xa39f98f1, // America/Argentina/Salta
+    0x470ca52b, // US/Central
+    0x9a4217df, // South Sudan Standard Time -> Africa/Juba
+    0xd4d24271, // Australia/Melbourne
+    0x38f99092, // Pacific/Fakaofo
+    0x543d0ef5, // America/Nome
+    0x9d521a4b, // Europe/Zurich
+    0xa3887beb, // Africa/Tunis
+    0x01705d3d, // Africa/Gaborone
+    0xfcccc54c, // Ekaterinburg Standard Time -> Asia/Yekaterinburg
+    0x8a169de8, // UTC-08 -> Etc/GMT+8
+    0x82d14916, // Europe/Vilnius
+    0x9d18da0a, // Canada/Yukon
+    0xbe803f4e, // Europe/London
+    0xb317bfbf, // America/Phoenix
+    0xa48ef8d4, // Europe/Simferopol
+    0x0538ae09, // Turkey Standard Time -> Europe/Istanbul
+    0xa3d02b01, // UTC+12 -> Etc/GMT-12
+    0xbc2efba9, // Jamaica
+    0xe93c5f00, // W. Australia Standard Time -> Australia/Perth
+    0x2c17f928, // America/Porto_Acre
+    0x7ae821b7, // ROC
+    0xa28f44fb, // Japan
+    0xc76b4068, // Europe/Vatican
+    0x6212f25f, // Africa/Asmera
+    0xa2d0296e, // UTC+13 -> Etc/GMT-13
+    0xae3e0b5b, // Europe/Zagreb
+    0x05654224, // America/Rainy_River
+    0x5edaa64a, // Etc/Greenwich
+    0x31134943, // Europe/San_Marino
+    0x3d4019c4, // Brazil/DeNoronha
+    0x7afb85ae, // America/Jamaica
+    0xc4ee4377, // Europe/Bratislava
+    0xb5393381, // Asia/Shanghai
+    0x1509ae69, // Turks And Caicos Standard Time -> America/Grand_Turk
+    0xaaea918a, // America/Santiago
+    0x112465b2, // NZ-CHAT
+    0x5027e362, // Asia/Chungking
+    0x13ac84ed, // America/Porto_Velho
+    0x7f23c0b0, // Europe/Podgorica
+    0x7e0adc17, // America/Detroit
+    0x3fb84d59, // GMT Standard Time -> Europe/London
+    0x2743126a, // Africa/Ouagadougou
+    0x27fa3213, // America/Kentucky/Louisville
+    0x02176fb4, // Africa/Ceuta
+    0x4c5ffce2, // Cuba Standard Time -> America/Havana
+    0x4263827e, // Mauritius Standard Time -> Indian/Mauritius
+    0xced865bc, // Pacific/Galapagos
+    0xdaadd50c, // Africa/Bangui
+    0x5862eb49, // MET
+    0xd16aa440, // Asia/Choibalsan
+    0x9dcce782, // Pacific/Port_Moresby
+    0x796d7b7f, // America/Argentina/Catamarca
+    0xf668748f, // Caucasus Standard Time -> Asia/Yerevan
+    0x105682ad, // America/St_Kitts
+    0xad9886ca, // America/Creston
+    0x6fff5489, // Belarus Standard Time -> Europe/Minsk
+    0x0d8ee0be, // America/Port-au-Prince
+    0x5ad0a772, // Etc/GMT+5
+    0x268c9f87, // Portugal
+    0x6c12d442, // America/Whitehorse
+    0xab73e630, // America/Indiana/Vincennes
+    0xe44314d9, // Europe/Athens
+    0x9c054990, // Asia/Taipei
+    0x8388b3e4, // America/Anchorage
+    0x686b615c, // America/Denver
+    0x81a94e85, // Israel
+    0x9bc48b0c, // Russia Time Zone 3 -> Europe/Samara
+    0x23993fd7, // Europe/Kirov
+    0x88d2073c, // US/Michigan
+    0xa76d1515, // Asia/Kuwait
+    0x9af27096, // Asia/Hong_Kong
+    0x94bab217, // Australia/South
+    0xd91f8e4a, // Indian/Maldives
+    0xc87a49e5, // America/Indiana/Knox
+    0x394af297, // America/Argentina/Rio_Gallegos
+    0x23b262fb, // America/Martinique
+    0x3110c412, // Sakhalin Standard Time -> Asia/Sakhalin
+    0x3d58a0fb, // Europe/Monaco
+    0x75492e6e, // Indian/Comoro
+    0x7fd5a7f2, // Australia/Sydney
+    0xc287ca72, // GTB Standard Time -> Europe/Bucharest
+    0xe192c222, // America/North_Dakota/Center
+    0xe87de3cb, // America/Tortola
+    0x62dfbe94, // Etc/GMT-9
+    0xe6358db4, // Romance Standard Time -> Europe/Paris
+    0x35a42fc3, // Paraguay Standard Time -> America/Asuncion
+    0x80a7d409, // Antarctica/Palmer
+    0x04ba57f3, // Africa/Tripoli
+    0xa793b71d, // America/Yellowknife
+    0x8455de0f, // Pacific/Chatham
+    0x97901e76, // America/Argentina/Cordoba
+    0x60f9dae1, // America/Argentina/Jujuy
+    0x0190f190, // Atlantic/South_Georgia
+    0xd1303c2c, // PRC
+    0xdd24e8dd, // Etc/GMT-13
+    0xa11cbf72, // Europe/Sofia
+    0xa3e52536, // Central Europe Standard Time -> Europe/Budapest
+    0x3e695605, // Poland
+    0xf5e78532, // Europe/Isle_of_Man
+    0x2b125bb5, // Europe/Helsinki
+    0xa0f64ffb, // Pacific/Easter
+    0x40790a56, // America/Coyhaique
+    0x7b00b936, // Hongkong
+    0x1d47c604, // Mountain Standard Time -> America/Denver
+    0x29446fe1, // America/Punta_Arenas
+    0x3a606f86, // Europe/Nicosia
+    0x8e6d072c, // America/Inuvik
+    0xfa2f94a3, // Atlantic/Faroe
+    0x20cfedd1, // Asia/Barnaul
+    0xfbb7eff7, // Canada/Pacific
+    0x6a2ce86e, // America/St_Johns
+    0x57dfad43, // Etc/GMT-4
+    0x083d1cbc, // Altai Standard Time -> Asia/Barnaul
+    0xa6cd5f5e, // Etc/UCT
+    0xc16d9735, // Etc/GMT+11
+    0xd9217e23, // Europe/Bucharest
+    0x6a4c2015, // Europe/Riga
+    0x1478d996, // Pacific/Tongatapu
+    0x0d198d72, // America/Tegucigalpa
+    0x184e6476, // Asia/Tbilisi
+    0x32957e52, // Africa/Johannesburg
+    0x5adfb1fc, // Etc/GMT-1
+    0x386e7be1, // Brazil/Acre
+    0xd88b6524, // Pacific/Palau
+    0xa256ac26, // Qyzylorda Standard Time -> Asia/Qyzylorda
+    0x72062516, // Pacific/Nauru
+    0xc3d8bc6e, // Easter Island Standard Time -> Pacific/Easter
+    0xc3a4f5c8, // America/Atikokan
+    0x3ea12dc3, // America/Marigot
+    0xca03b031, // Antarctica/Troll
+    0x5cdfb522, // Etc/GMT-3
+    0x41b4c5ff, // Asia/Novokuznetsk
+    0xdf326948, // Canada Central Standard Time -> America/Regina
+    0xc609fa2a, // Pacific/Tahiti
+    0xde108d60, // Africa/Ndjamena
+    0x4db2b795, // Brazil/East
+    0x0124a15f, // Asia/Bishkek
+    0x8be415da, // Asia/Tomsk
+    0xa6081577, // America/Mexico_City
+    0xc385fd1b, // America/Argentina/Tucuman
+    0xa91c58d7, // Canada/Newfoundland
+    0x8111f1ad, // America/Belem
+    0x81a0b43c, // America/Cordoba
+    0x44daa40a, // US Mountain Standard Time -> America/Phoenix
+    0x5ed0adbe, // Etc/GMT+9
+    0xd543b010, // Astrakhan Standard Time -> Europe/Astrakhan
+    0x54d09e00, // Etc/GMT+3
+    0x207cb451, // Eastern Standard Time (Mexico) -> America/Cancun
+    0x03627eeb, // SE Asia Standard Time -> Asia/Bangkok
+    0xc920fbdd, // Tasmania Standard Time -> Australia/Hobart
+    0x277a3b1d, // Pacific/Majuro
+    0x5e6b8d26, // Russia Time Zone 10 -> Asia/Srednekolymsk
+    0xd97fdd83, // Antarctica/Mawson
+    0x88a6687d, // America/Swift_Current
+    0x9b30ece3, // Africa/Timbuktu
+    0x815ef836, // Myanmar Standard Time -> Asia/Rangoon
+    0x36930a02, // Navajo
+    0x2459547b, // Middle East Standard Time -> Asia/Beirut
+    0x151eeb2a, // Africa/Lagos
+    0x5b083fbb, // Africa/Kampala
+    0xa3989009, // America/Lima
+    0xc01875e7, // America/Port_of_Spain
+    0x5ddfb6b5, // Etc/GMT-2
+    0xdc24e74a, // Etc/GMT-12
+    0xd0a40347, // Africa/Addis_Ababa
+    0xf2388c8c, // Cuba
+    0x593a435d, // Europe/Astrakhan
+    0x0d80f950, // America/Hermosillo
+    0x5cd0efec, // GB
+    0x3310b275, // Africa/Sao_Tome
+    0x2ee66dd1, // NZ
+    0x3a3292e6, // Atlantic/Bermuda
+    0xd624ddd8, // Etc/GMT-14
+    0x24a79c47, // America/Dawson_Creek
+    0x2b6486e8, // Asia/Manila
+    0x50f09a09, // Jordan Standard Time -> Asia/Amman
+    0xda3292a4, // Europe/Luxembourg
+    0x636d5dfc, // Atlantic/Reykjavik
+    0x0f910492, // Africa/Lubumbashi
+    0x647b7116, // Europe/Dublin
+    0x9762f31a, // Atlantic/Jan_Mayen
+    0xd8c60798, // Atlantic/Faeroe
+    0x9d396797, // Greenland Standard Time -> America/Godthab
+    0x35c21c5f, // America/Montserrat
+    0xd7b790f2, // America/Asuncion
+    0x7045bc4e, // America/Argentina/Mendoza
+    0x18228c0c, // Pacific/Guadalcanal
+    0x803555fc, // Libya Standard Time -> Africa/Tripoli
+    0x583c4695, // Pacific/Wallis
+    0x1a629ffa, // Africa/Malabo
+    0x403618a8, // America/Scoresbysund
+    0x0a730cb6, // America/Indiana/Petersburg
+    0xb8ffe55e, // Asia/Jerusalem
+    0xbc378380, // Canada/Atlantic
+    0xde842ec1, // America/Noronha
+    0xd435f4b1, // Africa/Conakry
+    0x83d49e3c, // Europe/Gibraltar
+    0x53869679, // America/Cambridge_Bay
+    0x5fd0af51, // Etc/GMT+8
+    0x6b2f60cd, // Asia/Dubai
+    0x9d46d8d5, // Africa/Casablanca
+    0x05c0aa0f, // Pacific/Kwajalein
+    0x36106812, // Europe/Tiraspol
+    0xd5c98f4d, // Asia/Karachi
+    0x8c8b2c5f, // Asia/Qyzylorda
+    0xc06d95a2, // Etc/GMT+10
+    0x323aff79, // Eastern Standard Time -> America/New_York
+    0xda1fb251, // Asia/Gaza
+    0x13c63993, // Europe/Samara
+    0x84761f90, // SA Pacific Standard Time -> America/Bogota
+    0x0d6f7a68, // America/Sitka
+    0x41c020d4, // Pacific/Midway
+    0x7ca6fc4b, // America/Vancouver
+    0xcbc276b5, // Iran
+    0x0ad00ebe, // Australia/Brisbane
+    0x26f27493, // Asia/Thimbu
+    0xe0449f9f, // America/Shiprock
+    0x5bd0a905, // Etc/GMT+4
+    0x60554990, // US/East-Indiana
+    0x55430f33, // Asia/Macao
+    0xbdf2f38b, // Africa/Kigali
+    0xdd18ea92, // Antarctica/Macquarie
+    0x7b669695, // Europe/Madrid
+    0xcb73241d, // GMT0
+    0x5bbd5288, // America/El_Salvador
+    0x8eeb637e, // Asia/Tokyo
+    0xe4da8899, // America/Ojinaga
+    0x932307f5, // Syria Standard Time -> Asia/Damascus
+    0xe325dc7e, // America/Montreal
+    0xfe29c2fa, // Pacific/Noumea
+    0xfbb761d5, // America/Puerto_Rico
+    0xb4038b66, // Pacific/Bougainville
+    0x9a1da2ac, // America/Metlakatla
+    0xa5a264ab, // Europe/Kiev
+    0xd1f46bc8, // Indian/Mayotte
+    0xd248042e, // Asia/Omsk
+    0x5adc8757, // Nepal Standard Time -> Asia/Katmandu
+    0x48045a82, // Europe/Guernsey
+    0x36e0e036, // Pacific/Niue
+    0xb0f63a1d, // Asia/Jayapura
+    0x37188650, // Pacific/Pohnpei
+    0xdf76a985, // America/Winnipeg
+    0xc9855702, // Africa/Nouakchott
+    0xd31f79b8, // Europe/Amsterdam
+    0xd7a01530, // Pacific/Rarotonga
+    0x864702e9, // America/Nassau
+    0xe0aa9e5f, // Asia/Irkutsk
+    0xe61883db, // Europe/Lisbon
+    0x299d01c8, // Etc/Zulu
+    0x89cc11c8, // Europe/Ulyanovsk
+    0xdd92c2b5, // Pacific/Fiji
+    0xe7cd241a, // America/Indiana/Tell_City
+    0x28809bd7, // Pacific/Saipan
+    0xa35a8c39, // Kaliningrad Standard Time -> Europe/Kaliningrad
+    0x211e0a68, // Pacific/Auckland
+    0x2c7894e4, // Chile/EasterIsland
+    0x503dc8b7, // Asia/Baghdad
+    0x4251e7b0, // PST8PDT
+    0x457781b0, // America/Montevideo
+    0x25d5a177, // America/Fort_Nelson
+    0xc093936e, // New Zealand Standard Time -> Pacific/Auckland
+    0x2a9c6f69, // Asia/Vientiane
+    0xdc444367, // Asia/Makassar
+    0x1c2ff935, // Asia/Magadan
+    0x58970dd6, // Pacific/Johnston
+    0x41e33ade, // China Standard Time -> Asia/Shanghai
+    0x335e9c26, // Africa/Djibouti
+    0xdd8e2b30, // Russian Standard Time -> Europe/Moscow
+    0xd7e1af08, // Egypt
+    0xe6416b64, // Canada/Eastern
+    0x502fdc87, // Australia/Victoria
+    0xe688197c, // W. Europe Standard Time -> Europe/Berlin
+    0x01d287ac, // Central Standard Time -> America/Chicago
+    0x6ad1dfdc, // America/Danmarkshavn
+    0x7339b6f0, // Asia/Krasnoyarsk
+    0xab8083a3, // Asia/Urumqi
+    0x244a6c65, // Pacific/Chuuk
+    0x9c7dcb20, // Norfolk Standard Time -> Pacific/Norfolk
+    0x5bdfb38f, // Etc/GMT-0
+    0x58dfaed6, // Etc/GMT-7
+    0xab610136, // Pacific Standard Time -> America/Los_Angeles
+    0xbd18225b, // Transbaikal Standard Time -> Asia/Chita
+    0xbbf13aaf, // Africa/Windhoek
+    0x627ed078, // Australia/Hobart
+    0x0f6163aa, // America/Blanc-Sablon
+    0x57d0a2b9, // Etc/GMT+0
+    0x16ded075, // America/Argentina/La_Rioja
+    0x2f50fb15, // US/Aleutian
+    0xc04c96bd, // Australia/North
+    0xc6fa91bf, // GMT
+    0x50c17f8d, // Mexico/BajaNorte
+    0x40618463, // West Pacific Standard Time -> Pacific/Port_Moresby
+    0x4a4b05e5, // Dateline Standard Time -> Etc/GMT+12
+    0x9f822182, // Cape Verde Standard Time -> Atlantic/Cape_Verde
+    0x236cb7c1, // America/Indiana/Winamac
+    0x5c22ab3b, // Korea Standard Time -> Asia/Seoul
+    0xa9f332bb, // Europe/Ljubljana
+    0x1367a775, // America/Cayenne
+    0x365363d4, // America/Chicago
+    0x93ec809f, // US/Indiana-Starke
+    0xa5d03082, // America/St_Lucia
+    0x8c9b2d82, // Indian/Mauritius
+    0xcc18acd9, // Asia/Ho_Chi_Minh
+    0x8de31f63, // Taipei Standard Time -> Asia/Taipei
+    0xc0ca3eb3, // America/Jujuy
+    0xbcd0a23f, // Africa/Blantyre
+    0xf14df224, // GMT+0
+    0x16a558f8, // Africa/Dar_es_Salaam
+    0x8adb80e4, // America/Tijuana
+    0x8a7a4848, // Africa/Accra
+    0x92f933a6, // Europe/Budapest
+    0x72e8151f, // ROK
+    0x5cc4672b, // Australia/Lord_Howe
+    0x5f6b8eb9, // Russia Time Zone 11 -> Asia/Kamchatka
+    0x48394fd1, // Asia/Anadyr
+    0xd8ec8642, // Africa/Libreville
+    0xa1fa1033, // Africa/Lusaka
+    0xc052dfe2, // America/Nipigon
+    0xadd6143b, // Pacific/Truk
+    0xe3500ff5, // Georgian Standard Time -> Asia/Tbilisi
+    0x737a2397, // Europe/Kyiv
+    0x63dfc027, // Etc/GMT-8
+    0xf4559c17, // Africa/Maseru
+    0xbc03606d, // Asia/Brunei
+    0x61b0954f, // Australia/Yancowinna
+    0x0e7957ef, // Asia/Ulan_Bator
+    0x22d1cc2e, // Asia/Qostanay
+    0xd77dee9b, // America/Halifax
+    0x90d1eb28, // America/Ciudad_Juarez
+    0x215f0598, // Asia/Yangon
+    0x53c1275a, // America/Curacao
+    0x36532a60, // Europe/Uzhgorod
+    0x9e3ec36d, // America/Nuuk
+    0x0d42fc7f, // Pacific/Guam
+    0x31405cd4, // Europe/Berlin
+    0x1aec1da7, // Tomsk Standard Time -> Asia/Tomsk
+    0x07213b7a, // America/Guayaquil
+    0x087b2252, // Europe/Istanbul
+    0x30323aad, // America/Anguilla
+    0xfb32b2a9, // Lord Howe Standard Time -> Australia/Lord_Howe
+    0x7371bceb, // Asia/Famagusta
+    0xc06e567d, // UTC
+    0x1cd8d6bf, // Central Pacific Standard Time -> Pacific/Guadalcanal
+    0x900a1838, // Asia/Ulaanbaatar
+    0x62bea207, // Morocco Standard Time -> Africa/Casablanca
+    0x1f13597b, // Marquesas Standard Time -> Pacific/Marquesas
+    0xe8719b01, // Asia/Ashkhabad
+    0xff870b5d, // Asia/Ujung_Pandang
+    0x0e88bec9, // Indian/Reunion
+    0x7c1b0559, // Saint Pierre Standard Time -> America/Miquelon
+    0xeebfa085, // Asia/Kolkata
+    0x7bc93b1e, // Australia/ACT
+    0x6f433821, // Asia/Macau
+    0xa0362ea0, // Africa/Maputo
+    0x544fafe4, // Haiti Standard Time -> America/Port-au-Prince
+    0xc5934f62, // West Bank Standard Time -> Asia/Hebron
+    0x59dfb069, // Etc/GMT-6
+    0x1d8508e1, // Mexico/General
+    0x31c97a99, // America/Virgin
+    0xf967b124, // Pakistan Standard Time -> Asia/Karachi
+    0x3469da3a, // Asia/Rangoon
+    0x67627258, // Asia/Yekaterinburg
+    0xba1c3b71, // America/Indianapolis
+    0x6b0cb0c9, // Central European Standard Time -> Europe/Warsaw
+    0x1a408790, // Europe/Jersey
+    0x154cc4e3, // America/St_Vincent
+    0xf10694f7, // Asia/Kashgar
+    0xebea80d2, // America/Edmonton
+    0xa3300aae, // America/Rio_Branco
+    0x270ed30d, // Asia/Bahrain
+    0x898d16b4, // America/Indiana/Marengo
+    0x2b2807ee, // Europe/Chisinau
+    0xf19101cc, // America/Louisville
+    0xdbffe145, // Asia/Baku
+    0x1e9c706b, // Africa/Asmara
+    0xe5496212, // GMT-0
+    0xa8dc3202, // Asia/Tashkent
+    0xe7d9947f, // Brazil/West
+    0x8935717d, // America/Araguaina
+    0x56dfabb0, // Etc/GMT-5
+    0x2743670e, // Antarctica/South_Pole
+    0xb36acd21, // Antarctica/Casey
+    0xed7cffe6, // Pacific/Kanton
+    0x9d1a17ce, // CST6CDT
+    0x0796405c, // America/New_York
+    0x80c9cfcc, // Magadan Standard Time -> Asia/Magadan
+    0xea878251, // Europe/Belfast
+    0x7d6a8987, // America/Antigua
+    0x5eaf0939, // America/Ensenada
+    0x55d09f93, // Etc/GMT+2
+    0x6474c4e0, // Aleutian Standard Time -> America/Adak
+    0x6a2c2b3f, // W. Central Africa Standard Time -> Africa/Lagos
+    0x30f758ee, // America/Grenada
+    0xdaf5d05c, // Europe/Prague
+    0xcfee0be3, // US/Alaska
+    0xc12de811, // EET
+    0xa0f29f32, // Europe/Belgrade
+    0xcf31c5a5, // America/Godthab
+    0xc7452675, // America/Thunder_Bay
+    0x6dfa7f8f, // Europe/Paris
+    0x26c46b64, // America/Moncton
+    0xac41aaad, // Asia/Kamchatka
+    0xc29cf35f, // Singapore Standard Time -> Asia/Singapore
+    0x816c86e8, // HST
+    0x4fd42ebf, // Afghanistan Standard Time -> Asia/Kabul
+    0xad8ae11c, // Europe/Vaduz
+    0x08a591c3, // SA Eastern Standard Time -> America/Cayenne
+    0xd7336426, // Central Asia Standard Time -> Asia/Bishkek
+    0x096adc77, // Antarctica/McMurdo
+    0x9fb03810, // America/St_Thomas
+    0x412b3ea9, // Asia/Thimphu
+    0x8d527a6a, // Australia/Eucla
+    0x3c9d1242, // US/Eastern
+    0xdabedef4, // GB-Eire
+    0xebc4bae9, // Asia/Muscat
+    0x73d4ef07, // Australia/Broken_Hill
+    0x68350638, // Chile/Continental
+    0xbee32f3c, // Asia/Yakutsk
+    0x6c9f0b20, // Bougainville Standard Time -> Pacific/Bougainville
+    0x0bb24bef, // Turkey
+    0x99387cd4, // America/Los_Angeles
+    0x027128e7, // Arab Standard Time -> Asia/Riyadh
+    0x00b18429, // America/Argentina/ComodRivadavia
+    0x5078b7b2, // Venezuela Standard Time -> America/Caracas
+    0xedc8b11f, // Africa/Dakar
+    0xa941464d, // Asia/Saigon
+    0x8e57470c, // Asia/Atyrau
+    0xfd50d8c7, // EST
+    0x3c95ead7, // America/Matamoros
+    0x4d661360, // Australia/Tasmania
+    0x65f13f8c, // Europe/Stockholm
+    0xeb67e208, // Pacific/Samoa
+    0xda24e424, // Etc/GMT-10
+    0x47f6d02c, // America/Miquelon
+    0x94e11326, // South Africa Standard Time -> Africa/Johannesburg
+    0xcf9a74ce, // America/Indiana/Vevay
+    0xe5bdb30a, // America/Fortaleza
+    0xd084eaa8, // Australia/Currie
+    0xbf09e573, // Africa/Abidjan
+    0xfa51012f, // Yukon Standard Time -> America/Whitehorse
+    0x9abef296, // Asia/Nicosia
+    0x84616a89, // America/Sao_Paulo
+    0xd71823d5, // US/Pacific
+    0xea8d067c, // Africa/Cairo
+    0x963b1af7, // Europe/Zaporozhye
+    0xfaaf5187, // Asia/Kabul
+    0x2c07183b, // Africa/Harare
+    0xbb3eaae3, // Pacific/Funafuti
+    0x57704140, // Aus Central W. Standard Time -> Australia/Eucla
+    0xdde257d5, // Asia/Pontianak
+    0xbe6d927c, // Etc/GMT+12
+    0x52b4e733, // Europe/Vienna
+    0x2af09cab, // Israel Standard Time -> Asia/Jerusalem
+    0x762c96a8, // Europe/Kaliningrad
+    0x290a0946, // Africa/Nairobi
+    0x2d919b89, // Africa/Bissau
+    0x36870b5f, // America/Monterrey
+    0xdddd4350, // Asia/Harbin
+    0x8085e070, // Africa/Kinshasa
+    0x1c9e9d88, // Pacific/Pago_Pago
+    0xb1099405, // Pacific/Marquesas
+    0x3cfec6b8, // Central America Standard Time -> America/Guatemala
+    0x48115e29, // Europe/Malta
+    0x944a76f1, // America/Pangnirtung
+    0xc586cd85, // Iceland
+    0xc9259ab2, // America/Argentina/Ushuaia
+    0x84868d5a, // Asia/Chongqing
+    0x0e70bef7, // Australia/Adelaide
+    0x6595d0f9, // Pacific/Pitcairn
+    0xa30c41b5, // Africa/Bamako
+    0xca600c69, // America/Argentina/Buenos_Aires
+    0x66b415cd, // Africa/Niamey
+    0x1bcc12b6, // Sudan Standard Time -> Africa/Khartoum
+    0x349483cc, // America/Mendoza
+    0x75b5030f, // America/Santarem
+    0x78fa75a6, // America/North_Dakota/Beulah
+    0xcce44d52, // America/Boise
+    0x71ee932c, // North Asia Standard Time -> Asia/Krasnoyarsk
+    0x6b20b1f6, // America/Campo_Grande
+    0x9c3899e6, // Africa/Brazzaville
+    0x69f8711b, // Asia/Katmandu
+    0x6e900eed, // Greenwich Standard Time -> Atlantic/Reykjavik
+    0x8adf9cb5, // America/Bahia
+    0xd8e02cf3, // Montevideo Standard Time -> America/Montevideo
+    0xd122fdcf, // US/Hawaii
+    0xbfd5a989, // America/Toronto
+    0x044685d6, // America/Juneau
+    0x869e3c80, // America/Dawson
+    0x5a2fae4a, // Europe/Mariehamn
+    0x0a3d9401, // America/St_Barthelemy
+    0x3ec3d476, // Australia/NSW
+    0xd7a437fb, // Europe/Tirane
+    0x4391107e, // Asia/Amman
+    0xbdd04cad, // America/Catamarca
+    0x99a17f62, // Antarctica/DumontDUrville
+    0x5fc126bc, // America/Fort_Wayne
+    0xc78ebb26, // Pacific/Kiritimati
+    0xb7043b25, // Pacific/Enderbury
+    0x61db443d, // Asia/Qatar
+    0x0043c061, // North Asia East Standard Time -> Asia/Irkutsk
+    0x37150e50, // Atlantic/Cape_Verde
+    0x126d63b4, // America/Thule
+    0x0180ba15, // America/Atka
+    0x426200cb, // Sao Tome Standard Time -> Africa/Sao_Tome
+    0x59bc664f, // Asia/Novosibirsk
+    0xa1b683b3, // Africa/Monrovia
+    0x0d98d790, // Australia/Canberra
+    0x0082155c, // Europe/Moscow
+    0x3b037304, // America/Costa_Rica
+    0x2a9396dd, // America/Menominee
+    0x84169476, // UTC-02 -> Etc/GMT+2
+    0x1ed23f55, // Vladivostok Standard Time -> Asia/Vladivostok
+    0xb7f9f738, // America/Recife
+    0xbefc6c3b, // Asia/Riyadh
+    0x4d386c51, // Asia/Colombo
+    0xf20ef746, // America/Bogota
+    0x56d0a126, // Etc/GMT+1
+    0x36147c3b, // America/Grand_Turk
+    0xe2d24ace, // America/Maceio
+    0xd74b6e0a, // Libya
+    0xfe5e128f, // America/Aruba
+    0x7884b118, // Asia/Aqtau
+    0xe912db7b, // Antarctica/Syowa
+    0xf9c2e80a, // Universal
+    0xf55f9acd, // Australia/LHI
+    0x018e2419, // Ulaanbaatar Standard Time -> Asia/Ulaanbaatar
+    0x873fae6c, // W. Mongolia Standard Time -> Asia/Hovd
+    0x85db602e, // Pacific SA Standard Time -> America/Santiago
+};
+
+static const uint16_t tz_posix_rule_of[TZ_POSIX_COUNT] = {
+    32, 21, 9, 75, 80, 48, 23, 79, 12, 66, 50, 25, 55, 49, 48, 17,
+    66, 28, 58, 67, 15, 89, 28, 7, 18, 12, 47, 52, 55, 21, 17, 22,
+    46, 55, 4, 76, 40, 22, 6, 79, 56, 79, 67, 90, 65, 52, 70, 67,
+    56, 86, 21, 55, 6, 85, 51, 11, 35, 74, 64, 28, 52, 14, 52, 9,
+    55, 18, 28, 58, 3, 50, 55, 56, 54, 88, 6, 55, 22, 63, 48, 67,
+    66, 30, 52, 61, 11, 76, 28, 88, 47, 67, 38, 46, 52, 6, 11, 25,
+    28, 67, 80, 60, 65, 1, 28, 6, 15, 14, 78, 19, 8, 44, 80, 30,
+    33, 9, 9, 87, 49, 47, 52, 18, 44, 55, 47, 10, 72, 21, 67, 71,
+    6, 42, 52, 50, 28, 4, 30, 14, 17, 30, 55, 66, 12, 4, 79, 30,
+    76, 45, 9, 78, 9, 9, 14, 30, 30, 52, 56, 79, 50, 12, 47, 65,
+    91, 73, 20, 81, 66, 58, 28, 90, 12, 52, 47, 85, 28, 4, 30, 89,
+    15, 38, 65, 56, 15, 74, 18, 44, 62, 11, 89, 28, 4, 11, 42, 28,
+    63, 78, 52, 90, 9, 18, 3, 88, 9, 70, 88, 43, 12, 18, 28, 56,
+    50, 45, 22, 46, 52, 51, 50, 9, 36, 63, 79, 68, 79, 78, 4, 21,
+    65, 49, 32, 53, 75, 52, 58, 22, 52, 56, 67, 52, 26, 65, 52, 53,
+    66, 31, 20, 53, 30, 52, 66, 68, 67, 66, 52, 54, 6, 33, 89, 77,
+    14, 17, 28, 6, 47, 79, 4, 66, 32, 90, 79, 66, 63, 53, 46, 80,
+    73, 6, 78, 66, 4, 69, 43, 9, 56, 28, 47, 18, 52, 58, 45, 63,
+    56, 47, 15, 52, 28, 28, 59, 80, 20, 28, 28, 26, 53, 22, 63, 52,
+    52, 68, 63, 34, 28, 69, 80, 28, 63, 80, 90, 12, 85, 81, 6, 12,
+    88, 40, 63, 63, 22, 55, 6, 86, 1, 32, 15, 9, 21, 34, 65, 47,
+    0, 4, 12, 55, 39, 89, 28, 11, 12, 55, 28, 81, 28, 28, 79, 38,
+    6, 28, 65, 12, 45, 21, 18, 9, 55, 67, 10, 80, 62, 89, 58, 32,
+    47, 2, 21, 58, 54, 6, 79, 68, 67, 82, 48, 23, 79, 84, 4, 52,
+    67, 50, 72, 52, 90, 27, 47, 28, 28, 18, 59, 21, 89, 27, 66, 73,
+    48, 26, 67, 52, 80, 36, 6, 1, 21, 61, 83, 9, 39, 66, 60, 6,
+    32, 46, 87, 85, 3, 44, 11, 80, 30, 66, 53, 50, 45, 52, 67, 55,
+    75, 56, 4, 66, 18, 47, 18, 46, 63, 58, 11, 8, 68, 40, 92, 18,
+    56, 67, 52, 39, 66, 14, 90, 88, 6, 21, 56, 57, 59, 82, 34, 4,
+    85, 28, 79, 82, 12, 93, 18, 70, 53, 58, 78, 64, 66, 45, 52, 56,
+    67, 12, 11, 17, 19, 67, 12, 85, 15, 50, 45, 47, 67, 28, 71, 42,
+    67, 85, 17, 41, 24, 66, 76, 52, 28, 56, 56, 47, 6, 12, 53, 28,
+    50, 67, 58, 85, 67, 52, 76, 16, 21, 21, 89, 50, 66, 17, 6, 63,
+    14, 86, 14, 43, 14, 9, 48, 80, 10, 47, 63, 27, 57, 52, 12, 32,
+    4, 47, 16, 63, 88, 18, 14, 1, 37, 9, 93, 6, 29, 74, 45, 53,
+    50, 66, 60, 11, 55, 47, 83, 10, 9, 66, 52, 68, 47, 11, 80, 32,
+    4, 66, 61, 66, 6, 58, 67, 9, 30, 28, 9, 82, 14, 22, 56, 66,
+    18, 68, 47, 85, 26, 71, 89, 47, 52, 46, 63, 52, 27, 66, 52, 48,
+    21, 14, 70, 5, 52, 28, 11, 82, 47, 11, 13, 66, 68, 6, 43, 31,
+    15, 18, 4, 85, 4, 28, 30, 67, 12, 9, 65, 56, 45, 52, 87, 17,
+    29, 86, 66, 28, 45, 67, 79, 63, 28, 85, 64, 63, 5, 50, 21, 13,
+    91, 41, 52, 73, 59, 58, 67, 55, 53, 89, 87, 37, 55, 52, 66, 67,
+    28, 53, 43, 36, 67, 28, 89, 50, 28, 28, 56, 80, 12, 30, 89, 8,
+    67, 28, 28, 70, 66, 46, 79, 63, 47, 45, 52, 4, 28, 17, 66, 23,
+    22, 4, 14, 24, 48, 71, 67, 12, 67, 45, 78, 55, 56, 26, 17, 28,
+    4, 7, 32, 24, 66, 28, 59, 47, 9, 4, 88, 16, 14, 12, 31,
+};
+
+#endif // TZ_POSIX_TABLE_H
@@ -4,10 +4,18 @@
 #include "esp_log.h"
 #include "esp_event.h"
 #include "esp_netif.h"
+#include "esp_netif_net_stack.h"
+#include "esp_attr.h"
+#include "esp_mac.h"
+#include "esp_timer.h"
+#include "lwip/dhcp.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/event_groups.h"
 
+#include <inttypes.h>
+#include <stdio.h>
 #include <string.h>
+#include <time.h>
 
 static const char *TAG = "wifi_manager";
 
@@ -20,12 +28,118 @@ static esp_netif_t *s_sta_netif = NULL;
 static int s_retry_num = 0;
 static const int MAX_RETRIES = 5;
 
+#define LEASE_MARGIN        (10 * 60)   // A cached lease must outlast a wake by this much
+#define LEASE_MAX           (24 * 3600) // Longer leases are cut, so DHCP runs at least daily
+
+/**
+ * @brief The last connection, kept in RTC memory through deep sleep.
+ *
+ * Lets the next wake associate without scanning and, while the DHCP lease
+ * lasts, configure the address it was given without asking for it again.
+ * Lost on a power-on or reset, after which the next connect is a full one.
+ */
+typedef struct {
+    bool valid;
+    char ssid[33];                  // Network it was made to, in case credentials.h changes
+    uint8_t bssid[6];
+    uint8_t channel;
+    bool has_lease;
+    esp_netif_ip_info_t ip_info;    // Address, netmask and gateway given by DHCP
+    esp_netif_dns_info_t dns;
+    int64_t lease_expires;          // Unix time the lease runs out
+} last_connection_t;
+
+static RTC_DATA_ATTR last_connection_t s_last;
+
+static bool s_directed;             // Connecting to the cached BSSID and channel
+static bool s_static_ip;            // Using the cached lease instead of DHCP
+static int64_t s_started_us;
+static int64_t s_associated_us;
+static int64_t s_got_ip_us;
+
+static void set_sta_config(bool directed)
+{
+    wifi_config_t wifi_config = {
+        .sta = {
+            .ssid = WIFI_SSID,
+            .password = WIFI_PASSWORD,
+            .threshold.authmode = WIFI_AUTH_WPA2_PSK,
+        },
+    };
+    if (directed) {
+        memcpy(wifi_config.sta.bssid, s_last.bssid, sizeof(wifi_config.sta.bssid));
+        wifi_config.sta.bssid_set = true;
+        wifi_config.sta.channel = s_last.channel; // Scanned first
+    }
+    ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &wifi_config));
+}
+
+static bool lease_is_usable(void)
+{
+    return s_last.has_lease && (int64_t)time(NULL) + LEASE_MARGIN < s_last.lease_expires;
+}
+
+// As in ESP-IDF's static IP example: DHCP was started on association, so stop it again
+static void use_cached_lease(void)
+{
+    if (esp_netif_dhcpc_stop(s_sta_netif) != ESP_OK ||
+        esp_netif_set_dns_info(s_sta_netif, ESP_NETIF_DNS_MAIN, &s_last.dns) != ESP_OK ||
+        esp_netif_set_ip_info(s_sta_netif, &s_last.ip_info) != ESP_OK) {
+        ESP_LOGW(TAG, "Failed to set the cached IP, using DHCP");
+        s_last.has_lease = false;
+        esp_netif_dhcpc_start(s_sta_netif);
+        return;
+    }
+    s_static_ip = true;
+}
+
+// Seconds the current DHCP lease was granted for, 0 if there is none
+static uint32_t dhcp_lease_seconds(void)
+{
+    struct netif *netif = esp_netif_get_netif_impl(s_sta_netif);
+    struct dhcp *dhcp = netif != NULL ? netif_dhcp_data(netif) : NULL;
+    return dhcp != NULL && dhcp->state == DHCP_STATE_BOUND ? dhcp->offered_t0_lease : 0;
+}
+
+// Keeps the lease DHCP gave this wake, while its address is still configured
+static void save_lease(void)
+{
+    uint32_t lease = dhcp_lease_seconds();
+    if (lease == 0 ||
+        esp_netif_get_ip_info(s_sta_netif, &s_last.ip_info) != ESP_OK ||
+        esp_netif_get_dns_info(s_sta_netif, ESP_NETIF_DNS_MAIN, &s_last.dns) != ESP_OK) {
+        s_last.has_lease = false;
+        return;
+    }
+    lease = lease < LEASE_MAX ? lease : LEASE_MAX;
+    int64_t held = (esp_timer_get_time() - s_got_ip_us) / 1000000;
+    s_last.lease_expires = (int64_t)time(NULL) - held + lease;
+    s_last.has_lease = true;
+    ESP_LOGI(TAG, "Keeping the lease of " IPSTR " for %" PRIu32 " s", IP2STR(&s_last.ip_info.ip), lease);
+}
+
 static void event_handler(void* arg, esp_event_base_t event_base, int32_t event_id, void* event_data)
 {
     if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_START) {
         esp_wifi_connect();
+    } else if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_CONNECTED) {
+        s_associated_us = esp_timer_get_time();
+        if (s_directed && lease_is_usable()) {
+            use_cached_lease();
+        }
     } else if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_DISCONNECTED) {
-        if (s_retry_num < MAX_RETRIES) {
+        if (s_directed) {
+            // The AP may have moved to another channel, or be gone; forget it and scan
+            ESP_LOGW(TAG, "Directed connect failed, scanning for the AP");
+            s_directed = false;
+            s_last.valid = false;
+            if (s_static_ip) {
+                s_static_ip = false;
+                esp_netif_dhcpc_start(s_sta_netif);
+            }
+            set_sta_config(false);
+            esp_wifi_connect();
+        } else if (s_retry_num < MAX_RETRIES) {
             esp_wifi_connect();
             s_retry_num++;
             ESP_LOGI(TAG, "Retrying to connect to the AP...");
@@ -36,6 +150,7 @@ static void event_handler(void* arg, esp_event_base_t event_base, int32_t event_
     } else if (event_base == IP_EVENT && event_id == IP_EVENT_STA_GOT_IP) {
         ip_event_got_ip_t* event = (ip_event_got_ip_t*) event_data;
         ESP_LOGI(TAG, "Got IP: " IPSTR, IP2STR(&event->ip_info.ip));
+        s_got_ip_us = esp_timer_get_time();
         s_retry_num = 0;
         xEventGroupSetBits(s_wifi_event_group, WIFI_CONNECTED_BIT);
     }
@@ -43,6 +158,7 @@ static void event_handler(void* arg, esp_event_base_t event_base, int32_t event_
 
 bool wifi_connect(void)
 {
+    s_started_us = esp_timer_get_time();
     s_wifi_event_group = xEventGroupCreate();
 
     ESP_ERROR_CHECK(esp_netif_init());
@@ -57,18 +173,19 @@ bool wifi_connect(void)
     ESP_ERROR_CHECK(esp_event_handler_instance_register(WIFI_EVENT, ESP_EVENT_ANY_ID, &event_handler, NULL, &instance_any_id));
     ESP_ERROR_CHECK(esp_event_handler_instance_register(IP_EVENT, IP_EVENT_STA_GOT_IP, &event_handler, NULL, &instance_got_ip));
 
-    wifi_config_t wifi_config = {
-        .sta = {
-            .ssid = WIFI_SSID,
-            .password = WIFI_PASSWORD,
-            .threshold.authmode = WIFI_AUTH_WPA2_PSK,
-        },
-    };
+    s_directed = s_last.valid && strcmp(s_last.ssid, WIFI_SSID) == 0;
+    s_static_ip = false;
+    s_retry_num = 0;
     ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA) );
-    ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &wifi_config) );
+    set_sta_config(s_directed);
     ESP_ERROR_CHECK(esp_wifi_start() );
 
-    ESP_LOGI(TAG, "Connecting to SSID: %s", WIFI_SSID);
+    if (s_directed) {
+        ESP_LOGI(TAG, "Connecting to SSID: %s at " MACSTR " on channel %d%s", WIFI_SSID,
+                 MAC2STR(s_last.bssid), s_last.channel, lease_is_usable() ? ", cached IP" : "");
+    } else {
+        ESP_LOGI(TAG, "Connecting to SSID: %s", WIFI_SSID);
+    }
 
     EventBits_t bits = xEventGroupWaitBits(s_wifi_event_group,
             WIFI_CONNECTED_BIT | WIFI_FAIL_BIT,
@@ -78,8 +195,22 @@ bool wifi_connect(void)
 
     bool success = false;
     if (bits & WIFI_CONNECTED_BIT) {
-        ESP_LOGI(TAG, "Wi-Fi Connected.");
+        ESP_LOGI(TAG, "Wi-Fi Connected in %lld ms (associated after %lld ms, %s, %s).",
+                 (long long)((s_got_ip_us - s_started_us) / 1000),
+                 (long long)((s_associated_us - s_started_us) / 1000),
+                 s_directed ? "directed" : "full scan", s_static_ip ? "cached IP" : "DHCP");
         success = true;
+
+        wifi_ap_record_t ap_info;
+        if (esp_wifi_sta_get_ap_info(&ap_info) == ESP_OK) {
+            if (!s_last.valid || memcmp(s_last.bssid, ap_info.bssid, sizeof(s_last.bssid)) != 0) {
+                s_last.has_lease = false; // Given by another network, maybe
+            }
+            snprintf(s_last.ssid, sizeof(s_last.ssid), "%s", WIFI_SSID);
+            memcpy(s_last.bssid, ap_info.bssid, sizeof(s_last.bssid));
+            s_last.channel = ap_info.primary;
+            s_last.valid = true;
+        }
     } else if (bits & WIFI_FAIL_BIT) {
         ESP_LOGW(TAG, "Failed to connect to Wi-Fi.");
     } else {
@@ -93,15 +224,30 @@ bool wifi_connect(void)
     return success;
 }
 
+bool wifi_get_ap_bssid(uint8_t bssid[6])
+{
+    wifi_ap_record_t ap_info;
+    if (esp_wifi_sta_get_ap_info(&ap_info) != ESP_OK) {
+        return false;
+    }
+    memcpy(bssid, ap_info.bssid, sizeof(ap_info.bssid));
+    return true;
+}
+
 void wifi_disconnect(void)
 {
+    // The netif is created right before the driver is initialized, e.g. not on a button wake
+    if (s_sta_netif == NULL) {
+        return;
+    }
     ESP_LOGI(TAG, "Disconnecting from Wi-Fi...");
-    
+    if (!s_static_ip) {
+        save_lease();
+    }
+
     ESP_ERROR_CHECK(esp_wifi_stop());
     ESP_ERROR_CHECK(esp_wifi_deinit());
 
-    if (s_sta_netif) {
-        esp_netif_destroy_default_wifi(s_sta_netif);
-        s_sta_netif = NULL;
-    }
+    esp_netif_destroy_default_wifi(s_sta_netif);
+    s_sta_netif = NULL;
 }
\ No newline at end of file
@@ -2,18 +2,31 @@
 #define WIFI_MANAGER_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 /**
  * @brief Connects to the Wi-Fi network using credentials from credentials.h
  *
- * This is a blocking function.
+ * This is a blocking function. After a deep sleep it connects straight to the
+ * access point and channel of the last connection, and reuses its address
+ * while the DHCP lease lasts; if that fails it scans for the network.
  *
  * @return true if connection is successful, false otherwise.
  */
 bool wifi_connect(void);
 
+/**
+ * @brief Gets the BSSID of the access point the station is connected to.
+ *
+ * @return false if not connected.
+ */
+bool wifi_get_ap_bssid(uint8_t bssid[6]);
+
 /**
  * @brief Disconnects from the Wi-Fi network and de-initializes the Wi-Fi driver.
+ *
+ * Keeps the DHCP lease of this connection in RTC memory for the next wake.
+ * Does nothing if wifi_connect() was not called since the last disconnect.
  */
 void wifi_disconnect(void);
 
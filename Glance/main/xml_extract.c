@@ -0,0 +1,295 @@
+#include "xml_extract.h"
+#include <stdlib.h>
+#include <string.h>
+
+enum {
+    STATE_CONTENT,      // Character data, emitted inside a selected element
+    STATE_LT,           // After '<'
+    STATE_NAME,         // Element name of a start or end tag
+    STATE_ATTRS,        // Rest of a tag, up to '>'
+    STATE_ENTITY,       // After '&' inside a selected element
+    STATE_BANG,         // After "<!", deciding between comment, CDATA and declaration
+    STATE_COMMENT,      // Up to "-->"
+    STATE_CDATA,        // Up to "]]>"
+    STATE_SKIP_TAG,     // Processing instruction or declaration, up to '>'
+};
+
+static bool emit(xml_extract_t *x, const char *data, size_t len)
+{
+    if (len == 0 || x->aborted) {
+        return !x->aborted;
+    }
+    x->bytes_out += len;
+    if (!x->on_text(x->element, data, len, x->ctx)) {
+        x->aborted = true;
+    }
+    return !x->aborted;
+}
+
+// Index of the selected element with this local name, -1 if none
+static int find_name(const xml_extract_t *x)
+{
+    const char *local = memchr(x->name, ':', x->name_len);
+    local = local ? local + 1 : x->name;
+    size_t len = x->name_len - (size_t)(local - x->name);
+    for (int i = 0; x->names[i] != NULL; i++) {
+        if (strlen(x->names[i]) == len && memcmp(x->names[i], local, len) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void end_tag(xml_extract_t *x)
+{
+    if (x->end_tag) {
+        if (x->element >= 0 && x->tag_element == x->element) {
+            x->elements++;
+            if (!x->on_text(x->element, NULL, 0, x->ctx)) {
+                x->aborted = true;
+            }
+            x->element = -1;
+        }
+    } else if (!x->self_closing && x->tag_element >= 0) {
+        x->element = x->tag_element;
+    }
+    x->state = STATE_CONTENT;
+}
+
+static size_t utf8_encode(uint32_t cp, char *out)
+{
+    if (cp < 0x80) {
+        out[0] = (char)cp;
+        return 1;
+    }
+    if (cp < 0x800) {
+        out[0] = (char)(0xC0 | cp >> 6);
+        out[1] = (char)(0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = (char)(0xE0 | cp >> 12);
+        out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = (char)(0xF0 | cp >> 18);
+    out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = (char)(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+// Emits the character an entity reference stands for, or the reference itself if unknown
+static bool emit_entity(xml_extract_t *x)
+{
+    static const struct {
+        const char *name;
+        char c;
+    } named[] = {{"lt", '<'}, {"gt", '>'}, {"amp", '&'}, {"quot", '"'}, {"apos", '\''}};
+
+    x->entity[x->entity_len] = '\0';
+    for (size_t i = 0; i < sizeof(named) / sizeof(named[0]); i++) {
+        if (strcmp(x->entity, named[i].name) == 0) {
+            return emit(x, &named[i].c, 1);
+        }
+    }
+    if (x->entity[0] == '#' && x->entity_len > 1) {
+        char *end;
+        unsigned long cp = x->entity[1] == 'x' || x->entity[1] == 'X'
+            ? strtoul(x->entity + 2, &end, 16)
+            : strtoul(x->entity + 1, &end, 10);
+        if (*end == '\0' && end != x->entity + 1 && cp > 0 && cp <= 0x10FFFF) {
+            char utf8[4];
+            return emit(x, utf8, utf8_encode((uint32_t)cp, utf8));
+        }
+    }
+    return emit(x, "&", 1) && emit(x, x->entity, x->entity_len) && emit(x, ";", 1);
+}
+
+void xml_extract_init(xml_extract_t *x, const char *const *names, xml_extract_cb_t on_text, void *ctx)
+{
+    memset(x, 0, sizeof(*x));
+    x->names = names;
+    x->on_text = on_text;
+    x->ctx = ctx;
+    x->state = STATE_CONTENT;
+    x->element = -1;
+    x->tag_element = -1;
+}
+
+bool xml_extract_feed(xml_extract_t *x, const char *data, size_t len)
+{
+    const char *p = data;
+    const char *end = data + len;
+    x->bytes_in += len;
+
+    while (p < end && !x->aborted) {
+        switch (x->state) {
+        case STATE_CONTENT: {
+            // Runs of plain text are passed on without copying
+            const char *run = p;
+            if (x->element < 0) {
+                p = memchr(p, '<', (size_t)(end - p));
+                if (p == NULL) {
+                    return true;
+                }
+            } else {
+                while (p < end && *p != '<' && *p != '&') {
+                    p++;
+                }
+                if (!emit(x, run, (size_t)(p - run)) || p == end) {
+                    break;
+                }
+                if (*p == '&') {
+                    p++;
+                    x->entity_len = 0;
+                    x->state = STATE_ENTITY;
+                    break;
+                }
+            }
+            p++;
+            x->state = STATE_LT;
+            break;
+        }
+
+        case STATE_ENTITY:
+            if (*p == ';') {
+                p++;
+                emit_entity(x);
+                x->state = STATE_CONTENT;
+            } else if (x->entity_len < sizeof(x->entity) - 1 && *p != '<' && *p != '&') {
+                x->entity[x->entity_len++] = *p++;
+            } else {
+                // Not a reference after all; pass the text through
+                emit(x, "&", 1);
+                emit(x, x->entity, x->entity_len);
+                x->state = STATE_CONTENT;
+            }
+            break;
+
+        case STATE_LT:
+            x->name_len = 0;
+            x->end_tag = false;
+            x->self_closing = false;
+            x->tag_element = -1;
+            if (*p == '/') {
+                x->end_tag = true;
+                p++;
+                x->state = STATE_NAME;
+            } else if (*p == '!') {
+                p++;
+                x->state = STATE_BANG;
+            } else if (*p == '?') {
+                p++;
+                x->state = STATE_SKIP_TAG;
+            } else {
+                x->state = STATE_NAME;
+            }
+            break;
+
+        case STATE_NAME:
+            if (*p == '>' || *p == '/' || *p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') {
+                x->tag_element = x->name_len < XML_EXTRACT_NAME_MAX ? find_name(x) : -1;
+                x->state = STATE_ATTRS;
+            } else {
+                if (x->name_len < XML_EXTRACT_NAME_MAX) {
+                    x->name[x->name_len] = *p;
+                }
+                if (x->name_len < 255) {
+                    x->name_len++;
+                }
+                p++;
+            }
+            break;
+
+        case STATE_ATTRS:
+            if (x->quote != '\0') {
+                if (*p == x->quote) {
+                    x->quote = '\0';
+                }
+            } else if (*p == '"' || *p == '\'') {
+                x->quote = *p;
+            } else if (*p == '/') {
+                x->self_closing = true;
+            } else if (*p == '>') {
+                end_tag(x);
+            } else if (*p != ' ' && *p != '\t' && *p != '\r' && *p != '\n') {
+                x->self_closing = false; // A '/' inside an unquoted attribute
+            }
+            p++;
+            break;
+
+        case STATE_BANG: {
+            // "--" starts a comment, "[CDATA[" a CDATA section, anything else a declaration
+            static const char cdata[] = "[CDATA[";
+            x->name[x->name_len++] = *p++;
+            if (x->name[0] == '-') {
+                if (x->name_len == 2) {
+                    x->match = 0;
+                    x->state = STATE_COMMENT;
+                }
+            } else if (memcmp(x->name, cdata, x->name_len) != 0) {
+                x->state = x->name[x->name_len - 1] == '>' ? STATE_CONTENT : STATE_SKIP_TAG;
+            } else if (x->name_len == sizeof(cdata) - 1) {
+                x->match = 0;
+                x->state = STATE_CDATA;
+            }
+            break;
+        }
+
+        case STATE_COMMENT:
+            if (*p == '-') {
+                x->match = x->match < 2 ? x->match + 1 : 2;
+            } else if (*p == '>' && x->match == 2) {
+                x->state = STATE_CONTENT;
+            } else {
+                x->match = 0;
+            }
+            p++;
+            break;
+
+        case STATE_CDATA: {
+            // Text is passed on verbatim; ']' is held back until it is known not to end the section
+            const char *run = p;
+            while (p < end && *p != ']' && x->match == 0) {
+                p++;
+            }
+            if (p > run) {
+                if (x->element >= 0) {
+                    emit(x, run, (size_t)(p - run));
+                }
+                break;
+            }
+            if (*p == ']') {
+                if (x->match < 2) {
+                    x->match++;
+                } else if (x->element >= 0) {
+                    emit(x, "]", 1); // "]]]": the first one is text
+                }
+            } else if (*p == '>' && x->match == 2) {
+                x->state = STATE_CONTENT;
+            } else {
+                if (x->element >= 0) {
+                    emit(x, "]]", x->match);
+                }
+                x->match = 0;
+                break; // Re-examine this character as text
+            }
+            p++;
+            break;
+        }
+
+        case STATE_SKIP_TAG:
+            if (*p == '>') {
+                x->state = STATE_CONTENT;
+            }
+            p++;
+            break;
+
+        default:
+            return false;
+        }
+    }
+    return !x->aborted;
+}
@@ -0,0 +1,77 @@
+#ifndef XML_EXTRACT_H
+#define XML_EXTRACT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Streaming extractor for the text of selected XML elements, such as the
+ * calendar-data of a CalDAV multistatus response.
+ *
+ * Elements are matched by local name, whatever their namespace prefix. The
+ * document is pushed in chunks of any size and is never buffered: plain text
+ * runs are passed on straight from the chunk, and only entity references and
+ * CDATA markers are decoded along the way. Everything outside the selected
+ * elements is skipped. This is not a validating parser; it assumes
+ * well-formed input and does not track nesting.
+ */
+
+#define XML_EXTRACT_NAME_MAX    32  // Longer element names never match
+
+/**
+ * @brief Receives the text of a selected element.
+ *
+ * Called any number of times per element with consecutive pieces of text,
+ * then once with data == NULL when the element ends.
+ *
+ * @param element Index of the element's name in the list given to init.
+ * @return true to continue, false to abort.
+ */
+typedef bool (*xml_extract_cb_t)(int element, const char *data, size_t len, void *ctx);
+
+/**
+ * @brief Extractor state. Treat as opaque apart from the statistics.
+ */
+typedef struct {
+    const char *const *names;   // NULL-terminated local names to extract
+    xml_extract_cb_t on_text;
+    void *ctx;
+
+    uint8_t state;
+    int element;                // Selected element being read, -1 outside
+    int tag_element;            // Selected element named by the tag being read
+    bool end_tag;
+    bool self_closing;
+    char quote;                 // Quote character of the attribute value being skipped
+    char name[XML_EXTRACT_NAME_MAX];
+    uint8_t name_len;
+    char entity[12];
+    uint8_t entity_len;
+    uint8_t match;              // Characters of a marker such as "-->" matched so far
+    bool aborted;
+
+    // Statistics
+    size_t bytes_in;
+    size_t bytes_out;
+    uint32_t elements;
+} xml_extract_t;
+
+/**
+ * @brief Prepares an extractor for one document.
+ *
+ * @param x       Extractor to initialize.
+ * @param names   NULL-terminated list of element local names to extract.
+ * @param on_text Called with the text of the selected elements.
+ * @param ctx     Passed to on_text.
+ */
+void xml_extract_init(xml_extract_t *x, const char *const *names, xml_extract_cb_t on_text, void *ctx);
+
+/**
+ * @brief Processes the next chunk of the document.
+ *
+ * @return false if the callback aborted.
+ */
+bool xml_extract_feed(xml_extract_t *x, const char *data, size_t len);
+
+#endif // XML_EXTRACT_H
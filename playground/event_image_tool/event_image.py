@@ -0,0 +1,270 @@
+"""
+Host-side reader/writer for the Glance event image (Glance/main/event_image.h).
+
+The image is what the device saves to the W25Q128 after a sync: a fixed
+header followed by the event columns, the day index, the device zone and the
+text pool. This tool dumps and verifies images read back from the flash,
+builds images from JSON for testing, and measures how fast an image loads.
+
+Keep the constants and layout in sync with event_image.h and event_store.h.
+"""
+import argparse
+import json
+import struct
+import sys
+import time
+import zlib
+from datetime import datetime, timezone
+
+MAGIC = 0x56454C47  # "GLEV"
+VERSION = 5
+STORE_CAPACITY = 50  # EVENT_STORE_CAPACITY
+STORE_DAYS = 16      # EVENT_STORE_DAYS
+FLAG_ALL_DAY = 0x01
+SECS_PER_DAY = 86400
+
+# event_image_header_t
+HEADER = struct.Struct("<IHHIIIHHqq14I")
+HEADER_FIELDS = (
+    "magic", "version", "header_size", "sequence", "size", "crc", "count", "days",
+    "sync_time", "first_day", "off_start", "off_end", "off_flags", "off_summary",
+    "off_location", "off_description", "off_uid", "off_hash", "off_days", "off_zone", "zone_size",
+    "off_text", "text_len", "off_href",
+)
+
+# Zone section, write_zone() in event_image.c: hash, initial offset, count,
+# overflow (0 or 1), then 16 transitions, those past count zero
+ZONE = struct.Struct("<IiBB2x")
+TRANSITION = struct.Struct("<qii")
+MAX_TRANSITIONS = 16
+ZONE_SIZE = ZONE.size + MAX_TRANSITIONS * TRANSITION.size
+
+TEXT_REF = struct.Struct("<II")
+
+
+def align8(n):
+    return (n + 7) & ~7
+
+
+def fnv1a32(data):
+    """ics_span_hash(), the UID hash."""
+    h = 2166136261
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def fnv1a64(data):
+    """ics_span_hash64() from ICS_SPAN_HASH64_INIT."""
+    h = 0xCBF29CE484222325
+    for b in data:
+        h = ((h ^ b) * 0x100000001B3) & 0xFFFFFFFFFFFFFFFF
+    return h
+
+
+def layout(count, text_len):
+    """Section offsets for an image, as layout() in event_image.c."""
+    h = {}
+    off = align8(HEADER.size)
+    for name, size in (("off_start", 8 * count), ("off_end", 8 * count), ("off_flags", count),
+                       ("off_summary", 8 * count), ("off_location", 8 * count),
+                       ("off_description", 8 * count), ("off_uid", 4 * count),
+                       ("off_hash", 8 * count), ("off_href", 4 * count),
+                       ("off_days", 2 * (STORE_DAYS + 1)),
+                       ("off_zone", ZONE_SIZE)):
+        h[name] = off
+        off = align8(off + size)
+    h["zone_size"] = ZONE_SIZE
+    h["off_text"] = off
+    h["text_len"] = text_len
+    h["size"] = off + text_len
+    return h
+
+
+def read_image(data):
+    """Verifies an image and returns (header, zone, events). Raises ValueError."""
+    if len(data) < HEADER.size:
+        raise ValueError("image shorter than its header")
+    h = dict(zip(HEADER_FIELDS, HEADER.unpack_from(data)))
+    if h["magic"] != MAGIC:
+        raise ValueError("bad magic %08x" % h["magic"])
+    if h["version"] != VERSION or h["header_size"] != HEADER.size:
+        raise ValueError("unsupported version %d" % h["version"])
+    if h["count"] > STORE_CAPACITY or h["days"] != STORE_DAYS:
+        raise ValueError("count or day buckets out of range")
+    expected = layout(h["count"], h["text_len"])
+    if any(h[k] != v for k, v in expected.items()):
+        raise ValueError("section layout does not match the counts")
+    if h["size"] > len(data):
+        raise ValueError("image truncated: %d of %d bytes" % (len(data), h["size"]))
+    crc = zlib.crc32(data[HEADER.size:h["size"]])
+    if crc != h["crc"]:
+        raise ValueError("checksum mismatch: %08x != %08x" % (crc, h["crc"]))
+
+    n = h["count"]
+    starts = struct.unpack_from("<%dq" % n, data, h["off_start"])
+    ends = struct.unpack_from("<%dq" % n, data, h["off_end"])
+    flags = data[h["off_flags"]:h["off_flags"] + n]
+    uids = struct.unpack_from("<%dI" % n, data, h["off_uid"])
+    hashes = struct.unpack_from("<%dQ" % n, data, h["off_hash"])
+    hrefs = struct.unpack_from("<%dI" % n, data, h["off_href"])
+    pool = data[h["off_text"]:h["off_text"] + h["text_len"]]
+
+    def text(section, i):
+        offset, length = TEXT_REF.unpack_from(data, h[section] + i * TEXT_REF.size)
+        if offset + length >= len(pool) or pool[offset + length] != 0:
+            raise ValueError("text reference %d out of range" % i)
+        return pool[offset:offset + length].decode("utf-8", errors="replace")
+
+    events = [{
+        "start": starts[i],
+        "end": ends[i],
+        "all_day": bool(flags[i] & FLAG_ALL_DAY),
+        "summary": text("off_summary", i),
+        "location": text("off_location", i),
+        "description": text("off_description", i),
+        "uid_hash": uids[i],
+        "hash": hashes[i],
+        "href_hash": hrefs[i],
+    } for i in range(n)]
+
+    zone_hash, initial_offset, count, overflow = ZONE.unpack_from(data, h["off_zone"])
+    if count > MAX_TRANSITIONS or overflow > 1:
+        raise ValueError("zone out of range")
+    transitions = [TRANSITION.unpack_from(data, h["off_zone"] + ZONE.size + i * TRANSITION.size)
+                   for i in range(count)]
+    zone = {"tzid_hash": zone_hash, "initial_offset": initial_offset,
+            "overflow": bool(overflow), "transitions": transitions}
+    h["day_first"] = struct.unpack_from("<%dH" % (STORE_DAYS + 1), data, h["off_days"])
+    return h, zone, events
+
+
+def write_image(events, sync_time, utc_offset, sequence=1):
+    """Builds an image for events in a fixed-offset zone, like the device would."""
+    events = sorted(events, key=lambda e: e["start"])[:STORE_CAPACITY]
+
+    # Text pool with interning; offset 0 is the empty string
+    pool = bytearray(b"\0")
+    interned = {"": 0}
+
+    def intern(s):
+        if s not in interned:
+            interned[s] = len(pool)
+            pool.extend(s.encode("utf-8") + b"\0")
+        return struct.pack("<II", interned[s], len(s.encode("utf-8")))
+
+    n = len(events)
+    h = layout(n, 0)
+    refs = {k: b"".join(intern(e.get(k, "")) for e in events) for k in ("summary", "location", "description")}
+    h = layout(n, len(pool))
+
+    first_day = (sync_time + utc_offset) // SECS_PER_DAY
+    starts = [e["start"] for e in events]
+    day_first = []
+    for d in range(STORE_DAYS + 1):
+        bound = (first_day + d) * SECS_PER_DAY - utc_offset
+        day_first.append(sum(1 for s in starts if s < bound))
+
+    buf = bytearray(h["size"])
+    struct.pack_into("<%dq" % n, buf, h["off_start"], *starts)
+    struct.pack_into("<%dq" % n, buf, h["off_end"], *[e.get("end", e["start"]) for e in events])
+    buf[h["off_flags"]:h["off_flags"] + n] = bytes(FLAG_ALL_DAY if e.get("all_day") else 0 for e in events)
+    buf[h["off_summary"]:h["off_summary"] + 8 * n] = refs["summary"]
+    buf[h["off_location"]:h["off_location"] + 8 * n] = refs["location"]
+    buf[h["off_description"]:h["off_description"] + 8 * n] = refs["description"]
+    # The device hashes the raw VEVENT properties; any stable hash of the fields will do here
+    struct.pack_into("<%dI" % n, buf, h["off_uid"], *[fnv1a32(e.get("uid", "").encode("utf-8")) for e in events])
+    struct.pack_into("<%dQ" % n, buf, h["off_hash"],
+                     *[e.get("hash", fnv1a64(json.dumps(e, sort_keys=True).encode("utf-8"))) for e in events])
+    struct.pack_into("<%dI" % n, buf, h["off_href"],
+                     *[fnv1a32(e["href"].encode("utf-8")) if e.get("href") else 0 for e in events])
+    struct.pack_into("<%dH" % (STORE_DAYS + 1), buf, h["off_days"], *day_first)
+    ZONE.pack_into(buf, h["off_zone"], 0, utc_offset, 0, 0)
+    buf[h["off_text"]:h["off_text"] + len(pool)] = pool
+
+    h.update(magic=MAGIC, version=VERSION, header_size=HEADER.size, sequence=sequence,
+             count=n, days=STORE_DAYS, sync_time=sync_time, first_day=first_day)
+    h["crc"] = zlib.crc32(bytes(buf[HEADER.size:]))
+    HEADER.pack_into(buf, 0, *(h[k] for k in HEADER_FIELDS))
+    return bytes(buf)
+
+
+def format_time(t):
+    return datetime.fromtimestamp(t, timezone.utc).strftime("%Y-%m-%d %H:%M UTC")
+
+
+def cmd_dump(args):
+    with open(args.image, "rb") as f:
+        data = f.read()
+    h, zone, events = read_image(data)
+    print("Image: %d bytes, sequence %d, synced %s" % (h["size"], h["sequence"], format_time(h["sync_time"])))
+    print("Zone: offset %+d s, %d transitions" % (zone["initial_offset"], len(zone["transitions"])))
+    for i, e in enumerate(events):
+        when = format_time(e["start"]) + (" (all day)" if e["all_day"] else "")
+        where = " @ " + e["location"] if e["location"] else ""
+        print("%2d: %s - %s%s" % (i + 1, when, e["summary"], where))
+
+
+def cmd_diff(args):
+    events = []
+    for path in (args.older, args.newer):
+        with open(path, "rb") as f:
+            events.append(read_image(f.read())[2])
+    older = {(e["start"], e["uid_hash"]): e for e in events[0]}
+    newer = {(e["start"], e["uid_hash"]): e for e in events[1]}
+    for key in sorted(older.keys() | newer.keys()):
+        if key not in older:
+            print("+ %s - %s" % (format_time(key[0]), newer[key]["summary"]))
+        elif key not in newer:
+            print("- %s - %s" % (format_time(key[0]), older[key]["summary"]))
+        elif older[key]["hash"] != newer[key]["hash"]:
+            print("~ %s - %s" % (format_time(key[0]), newer[key]["summary"]))
+
+
+def cmd_write(args):
+    with open(args.events, encoding="utf-8") as f:
+        spec = json.load(f)
+    data = write_image(spec["events"], spec.get("sync_time", int(time.time())), spec.get("utc_offset", 0))
+    with open(args.image, "wb") as f:
+        f.write(data)
+    print("Wrote %d bytes" % len(data))
+
+
+def cmd_bench(args):
+    with open(args.image, "rb") as f:
+        data = f.read()
+    started = time.perf_counter()
+    for _ in range(args.rounds):
+        read_image(data)
+    elapsed = time.perf_counter() - started
+    print("%d loads, %.1f us each" % (args.rounds, elapsed / args.rounds * 1e6))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    sub = parser.add_subparsers(dest="command", required=True)
+    p = sub.add_parser("dump", help="verify an image and list its events")
+    p.add_argument("image")
+    p.set_defaults(func=cmd_dump)
+    p = sub.add_parser("diff", help="list events added (+), removed (-) and changed (~) between two images")
+    p.add_argument("older")
+    p.add_argument("newer")
+    p.set_defaults(func=cmd_diff)
+    p = sub.add_parser("write", help="build an image from a JSON event list")
+    p.add_argument("events")
+    p.add_argument("image")
+    p.set_defaults(func=cmd_write)
+    p = sub.add_parser("bench", help="time verifying and loading an image")
+    p.add_argument("image")
+    p.add_argument("--rounds", type=int, default=1000)
+    p.set_defaults(func=cmd_bench)
+    args = parser.parse_args()
+    try:
+        args.func(args)
+    except ValueError as e:
+        print("Invalid image: %s" % e, file=sys.stderr)
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
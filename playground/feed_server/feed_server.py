@@ -0,0 +1,385 @@
+"""
+Local stand-in for a calendar server, for testing Glance's feed fetching.
+
+Serves the .ics files in a directory over plain HTTP with the validators a
+real calendar host sends (ETag and Last-Modified), and answers conditional
+requests with 304 Not Modified while a file is unchanged. Edit or touch a
+file to make the next request fetch it in full. Bodies are gzip-compressed
+for clients that send Accept-Encoding: gzip, and Range requests for the rest
+of a body are answered with 206 Partial Content while If-Range matches.
+
+Each file also acts as a CalDAV calendar collection with one resource per
+UID: calendar-query REPORTs are filtered by their time-range, and
+sync-collection REPORTs list the resources changed since a sync-token, which
+PROPFIND reports. Tokens count the edits seen since the server started.
+
+Point ICS_URL (or CALDAV_URL) in credentials.h at
+http://<host ip>:<port>/<file>.ics.
+"""
+import argparse
+import datetime
+import email.utils
+import gzip
+import hashlib
+import os
+import re
+import sys
+import threading
+import time
+import xml.etree.ElementTree as ET
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from xml.sax.saxutils import escape
+
+DAV_NS = "{DAV:}"
+CALDAV_NS = "{urn:ietf:params:xml:ns:caldav}"
+DURATION_RE = re.compile(r"([+-]?)P(?:(\d+)W)?(?:(\d+)D)?(?:T(?:(\d+)H)?(?:(\d+)M)?(?:(\d+)S)?)?$")
+
+
+def unfold(text):
+    return re.sub(r"\r?\n[ \t]", "", text).splitlines()
+
+
+def parse_time(line):
+    """Returns (UTC datetime, exact) for a DTSTART/DTEND/UNTIL line or value.
+    Times in a named zone or floating are read as UTC and marked inexact."""
+    value = line.rsplit(":", 1)[-1].strip()
+    try:
+        if len(value) == 8:
+            return datetime.datetime.strptime(value, "%Y%m%d").replace(tzinfo=datetime.timezone.utc), False
+        exact = value.endswith("Z")
+        t = datetime.datetime.strptime(value.rstrip("Z"), "%Y%m%dT%H%M%S")
+        return t.replace(tzinfo=datetime.timezone.utc), exact
+    except ValueError:
+        return None, False
+
+
+def parse_duration(value):
+    m = DURATION_RE.match(value.strip())
+    if not m:
+        return None
+    w, d, h, mi, sec = (int(g or 0) for g in m.groups()[1:])
+    delta = datetime.timedelta(weeks=w, days=d, hours=h, minutes=mi, seconds=sec)
+    return -delta if m.group(1) == "-" else delta
+
+
+def split_calendar(text):
+    """Splits an ICS file into (header lines, VTIMEZONE blocks, {UID: VEVENT blocks})."""
+    header, zones, events = [], [], {}
+    block, depth = None, 0
+    for line in unfold(text):
+        name = line.split(":", 1)[0].split(";", 1)[0].upper()
+        value = line.split(":", 1)[-1].strip().upper()
+        if block is not None:
+            block.append(line)
+            if name == "BEGIN":
+                depth += 1
+            elif name == "END":
+                depth -= 1
+                if depth == 0:
+                    if block[0].upper().startswith("BEGIN:VTIMEZONE"):
+                        zones.append(block)
+                    else:
+                        uid = next((l.split(":", 1)[1] for l in block if l.upper().startswith("UID")), "")
+                        events.setdefault(uid, []).append(block)
+                    block = None
+        elif name == "BEGIN" and value in ("VEVENT", "VTIMEZONE"):
+            block, depth = [line], 1
+        elif name not in ("BEGIN", "END"):
+            header.append(line)
+    return header, zones, events
+
+
+def overlaps(vevent, start, end):
+    """Whether the event may have an instance in [start, end). Recurring events
+    are kept unless they started after the range or their UNTIL is before it;
+    the client filters what is left over."""
+    props = {}
+    for line in vevent[1:-1]:
+        props.setdefault(line.split(":", 1)[0].split(";", 1)[0].upper(), line)
+    if "DTSTART" not in props:
+        return False
+    first, exact = parse_time(props["DTSTART"])
+    if first is None:
+        return True
+    # Zone offsets are not applied, so allow a day either way
+    slack = datetime.timedelta(0) if exact else datetime.timedelta(days=1)
+    if "RRULE" in props:
+        until = re.search(r"UNTIL=([0-9TZ]+)", props["RRULE"].upper())
+        last = parse_time(until.group(1))[0] if until else None
+        return first - slack < end and (last is None or last + slack >= start)
+    last = None
+    if "DTEND" in props:
+        last = parse_time(props["DTEND"])[0]
+    elif "DURATION" in props:
+        duration = parse_duration(props["DURATION"].split(":", 1)[1])
+        last = first + duration if duration is not None else None
+    if last is None:
+        all_day = len(props["DTSTART"].rsplit(":", 1)[-1].strip()) == 8
+        last = first + (datetime.timedelta(days=1) if all_day else datetime.timedelta(0))
+    # A zero-length event overlaps if it starts in the range (RFC 4791 9.9)
+    if last == first:
+        return start <= first + slack and first - slack < end
+    return first - slack < end and last + slack > start
+
+
+class FeedHandler(BaseHTTPRequestHandler):
+    root = "."
+
+    def resolve(self):
+        name = os.path.basename(self.path.split("?", 1)[0])
+        path = os.path.join(self.root, name)
+        return path if name and os.path.isfile(path) else None
+
+    def validators(self, path, body):
+        etag = '"%s"' % hashlib.sha1(body).hexdigest()[:16]
+        mtime = int(os.path.getmtime(path))
+        return etag, mtime, email.utils.formatdate(mtime, usegmt=True)
+
+    def not_modified(self, etag, mtime):
+        # If-None-Match takes precedence over If-Modified-Since (RFC 9110 13.2.2)
+        if_none_match = self.headers.get("If-None-Match")
+        if if_none_match is not None:
+            tags = [t.strip() for t in if_none_match.split(",")]
+            return "*" in tags or etag in tags or ("W/" + etag) in tags
+        if_modified_since = self.headers.get("If-Modified-Since")
+        if if_modified_since is not None:
+            try:
+                since = email.utils.parsedate_to_datetime(if_modified_since).timestamp()
+            except (TypeError, ValueError):
+                return False
+            return mtime <= since
+        return False
+
+    def range_start(self, etag, last_modified, length):
+        """First byte a Range: bytes=N- request asks for, or None to send the whole body."""
+        match = re.fullmatch(r"bytes=(\d+)-", self.headers.get("Range", "").strip())
+        if match is None or int(match.group(1)) >= length:
+            return None
+        # A Range without If-Range is honoured; with one, only if the validator still matches
+        # (RFC 9110 13.1.5)
+        if_range = self.headers.get("If-Range")
+        if if_range is not None and if_range.strip() not in (etag, last_modified):
+            return None
+        return int(match.group(1))
+
+    def encode(self, body):
+        """Compresses the body if the client accepts gzip; returns (body, encoding)."""
+        accept = self.headers.get("Accept-Encoding", "")
+        if self.server.gzip and "gzip" in [a.split(";")[0].strip() for a in accept.split(",")]:
+            return gzip.compress(body, self.server.gzip_level, mtime=0), "gzip"
+        return body, None
+
+    def do_GET(self):
+        path = self.resolve()
+        if path is None:
+            self.send_error(404)
+            return
+        time.sleep(self.server.latency)
+        with open(path, "rb") as f:
+            body = f.read()
+        etag, mtime, last_modified = self.validators(path, body)
+
+        # Each encoding is a different representation with its own ETag
+        body, encoding = self.encode(body)
+        if encoding:
+            etag = etag[:-1] + '-gz"'
+
+        if self.server.validators and self.not_modified(etag, mtime):
+            self.send_response(304)
+            self.send_header("ETag", etag)
+            self.send_header("Last-Modified", last_modified)
+            self.end_headers()
+            return
+
+        start = self.range_start(etag, last_modified, len(body))
+        self.send_response(200 if start is None else 206)
+        self.send_header("Content-Type", "text/calendar; charset=utf-8")
+        self.send_header("Content-Length", str(len(body) - (start or 0)))
+        if start is not None:
+            self.send_header("Content-Range", "bytes %d-%d/%d" % (start, len(body) - 1, len(body)))
+        if encoding:
+            self.send_header("Content-Encoding", encoding)
+        self.send_header("Vary", "Accept-Encoding")
+        self.send_header("Accept-Ranges", "bytes")
+        if self.server.validators:
+            self.send_header("ETag", etag)
+            self.send_header("Last-Modified", last_modified)
+        self.end_headers()
+        body = body[start or 0:]
+        if self.server.drop_after is not None and len(body) > self.server.drop_after:
+            # Break the connection off mid-body like a flaky link
+            self.wfile.write(body[:self.server.drop_after])
+            self.close_connection = True
+            return
+        self.wfile.write(body)
+
+    def resources(self, path):
+        """The file as a CalDAV collection: {href: (etag, calendar-data, VEVENT blocks)}."""
+        with open(path, encoding="utf-8") as f:
+            header, zones, events = split_calendar(f.read())
+        base = self.path.split("?", 1)[0].rstrip("/")
+        out = {}
+        for uid, vevents in events.items():
+            lines = ["BEGIN:VCALENDAR"] + header + [l for b in zones + vevents for l in b] + ["END:VCALENDAR"]
+            data = "\r\n".join(lines) + "\r\n"
+            href = "%s/%s.ics" % (base, hashlib.sha1(uid.encode()).hexdigest()[:16])
+            out[href] = ('"%s"' % hashlib.sha1(data.encode()).hexdigest()[:16], data, vevents)
+        return out
+
+    def sync_state(self, path, resources):
+        """Brings the file's change history up to date; returns it. Each edit
+        of the file that changes any resource is one new sync-token."""
+        with self.server.lock:
+            state = self.server.sync.setdefault(path, {"version": 0, "etags": {}, "changed": {}})
+            etags = {href: r[0] for href, r in resources.items()}
+            if etags != state["etags"]:
+                state["version"] += 1
+                for href in set(etags) | set(state["etags"]):
+                    if etags.get(href) != state["etags"].get(href):
+                        state["changed"][href] = state["version"]
+                state["etags"] = etags
+            return state
+
+    def sync_token(self, path, version):
+        # Tokens from an earlier run of the server are rejected like expired ones
+        return "http://glance.invalid/sync/%s/%d/%d" % (os.path.basename(path), self.server.epoch, version)
+
+    @staticmethod
+    def response_xml(href, etag=None, data=None):
+        if data is None:
+            return ("<D:response><D:href>%s</D:href><D:status>HTTP/1.1 404 Not Found</D:status>"
+                    "</D:response>\n" % escape(href))
+        # CRs are escaped as many servers do, since XML parsers would drop them
+        return ("<D:response><D:href>%s</D:href><D:propstat><D:prop>"
+                "<D:getetag>%s</D:getetag><C:calendar-data>%s</C:calendar-data>"
+                "</D:prop><D:status>HTTP/1.1 200 OK</D:status></D:propstat></D:response>\n"
+                % (escape(href), escape(etag), escape(data, {"\r": "&#13;"})))
+
+    def send_multistatus(self, parts):
+        body = ('<?xml version="1.0" encoding="utf-8"?>\n'
+                '<D:multistatus xmlns:D="DAV:" xmlns:C="urn:ietf:params:xml:ns:caldav">\n'
+                + "".join(parts) + "</D:multistatus>\n")
+        body, encoding = self.encode(body.encode("utf-8"))
+        self.send_response(207)
+        self.send_header("Content-Type", "application/xml; charset=utf-8")
+        self.send_header("Content-Length", str(len(body)))
+        if encoding:
+            self.send_header("Content-Encoding", encoding)
+        self.send_header("Vary", "Accept-Encoding")
+        self.end_headers()
+        self.wfile.write(body)
+
+    def read_xml(self):
+        try:
+            return ET.fromstring(self.rfile.read(int(self.headers.get("Content-Length", 0))))
+        except ET.ParseError:
+            self.send_error(400, "Malformed XML body")
+            return None
+
+    def do_PROPFIND(self):
+        path = self.resolve()
+        if path is None:
+            self.send_error(404)
+            return
+        if self.read_xml() is None:
+            return
+        # Only the collection's sync-token is reported
+        state = self.sync_state(path, self.resources(path))
+        self.send_multistatus(["<D:response><D:href>%s</D:href><D:propstat><D:prop>"
+                               "<D:sync-token>%s</D:sync-token></D:prop>"
+                               "<D:status>HTTP/1.1 200 OK</D:status></D:propstat></D:response>\n"
+                               % (escape(self.path), escape(self.sync_token(path, state["version"])))])
+
+    def do_REPORT(self):
+        path = self.resolve()
+        if path is None:
+            self.send_error(404)
+            return
+        query = self.read_xml()
+        if query is None:
+            return
+        if query.tag == CALDAV_NS + "calendar-query":
+            self.calendar_query(path, query)
+        elif query.tag == DAV_NS + "sync-collection":
+            self.sync_collection(path, query)
+        else:
+            self.send_error(501, "Only calendar-query and sync-collection are supported")
+
+    def calendar_query(self, path, query):
+        start = datetime.datetime.min.replace(tzinfo=datetime.timezone.utc)
+        end = datetime.datetime.max.replace(tzinfo=datetime.timezone.utc)
+        time_range = query.find(".//%stime-range" % CALDAV_NS)
+        if time_range is not None:
+            start = parse_time(time_range.get("start", ""))[0] or start
+            end = parse_time(time_range.get("end", ""))[0] or end
+
+        resources = self.resources(path)
+        parts = [self.response_xml(href, etag, data) for href, (etag, data, vevents) in resources.items()
+                 if any(overlaps(v, start, end) for v in vevents)]
+        self.log_message("calendar-query matched %d of %d resources", len(parts), len(resources))
+        self.send_multistatus(parts)
+
+    def sync_collection(self, path, query):
+        resources = self.resources(path)
+        state = self.sync_state(path, resources)
+        token = (query.findtext(DAV_NS + "sync-token") or "").strip()
+        if token:
+            prefix = self.sync_token(path, 0)[:-1]
+            since = int(token[len(prefix):]) if token.startswith(prefix) and token[len(prefix):].isdigit() else -1
+            if not 0 < since <= state["version"]:
+                body = ('<?xml version="1.0" encoding="utf-8"?>\n'
+                        '<D:error xmlns:D="DAV:"><D:valid-sync-token/></D:error>\n').encode("utf-8")
+                self.send_response(403)
+                self.send_header("Content-Type", "application/xml; charset=utf-8")
+                self.send_header("Content-Length", str(len(body)))
+                self.end_headers()
+                self.wfile.write(body)
+                return
+        else:
+            since = 0
+
+        # An initial sync lists every resource; later ones what changed since the token
+        parts = []
+        for href, version in state["changed"].items():
+            if (href in resources) if since == 0 else version > since:
+                resource = resources.get(href)
+                parts.append(self.response_xml(href, *resource[:2]) if resource else self.response_xml(href))
+        parts.append("<D:sync-token>%s</D:sync-token>\n" % escape(self.sync_token(path, state["version"])))
+        self.log_message("sync-collection since %d: %d of %d resources", since, len(parts) - 1, len(resources))
+        self.send_multistatus(parts)
+
+    def log_message(self, fmt, *args):
+        sys.stderr.write("%s %s\n" % (self.address_string(), fmt % args))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("root", nargs="?", default=".", help="directory with the .ics files")
+    parser.add_argument("--port", type=int, default=8765)
+    parser.add_argument("--no-validators", dest="validators", action="store_false",
+                        help="behave like a server without ETag or Last-Modified")
+    parser.add_argument("--no-gzip", dest="gzip", action="store_false",
+                        help="never compress responses")
+    parser.add_argument("--gzip-level", type=int, default=6, choices=range(0, 10))
+    parser.add_argument("--latency", type=float, default=0, metavar="SECONDS",
+                        help="wait before answering each GET, like a slow server")
+    parser.add_argument("--drop-after", type=int, metavar="BYTES",
+                        help="close the connection after sending this many bytes of a body")
+    args = parser.parse_args()
+
+    FeedHandler.root = args.root
+    server = ThreadingHTTPServer(("", args.port), FeedHandler)
+    server.validators = args.validators
+    server.gzip = args.gzip
+    server.gzip_level = args.gzip_level
+    server.latency = args.latency
+    server.drop_after = args.drop_after
+    server.lock = threading.Lock()
+    server.sync = {}
+    server.epoch = int(time.time())
+    print("Serving %s on port %d" % (os.path.abspath(args.root), args.port))
+    server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,128 @@
+/*
+ * Checks civil_time.h against the C library: civil_from_seconds() against
+ * gmtime_r(), civil_to_seconds() against timegm() and civil_weekday()
+ * against tm_wday, at every hour from 1970 to 2100, each at a different
+ * minute and second. Then times both sides over the same instants.
+ */
+#define _DEFAULT_SOURCE
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+#include "civil_time.h"
+
+#define FIRST_YEAR  1970
+#define END_YEAR    2101    // Exclusive
+#define ROUNDS      5
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+// The instant checked in an hour: a minute and second that vary from hour to hour
+static int64_t instant(int64_t hour)
+{
+    return hour * 3600 + (hour * 7 % 60) * 60 + hour * 13 % 60;
+}
+
+int main(void)
+{
+    int64_t first_hour = civil_days_from_date(FIRST_YEAR, 1, 1) * 24;
+    int64_t end_hour = civil_days_from_date(END_YEAR, 1, 1) * 24;
+    long errors = 0;
+
+    for (int64_t hour = first_hour; hour < end_hour; hour++) {
+        int64_t t = instant(hour);
+        time_t tt = (time_t)t;
+        struct tm tm;
+        gmtime_r(&tt, &tm);
+
+        civil_time_t c;
+        civil_from_seconds(t, &c);
+        int64_t days = civil_days_from_seconds(t);
+        if (c.year != tm.tm_year + 1900 || c.month != tm.tm_mon + 1 || c.day != tm.tm_mday ||
+            c.hour != tm.tm_hour || c.minute != tm.tm_min || c.second != tm.tm_sec ||
+            c.weekday != tm.tm_wday || c.yday != tm.tm_yday || civil_weekday(days) != tm.tm_wday) {
+            if (errors++ < 10) {
+                printf("%lld: civil %04d-%02d-%02d %02d:%02d:%02d wday %d yday %d, "
+                       "gmtime %04d-%02d-%02d %02d:%02d:%02d wday %d yday %d\n", (long long)t,
+                       (int)c.year, c.month, c.day, c.hour, c.minute, c.second, c.weekday, c.yday,
+                       tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec,
+                       tm.tm_wday, tm.tm_yday);
+            }
+        }
+        int64_t back = civil_to_seconds(tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday,
+                                        tm.tm_hour, tm.tm_min, tm.tm_sec);
+        if (back != (int64_t)timegm(&tm) || back != t) {
+            if (errors++ < 10) {
+                printf("%lld: civil_to_seconds %lld, timegm %lld\n", (long long)t, (long long)back,
+                       (long long)timegm(&tm));
+            }
+        }
+    }
+    printf("%lld hours from %d to %d checked, %ld errors\n",
+           (long long)(end_hour - first_hour), FIRST_YEAR, END_YEAR - 1, errors);
+
+    // Best of a few rounds over the same instants; the sums keep the calls from being optimized away
+    double best[4] = {0};
+    int64_t sink = 0;
+    for (int r = 0; r < ROUNDS; r++) {
+        double ms[4];
+        double start = now_ms();
+        for (int64_t hour = first_hour; hour < end_hour; hour++) {
+            civil_time_t c;
+            civil_from_seconds(instant(hour), &c);
+            sink += c.day + c.weekday;
+        }
+        ms[0] = now_ms() - start;
+
+        start = now_ms();
+        for (int64_t hour = first_hour; hour < end_hour; hour++) {
+            time_t tt = (time_t)instant(hour);
+            struct tm tm;
+            gmtime_r(&tt, &tm);
+            sink += tm.tm_mday + tm.tm_wday;
+        }
+        ms[1] = now_ms() - start;
+
+        start = now_ms();
+        for (int64_t hour = first_hour; hour < end_hour; hour++) {
+            int64_t days = hour / 24;
+            int32_t y;
+            int8_t m, d;
+            civil_date_from_days(days, &y, &m, &d);
+            sink += civil_to_seconds(y, m, d, (int)(hour % 24), 30, 0);
+        }
+        ms[2] = now_ms() - start;
+
+        start = now_ms();
+        for (int64_t hour = first_hour; hour < end_hour; hour++) {
+            // The same fields, produced without timing the conversion that builds them
+            struct tm tm = {0};
+            int64_t days = hour / 24;
+            int32_t y;
+            int8_t m, d;
+            civil_date_from_days(days, &y, &m, &d);
+            tm.tm_year = y - 1900;
+            tm.tm_mon = m - 1;
+            tm.tm_mday = d;
+            tm.tm_hour = (int)(hour % 24);
+            tm.tm_min = 30;
+            sink += timegm(&tm);
+        }
+        ms[3] = now_ms() - start;
+
+        for (int i = 0; i < 4; i++) {
+            if (r == 0 || ms[i] < best[i]) {
+                best[i] = ms[i];
+            }
+        }
+    }
+    double n = (double)(end_hour - first_hour);
+    printf("civil_from_seconds  %6.1f ns/call    gmtime_r  %6.1f ns/call\n", best[0] * 1e6 / n, best[1] * 1e6 / n);
+    printf("civil_to_seconds    %6.1f ns/call    timegm    %6.1f ns/call (both include civil_date_from_days)\n",
+           best[2] * 1e6 / n, best[3] * 1e6 / n);
+    return errors != 0 || sink == 0;
+}
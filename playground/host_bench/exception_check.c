@@ -0,0 +1,105 @@
+/*
+ * Checks that EXDATE and RECURRENCE-ID still apply after heavy eviction:
+ * thousands of recurring events are offered to the heap first, each pushing
+ * out a later one, and only then come series with an EXDATE and with moved
+ * occurrences, one override after its master and one before. The kept
+ * events must show the exceptions, and the occurrence index must not have
+ * refused any of them.
+ */
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "civil_time.h"
+#include "feed_parser.h"
+
+#define NOW             1792800000  // 2026-10-24 00:00 UTC
+#define SERIES          2000        // Recurring events before the exceptions
+#define FEED_MAX        (SERIES * 128 + 4096)
+
+static char feed[FEED_MAX];
+static size_t feed_len;
+
+static void append(const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    int len = vsnprintf(feed + feed_len, FEED_MAX - feed_len, fmt, args);
+    va_end(args);
+    if (len < 0 || (size_t)len >= FEED_MAX - feed_len) {
+        fprintf(stderr, "feed buffer too small\n");
+        exit(1);
+    }
+    feed_len += (size_t)len;
+}
+
+// Formats a UTC DATE-TIME; the result lasts until the next call
+static const char *stamp(int64_t t)
+{
+    static char buf[32];
+    civil_time_t c;
+    civil_from_seconds(t, &c);
+    snprintf(buf, sizeof(buf), "%04d%02d%02dT%02d%02d%02dZ", (int)c.year, c.month, c.day, c.hour, c.minute,
+             c.second);
+    return buf;
+}
+
+static int failures;
+
+static void expect(const char *summary, int64_t start, bool kept)
+{
+    if (feed_parser_holds(summary, start) != kept) {
+        failures++;
+        printf("%s at %+lld s: %s\n", summary, (long long)(start - NOW), kept ? "missing" : "shown");
+    }
+}
+
+int main(void)
+{
+    int64_t day = CIVIL_SECS_PER_DAY;
+    int64_t standup = NOW + 3600, review = NOW + 7200;
+
+    append("BEGIN:VCALENDAR\r\nVERSION:2.0\r\nPRODID:-//Glance//exception_check//EN\r\n");
+
+    // Each series starts earlier than the one before, so its first occurrence takes a slot from it
+    for (int k = 0; k < SERIES; k++) {
+        append("BEGIN:VEVENT\r\nUID:series-%d\r\nDTSTART:%s\r\nRRULE:FREQ=DAILY;COUNT=10\r\n"
+               "SUMMARY:Series %d\r\nEND:VEVENT\r\n", k, stamp(NOW + 5 * day + (SERIES - k) * 60), k);
+    }
+
+    // An override before its master
+    append("BEGIN:VEVENT\r\nUID:review\r\nRECURRENCE-ID:%s\r\n", stamp(review + day));
+    append("DTSTART:%s\r\nSUMMARY:Review moved\r\nEND:VEVENT\r\n", stamp(review + day + 3600));
+    append("BEGIN:VEVENT\r\nUID:review\r\nDTSTART:%s\r\nRRULE:FREQ=DAILY;COUNT=3\r\n"
+           "SUMMARY:Review\r\nEND:VEVENT\r\n", stamp(review));
+
+    // A master with an EXDATE, then an override after it
+    append("BEGIN:VEVENT\r\nUID:standup\r\nDTSTART:%s\r\nRRULE:FREQ=DAILY;COUNT=5\r\n", stamp(standup));
+    append("EXDATE:%s\r\nSUMMARY:Stand-up\r\nEND:VEVENT\r\n", stamp(standup + day));
+    append("BEGIN:VEVENT\r\nUID:standup\r\nRECURRENCE-ID:%s\r\n", stamp(standup + 2 * day));
+    append("DTSTART:%s\r\nSUMMARY:Stand-up moved\r\nEND:VEVENT\r\n", stamp(standup + 2 * day + 1800));
+    append("END:VCALENDAR\r\n");
+
+    feed_parser_stats_t stats;
+    feed_parser_begin(NOW);
+    feed_parser_feed(feed, feed_len);
+    feed_parser_finish(&stats);
+
+    expect("Stand-up", standup, true);
+    expect("Stand-up", standup + day, false);
+    expect("Stand-up", standup + 2 * day, false);
+    expect("Stand-up moved", standup + 2 * day + 1800, true);
+    expect("Stand-up", standup + 3 * day, true);
+    expect("Stand-up", standup + 4 * day, true);
+    expect("Review", review, true);
+    expect("Review", review + day, false);
+    expect("Review moved", review + day + 3600, true);
+    expect("Review", review + 2 * day, true);
+    if (stats.index_dropped != 0) {
+        failures++;
+    }
+
+    printf("%u VEVENTs, %u occurrences in the window, %u kept; %u exceptions refused by the index, %d failures\n",
+           stats.vevents, stats.occurrences, stats.kept, stats.index_dropped, failures);
+    return failures != 0;
+}
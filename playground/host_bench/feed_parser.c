@@ -0,0 +1,77 @@
+#include "feed_parser.h"
+#include <string.h>
+#include "calendar_manager.h"
+#include "civil_time.h"
+#include "ics_feed.h"
+
+#define TEXT_ARENA_SIZE         16384   // CONFIG_GLANCE_EVENT_TEXT_ARENA_SIZE
+#define TEXT_INTERN_SLOTS       256     // CONFIG_GLANCE_EVENT_TEXT_INTERN_SLOTS
+#define OCCURRENCE_INDEX_SIZE   512     // CONFIG_GLANCE_ICS_OCCURRENCE_INDEX_SIZE
+#define LOCAL_TZ                "CST-8"
+
+static char text_buf[TEXT_ARENA_SIZE];
+static text_intern_t intern_table[TEXT_INTERN_SLOTS];
+static ics_feed_t feed;
+static ics_occurrence_t occurrences[OCCURRENCE_INDEX_SIZE];
+static ics_feed_parser_t parser;
+
+static ics_tz_zone_t local_zone;
+static ics_feed_window_t window;
+
+void feed_parser_begin(int64_t now)
+{
+    // The window and zone years of sync_begin()
+    civil_time_t t;
+    civil_from_seconds(now, &t);
+    window.now = now;
+    window.first_year = t.year - 1;
+    window.last_year = t.year + 2;
+    ics_tz_compile_posix(&local_zone, LOCAL_TZ, window.first_year, window.last_year);
+    window.local = &local_zone;
+    int64_t today = civil_days_from_seconds(now + ics_tz_offset_at(&local_zone, now));
+    window.end = ics_tz_local_to_utc(&local_zone, (today + CALENDAR_WINDOW_DAYS + 1) * CIVIL_SECS_PER_DAY);
+
+    if (feed.text.buf == NULL) {
+        ics_feed_init(&feed, text_buf, sizeof(text_buf), intern_table, TEXT_INTERN_SLOTS);
+    }
+    ics_feed_parser_begin(&parser, &feed, &window, occurrences, OCCURRENCE_INDEX_SIZE);
+}
+
+bool feed_parser_feed(const char *data, size_t len)
+{
+    return ics_feed_parser_feed(&parser, data, len);
+}
+
+void feed_parser_finish(feed_parser_stats_t *stats)
+{
+    ics_feed_parser_finish(&parser);
+
+    memset(stats, 0, sizeof(*stats));
+    stats->bytes = parser.tokenizer.bytes_in;
+    stats->lines = parser.tokenizer.lines;
+    stats->spill_high_water = parser.tokenizer.spill_high_water;
+    stats->vevents = parser.stats.vevents;
+    stats->zones = (uint32_t)parser.tz_zone_count;
+    stats->occurrences = parser.stats.occurrences;
+    stats->kept = (uint32_t)feed.heap.count;
+    stats->arena_high_water = feed.text.high_water;
+    stats->arena_overflows = feed.text.overflows;
+    stats->arena_compactions = feed.text.compactions;
+    stats->index_dropped = parser.occurrence_index.dropped;
+    for (int slot = 0; slot < EVENT_STORE_CAPACITY; slot++) {
+        if (event_heap_holds(&feed.heap, slot) && feed.pool[slot].summary.len == 0) {
+            stats->untitled++;
+        }
+    }
+}
+
+bool feed_parser_holds(const char *summary, int64_t start)
+{
+    for (int slot = 0; slot < EVENT_STORE_CAPACITY; slot++) {
+        if (event_heap_holds(&feed.heap, slot) && feed.pool[slot].start_time == start &&
+            strcmp(text_arena_get(&feed.text, feed.pool[slot].summary), summary) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,51 @@
+#ifndef FEED_PARSER_H
+#define FEED_PARSER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Sets up ics_feed.c as calendar_manager.c does for one ICS calendar: the
+ * window, the device zone (CST-8) and the Kconfig default sizes of the
+ * text arena and occurrence index. HTTP, gzip and CalDAV are left out.
+ */
+
+typedef struct {
+    size_t bytes;
+    size_t lines;
+    size_t spill_high_water;
+    uint32_t vevents;
+    uint32_t zones;
+    uint32_t occurrences;       // Occurrences in the window offered to the heap
+    uint32_t kept;              // Events in the heap at the end
+    size_t arena_high_water;    // Peak bytes of event text
+    uint32_t arena_overflows;
+    uint32_t arena_compactions;
+    uint32_t untitled;          // Kept events whose summary was dropped or missing
+    uint32_t index_dropped;     // Exceptions the full occurrence index refused
+} feed_parser_stats_t;
+
+/**
+ * @brief Starts a feed, keeping events that start from now to the end of the
+ * 14th local day after today.
+ */
+void feed_parser_begin(int64_t now);
+
+/**
+ * @brief Feeds the next chunk, as HTTP_EVENT_ON_DATA would.
+ */
+bool feed_parser_feed(const char *data, size_t len);
+
+/**
+ * @brief Ends the feed and reports what was parsed.
+ */
+void feed_parser_finish(feed_parser_stats_t *stats);
+
+/**
+ * @brief Returns true if the finished feed kept an event with this summary
+ * and start.
+ */
+bool feed_parser_holds(const char *summary, int64_t start);
+
+#endif // FEED_PARSER_H
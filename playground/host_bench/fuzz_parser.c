@@ -0,0 +1,35 @@
+/*
+ * libFuzzer target for the feed parser, built with clang -fsanitize=fuzzer.
+ *
+ * The first byte of the input seeds how the rest is cut into chunks, so the
+ * fuzzer explores line and fold boundaries falling at every point of a
+ * chunk as well as the content itself. Feeds from ics_gen make a good seed
+ * corpus.
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include "feed_parser.h"
+
+#define FUZZ_NOW    1792800000  // 2026-10-25, inside the transitions the parser compiles
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    if (size == 0) {
+        return 0;
+    }
+    uint32_t state = data[0] * 2654435761u + 1;
+    data++;
+    size--;
+
+    feed_parser_stats_t stats;
+    feed_parser_begin(FUZZ_NOW);
+    for (size_t i = 0; i < size;) {
+        state = state * 1664525u + 1013904223u;
+        size_t n = 1 + (state >> 16) % 2048;
+        n = size - i < n ? size - i : n;
+        feed_parser_feed((const char *)data + i, n);
+        i += n;
+    }
+    feed_parser_finish(&stats);
+    return 0;
+}
@@ -0,0 +1,199 @@
+/*
+ * Checks event_heap.c against a full sort: random start times, with many
+ * ties, are shuffled and offered to a heap of K slots, and the drained
+ * slots must hold the K smallest in ascending order. Some trials also
+ * remove random held events, as an overridden occurrence does, and are
+ * checked against a sorted array that follows the heap's rules.
+ *
+ * Then times the heap against sorting every start, for the device's K = 50.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "calendar_manager.h"
+#include "event_heap.h"
+
+#define MAX_K       MAX_EVENTS
+#define MAX_INPUTS  2000
+#define TRIALS      20000
+
+static uint64_t rng = 88172645463325252ull;
+
+static uint32_t next_random(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    return (uint32_t)(rng >> 32);
+}
+
+static int compare_keys(const void *a, const void *b)
+{
+    int64_t x = *(const int64_t *)a, y = *(const int64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void shuffle(int64_t *v, int n)
+{
+    for (int i = n - 1; i > 0; i--) {
+        int k = (int)(next_random() % (uint32_t)(i + 1));
+        int64_t t = v[i];
+        v[i] = v[k];
+        v[k] = t;
+    }
+}
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+// Reference for the heap: the held keys kept sorted in an array
+typedef struct {
+    int64_t keys[MAX_K];
+    int count;
+} model_t;
+
+static void model_insert(model_t *m, int64_t key)
+{
+    int i = m->count++;
+    for (; i > 0 && m->keys[i - 1] > key; i--) {
+        m->keys[i] = m->keys[i - 1];
+    }
+    m->keys[i] = key;
+}
+
+static void model_remove(model_t *m, int64_t key)
+{
+    int i = 0;
+    while (m->keys[i] != key) {
+        i++;
+    }
+    memmove(&m->keys[i], &m->keys[i + 1], (size_t)(m->count - i - 1) * sizeof(m->keys[0]));
+    m->count--;
+}
+
+// The same rules as event_heap_offer(): a full heap takes a key only if it is below the largest held
+static void model_offer(model_t *m, int k, int64_t key)
+{
+    if (m->count < k) {
+        model_insert(m, key);
+    } else if (key < m->keys[m->count - 1]) {
+        m->count--;
+        model_insert(m, key);
+    }
+}
+
+/*
+ * Offers the inputs to a heap of k slots and compares the drained keys. Without
+ * removals they must be the k smallest inputs, as a full sort gives them. A
+ * removal leaves a hole that a later, larger event may fill, so with removals
+ * the reference is a sorted array that follows the same rules.
+ */
+static bool check(const int64_t *inputs, int n, int k, bool with_removals)
+{
+    int64_t keys[MAX_K], payload[MAX_K];
+    int16_t slots[MAX_K], pos[MAX_K], order[MAX_K];
+    static int64_t expected[MAX_INPUTS];
+    event_heap_t h;
+    model_t model = {.count = 0};
+    event_heap_init(&h, keys, slots, pos, (int16_t)k);
+
+    for (int i = 0; i < n; i++) {
+        int slot = event_heap_offer(&h, inputs[i]);
+        if (slot != EVENT_HEAP_NO_SLOT) {
+            payload[slot] = inputs[i];
+        }
+        model_offer(&model, k, inputs[i]);
+        if (with_removals && next_random() % 8 == 0) {
+            int victim = (int)(next_random() % (uint32_t)k);
+            if (event_heap_holds(&h, victim)) {
+                model_remove(&model, payload[victim]);
+                event_heap_remove(&h, victim);
+            }
+        }
+    }
+
+    int count;
+    if (with_removals) {
+        count = model.count;
+        memcpy(expected, model.keys, (size_t)count * sizeof(*expected));
+    } else {
+        memcpy(expected, inputs, (size_t)n * sizeof(*inputs));
+        qsort(expected, (size_t)n, sizeof(*expected), compare_keys);
+        count = n < k ? n : k;
+    }
+    if (event_heap_drain(&h, order) != count) {
+        return false;
+    }
+    for (int i = 0; i < count; i++) {
+        if (payload[order[i]] != expected[i] || keys[order[i]] != expected[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(void)
+{
+    static int64_t inputs[MAX_INPUTS];
+    int failures = 0;
+    for (int t = 0; t < TRIALS; t++) {
+        int n = (int)(next_random() % MAX_INPUTS);
+        int k = 1 + (int)(next_random() % MAX_K);
+        // A narrow range of starts makes ties common, as with events on the hour
+        uint32_t range = t % 2 ? 1u << 20 : (uint32_t)(n / 4 + 1);
+        for (int i = 0; i < n; i++) {
+            inputs[i] = 1792800000 + (int64_t)(next_random() % range) * 60;
+        }
+        shuffle(inputs, n);
+        bool with_removals = t % 4 == 3;
+        if (!check(inputs, n, k, with_removals)) {
+            if (failures++ < 10) {
+                printf("trial %d: n %d, k %d%s: heap differs from the sort\n", t, n, k,
+                       with_removals ? ", with removals" : "");
+            }
+        }
+    }
+    printf("%d trials of up to %d inputs and K up to %d, %d failures\n", TRIALS, MAX_INPUTS, MAX_K, failures);
+
+    // Offering 2000 occurrences to K = 50 against sorting all of them
+    int n = MAX_INPUTS;
+    for (int i = 0; i < n; i++) {
+        inputs[i] = 1792800000 + (int64_t)(next_random() % (14 * 24 * 60)) * 60;
+    }
+    static int64_t copy[MAX_INPUTS];
+    int64_t sink = 0;
+    double best_heap = 0, best_sort = 0;
+    for (int r = 0; r < 200; r++) {
+        int64_t keys[MAX_K];
+        int16_t slots[MAX_K], pos[MAX_K], order[MAX_K];
+        event_heap_t h;
+        double start = now_ms();
+        event_heap_init(&h, keys, slots, pos, MAX_K);
+        for (int i = 0; i < n; i++) {
+            event_heap_offer(&h, inputs[i]);
+        }
+        sink += event_heap_drain(&h, order);
+        double heap_ms = now_ms() - start;
+
+        start = now_ms();
+        memcpy(copy, inputs, sizeof(copy));
+        qsort(copy, (size_t)n, sizeof(*copy), compare_keys);
+        sink += copy[MAX_K - 1];
+        double sort_ms = now_ms() - start;
+
+        if (r == 0 || heap_ms < best_heap) {
+            best_heap = heap_ms;
+        }
+        if (r == 0 || sort_ms < best_sort) {
+            best_sort = sort_ms;
+        }
+    }
+    printf("%d starts, K = %d: heap %.1f us, qsort of all %.1f us\n", n, MAX_K, best_heap * 1e3, best_sort * 1e3);
+    return failures != 0 || sink == 0;
+}
@@ -0,0 +1,325 @@
+/*
+ * Writes a synthetic calendar feed shaped like the ones real servers send,
+ * for benchmarking and fuzzing the feed parser at any scale.
+ *
+ * The feed mixes what a parser has to cope with: VTIMEZONE blocks, single and
+ * recurring events (DAILY, WEEKLY with BYDAY, MONTHLY, with COUNT, UNTIL and
+ * EXDATE), all-day and multi-day events, overrides with RECURRENCE-ID,
+ * CJK and emoji summaries, long descriptions folded at 75 octets, base64
+ * ATTACH lines, VALARM blocks and VTODOs that are skipped unread. Line
+ * endings are CRLF, LF or a mix of both.
+ *
+ * Output is deterministic for a given seed; events cluster around the start
+ * date so the window the device keeps is always busy.
+ */
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define FOLD_OCTETS     75
+
+enum { EOL_CRLF, EOL_LF, EOL_MIXED };
+
+static int eol_mode = EOL_CRLF;
+static unsigned long long rng_state;
+static unsigned long lines_out;
+
+static unsigned rnd(void)
+{
+    // xorshift64*, so the output does not depend on the C library
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return (unsigned)((rng_state * 0x2545F4914F6CDD1Dull) >> 32);
+}
+
+static int pick(int n)
+{
+    return (int)(rnd() % (unsigned)n);
+}
+
+static const char *eol(void)
+{
+    if (eol_mode == EOL_LF || (eol_mode == EOL_MIXED && pick(4) == 0)) {
+        return "\n";
+    }
+    return "\r\n";
+}
+
+// Writes a content line, folded so no physical line exceeds 75 octets (RFC 5545 3.1)
+static void line(const char *text)
+{
+    size_t len = strlen(text);
+    size_t limit = FOLD_OCTETS;
+    size_t i = 0;
+    while (len - i > limit) {
+        // Folding inside a multi-byte character is legal but rare; do it now and then
+        size_t cut = i + limit;
+        if (pick(8) != 0) {
+            while (cut > i && ((unsigned char)text[cut] & 0xC0) == 0x80) {
+                cut--;
+            }
+        }
+        fwrite(text + i, 1, cut - i, stdout);
+        fputs(eol(), stdout);
+        fputc(pick(5) == 0 ? '\t' : ' ', stdout);
+        i = cut;
+        limit = FOLD_OCTETS - 1;
+    }
+    fputs(text + i, stdout);
+    fputs(eol(), stdout);
+    lines_out++;
+}
+
+__attribute__((format(printf, 1, 2)))
+static void linef(const char *fmt, ...)
+{
+    static char buf[8192];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    line(buf);
+}
+
+static const char *const words[] = {
+    "Meeting", "Review", "Standup", "Sync", "Planning", "Retro", "Lunch", "Dentist", "Call", "Demo",
+    "會議", "週會", "專案", "檢討", "午餐", "打球", "會面", "家長會",
+    "会議", "打ち合わせ", "レビュー", "회의", "점심", "🎉", "📅", "Café", "Straße",
+};
+#define WORD_COUNT  (int)(sizeof(words) / sizeof(words[0]))
+
+static const char *const zones[] = {"Asia/Taipei", "Europe/Berlin", "America/New_York"};
+
+// Appends n random words to buf, escaping nothing since words hold no special characters
+static void words_into(char *buf, size_t cap, int n)
+{
+    size_t len = strlen(buf);
+    for (int i = 0; i < n && len + 32 < cap; i++) {
+        len += (size_t)snprintf(buf + len, cap - len, "%s%s", i ? " " : "", words[pick(WORD_COUNT)]);
+    }
+}
+
+static void write_timezones(void)
+{
+    line("BEGIN:VTIMEZONE");
+    line("TZID:Asia/Taipei");
+    line("BEGIN:STANDARD");
+    line("DTSTART:19700101T000000");
+    line("TZOFFSETFROM:+0800");
+    line("TZOFFSETTO:+0800");
+    line("TZNAME:CST");
+    line("END:STANDARD");
+    line("END:VTIMEZONE");
+
+    line("BEGIN:VTIMEZONE");
+    line("TZID:Europe/Berlin");
+    line("BEGIN:DAYLIGHT");
+    line("TZOFFSETFROM:+0100");
+    line("TZOFFSETTO:+0200");
+    line("TZNAME:CEST");
+    line("DTSTART:19700329T020000");
+    line("RRULE:FREQ=YEARLY;BYMONTH=3;BYDAY=-1SU");
+    line("END:DAYLIGHT");
+    line("BEGIN:STANDARD");
+    line("TZOFFSETFROM:+0200");
+    line("TZOFFSETTO:+0100");
+    line("TZNAME:CET");
+    line("DTSTART:19701025T030000");
+    line("RRULE:FREQ=YEARLY;BYMONTH=10;BYDAY=-1SU");
+    line("END:STANDARD");
+    line("END:VTIMEZONE");
+
+    line("BEGIN:VTIMEZONE");
+    line("TZID:America/New_York");
+    line("BEGIN:DAYLIGHT");
+    line("TZOFFSETFROM:-0500");
+    line("TZOFFSETTO:-0400");
+    line("DTSTART:20070311T020000");
+    line("RRULE:FREQ=YEARLY;BYMONTH=3;BYDAY=2SU");
+    line("END:DAYLIGHT");
+    line("BEGIN:STANDARD");
+    line("TZOFFSETFROM:-0400");
+    line("TZOFFSETTO:-0500");
+    line("DTSTART:20071104T020000");
+    line("RRULE:FREQ=YEARLY;BYMONTH=11;BYDAY=1SU");
+    line("END:STANDARD");
+    line("END:VTIMEZONE");
+}
+
+static void format_date(time_t t, char *buf, size_t cap, int with_time)
+{
+    struct tm tm;
+    gmtime_r(&t, &tm);
+    if (with_time) {
+        strftime(buf, cap, "%Y%m%dT%H%M%S", &tm);
+    } else {
+        strftime(buf, cap, "%Y%m%d", &tm);
+    }
+}
+
+// An occasional base64 attachment, the longest lines a feed carries
+static void write_attachment(void)
+{
+    static const char b64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    static char buf[6144];
+    int n = 512 + pick(4096);
+    int len = snprintf(buf, sizeof(buf), "ATTACH;FMTTYPE=image/png;ENCODING=BASE64;VALUE=BINARY:");
+    for (int i = 0; i < n && len < (int)sizeof(buf) - 1; i++) {
+        buf[len++] = b64[pick(64)];
+    }
+    buf[len] = '\0';
+    line(buf);
+}
+
+static void write_event(int index, time_t base)
+{
+    char uid[48], start[32], until[32], summary[512], description[2048];
+    int zone = pick(3);
+    int all_day = pick(8) == 0;
+    int utc = !all_day && pick(6) == 0;
+    time_t t = base + (time_t)(pick(60 * 24) - 24 * 7) * 3600; // Within a week before and 53 days after base
+    t -= t % 900;
+    format_date(t, start, sizeof(start), !all_day);
+
+    snprintf(uid, sizeof(uid), "%08x-%d@bench.invalid", rnd(), index);
+    line("BEGIN:VEVENT");
+    linef("UID:%s", uid);
+    line("DTSTAMP:20240101T000000Z");
+    if (all_day) {
+        char end[32];
+        format_date(t + 86400 * (1 + (pick(4) == 0 ? pick(5) : 0)), end, sizeof(end), 0);
+        linef("DTSTART;VALUE=DATE:%s", start);
+        linef("DTEND;VALUE=DATE:%s", end);
+    } else if (utc) {
+        linef("DTSTART:%sZ", start);
+        linef("DURATION:PT%dM", 15 * (1 + pick(8)));
+    } else {
+        char end[32];
+        format_date(t + 1800 * (1 + pick(6)), end, sizeof(end), 1);
+        linef("DTSTART;TZID=%s:%s", zones[zone], start);
+        linef("DTEND;TZID=%s:%s", zones[zone], end);
+    }
+
+    summary[0] = '\0';
+    words_into(summary, sizeof(summary), 1 + pick(pick(10) == 0 ? 40 : 5));
+    linef("SUMMARY:%s %d", summary, index);
+    if (pick(3) == 0) {
+        char location[128] = "";
+        words_into(location, sizeof(location), 2);
+        linef("LOCATION:%s\\, Room %d", location, pick(500));
+    }
+    if (pick(2) == 0) {
+        description[0] = '\0';
+        words_into(description, sizeof(description), 5 + pick(120));
+        linef("DESCRIPTION:%s\\nhttps://meet.example.com/%08x", description, rnd());
+    }
+
+    int recur = pick(10);
+    if (recur < 2) {
+        linef("RRULE:FREQ=WEEKLY;BYDAY=%s", pick(2) ? "MO,WE,FR" : "TU,TH");
+        if (pick(2)) {
+            char exdate[32];
+            format_date(t + 7 * 86400, exdate, sizeof(exdate), !all_day);
+            linef("EXDATE%s:%s", all_day ? ";VALUE=DATE" : "", exdate);
+        }
+    } else if (recur == 2) {
+        format_date(t + 86400 * (10 + pick(60)), until, sizeof(until), 1);
+        linef("RRULE:FREQ=DAILY;UNTIL=%sZ", until);
+    } else if (recur == 3) {
+        linef("RRULE:FREQ=MONTHLY;COUNT=%d", 2 + pick(24));
+    }
+    line("SEQUENCE:0");
+    if (pick(20) == 0) {
+        write_attachment();
+    }
+    if (pick(4) == 0) {
+        line("BEGIN:VALARM");
+        line("ACTION:DISPLAY");
+        line("TRIGGER:-PT15M");
+        line("DESCRIPTION:Reminder");
+        line("END:VALARM");
+    }
+    line("END:VEVENT");
+
+    // The second week's occurrence of a weekly timed event, moved by an hour
+    if (recur < 2 && !all_day && pick(3) == 0) {
+        char original[32], moved[32];
+        format_date(t + 14 * 86400, original, sizeof(original), 1);
+        format_date(t + 14 * 86400 + 3600, moved, sizeof(moved), 1);
+        line("BEGIN:VEVENT");
+        linef("UID:%s", uid);
+        if (utc) {
+            linef("RECURRENCE-ID:%sZ", original);
+            linef("DTSTART:%sZ", moved);
+        } else {
+            linef("RECURRENCE-ID;TZID=%s:%s", zones[zone], original);
+            linef("DTSTART;TZID=%s:%s", zones[zone], moved);
+        }
+        line("DURATION:PT1H");
+        linef("SUMMARY:%s %d (moved)", summary, index);
+        line("SEQUENCE:1");
+        line("END:VEVENT");
+    }
+}
+
+static void write_todo(int index)
+{
+    line("BEGIN:VTODO");
+    linef("UID:todo-%d@bench.invalid", index);
+    line("SUMMARY:Something to do");
+    line("END:VTODO");
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s events [--seed N] [--start UNIX] [--crlf|--lf|--mixed] > feed.ics\n", argv0);
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        usage(argv[0]);
+    }
+    long events = atol(argv[1]);
+    unsigned long long seed = 1;
+    time_t start = time(NULL);
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--start") == 0 && i + 1 < argc) {
+            start = (time_t)strtoll(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--crlf") == 0) {
+            eol_mode = EOL_CRLF;
+        } else if (strcmp(argv[i], "--lf") == 0) {
+            eol_mode = EOL_LF;
+        } else if (strcmp(argv[i], "--mixed") == 0) {
+            eol_mode = EOL_MIXED;
+        } else {
+            usage(argv[0]);
+        }
+    }
+    if (events < 0) {
+        usage(argv[0]);
+    }
+    rng_state = seed * 0x9E3779B97F4A7C15ull + 1;
+
+    line("BEGIN:VCALENDAR");
+    line("VERSION:2.0");
+    line("PRODID:-//Glance//host_bench ics_gen//EN");
+    line("CALSCALE:GREGORIAN");
+    line("X-WR-CALNAME:Synthetic 合成 calendar");
+    write_timezones();
+    for (long i = 0; i < events; i++) {
+        write_event((int)i, start);
+        if (pick(50) == 0) {
+            write_todo((int)i);
+        }
+    }
+    line("END:VCALENDAR");
+    fprintf(stderr, "%ld events, %lu lines\n", events, lines_out);
+    return 0;
+}
@@ -0,0 +1,133 @@
+/*
+ * Compares fetching a calendar feed plain and gzip-compressed: bytes on the
+ * wire, and the CPU time to get from those bytes to tokenized properties.
+ *
+ * Input arrives in TCP-segment-sized chunks, as it does from esp_http_client.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "ics_tokenizer.h"
+#include "inflate_stream.h"
+
+#define CHUNK_SIZE  1436    // Typical TCP payload per segment
+#define SPILL_SIZE  1024
+
+static ics_tokenizer_t tokenizer;
+static char spill[SPILL_SIZE];
+static uint8_t window[INFLATE_STREAM_WINDOW_SIZE];
+static unsigned long properties;
+
+static bool on_property(const ics_property_t *prop, void *ctx)
+{
+    (void)prop;
+    (void)ctx;
+    properties++;
+    return true;
+}
+
+static bool on_inflated(const char *data, size_t len, void *ctx)
+{
+    (void)ctx;
+    return ics_tokenizer_feed(&tokenizer, data, len);
+}
+
+static unsigned char *read_file(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        perror(path);
+        exit(1);
+    }
+    fseek(f, 0, SEEK_END);
+    *len = (size_t)ftell(f);
+    rewind(f);
+    unsigned char *buf = malloc(*len);
+    if (fread(buf, 1, *len, f) != *len) {
+        perror(path);
+        exit(1);
+    }
+    fclose(f);
+    return buf;
+}
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static double run_plain(const unsigned char *data, size_t len)
+{
+    double start = now_ms();
+    ics_tokenizer_init(&tokenizer, spill, sizeof(spill), on_property, NULL);
+    for (size_t i = 0; i < len; i += CHUNK_SIZE) {
+        size_t n = len - i < CHUNK_SIZE ? len - i : CHUNK_SIZE;
+        ics_tokenizer_feed(&tokenizer, (const char *)data + i, n);
+    }
+    ics_tokenizer_finish(&tokenizer);
+    return now_ms() - start;
+}
+
+static double run_gzip(const unsigned char *data, size_t len)
+{
+    double start = now_ms();
+    inflate_stream_t inflater;
+    ics_tokenizer_init(&tokenizer, spill, sizeof(spill), on_property, NULL);
+    inflate_stream_init(&inflater, INFLATE_STREAM_GZIP, window, on_inflated, NULL);
+    for (size_t i = 0; i < len; i += CHUNK_SIZE) {
+        size_t n = len - i < CHUNK_SIZE ? len - i : CHUNK_SIZE;
+        if (!inflate_stream_feed(&inflater, data + i, n)) {
+            fprintf(stderr, "gzip error: %s\n", inflater.error ? inflater.error : "aborted");
+            exit(1);
+        }
+    }
+    ics_tokenizer_finish(&tokenizer);
+    if (!inflate_stream_done(&inflater)) {
+        fprintf(stderr, "gzip stream incomplete\n");
+        exit(1);
+    }
+    return now_ms() - start;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s feed.ics feed.ics.gz [rounds] [link kB/s]\n", argv[0]);
+        return 1;
+    }
+    int rounds = argc > 3 ? atoi(argv[3]) : 20;
+    double link = argc > 4 ? atof(argv[4]) : 250.0;
+
+    size_t plain_len, gzip_len;
+    unsigned char *plain = read_file(argv[1], &plain_len);
+    unsigned char *gzip = read_file(argv[2], &gzip_len);
+
+    double plain_ms = 0, gzip_ms = 0;
+    unsigned long plain_props = 0, gzip_props = 0;
+    for (int r = 0; r < rounds; r++) {
+        properties = 0;
+        plain_ms += run_plain(plain, plain_len);
+        plain_props = properties;
+        properties = 0;
+        gzip_ms += run_gzip(gzip, gzip_len);
+        gzip_props = properties;
+    }
+    if (plain_props != gzip_props) {
+        fprintf(stderr, "property count differs: %lu plain, %lu gzip\n", plain_props, gzip_props);
+        return 1;
+    }
+    plain_ms /= rounds;
+    gzip_ms /= rounds;
+
+    printf("%lu properties, %d rounds\n", plain_props, rounds);
+    printf("           wire bytes      CPU ms    airtime ms at %.0f kB/s\n", link);
+    printf("plain    %12zu  %10.2f  %10.0f\n", plain_len, plain_ms, plain_len / link);
+    printf("gzip     %12zu  %10.2f  %10.0f\n", gzip_len, gzip_ms, gzip_len / link);
+    printf("ratio    %11.1fx  %9.2fx\n", (double)plain_len / gzip_len, gzip_ms / plain_ms);
+    free(plain);
+    free(gzip);
+    return 0;
+}
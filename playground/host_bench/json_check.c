@@ -0,0 +1,137 @@
+/*
+ * Checks json_extract.c on chunked input: each fixture, among them the
+ * ip-api.com responses timezone_manager.c reads, is split at every pair of
+ * points into three chunks, some of them empty, and every split must give
+ * the members exactly as the fixture's expected values list them.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "json_extract.h"
+
+#define MEMBER_COUNT    5
+#define VALUE_MAX       128
+
+// The fields timezone_manager.c asks for
+static const char *const keys[] = {"status", "message", "timezone", "offset", "query", NULL};
+
+typedef struct {
+    const char *name;
+    const char *json;
+    const char *expected[MEMBER_COUNT];  // NULL for a member that must not be reported
+} fixture_t;
+
+static const fixture_t fixtures[] = {
+    {
+        "ip-api success",
+        "{\"status\":\"success\",\"timezone\":\"Asia/Taipei\",\"offset\":28800,\"query\":\"203.0.113.7\"}",
+        {"success", NULL, "Asia/Taipei", "28800", "203.0.113.7"},
+    },
+    {
+        "ip-api fail",
+        "{\"status\":\"fail\",\"message\":\"private range\",\"query\":\"10.0.0.1\"}",
+        {"fail", "private range", NULL, NULL, "10.0.0.1"},
+    },
+    {
+        // The default response, pretty-printed, with the fields in another order
+        "ip-api full",
+        "{\n  \"query\": \"2001:db8::1\",\n  \"status\": \"success\",\n  \"country\": \"United States\",\n"
+        "  \"countryCode\": \"US\",\n  \"lat\": 40.7128,\n  \"lon\": -74.006,\n"
+        "  \"timezone\": \"America/New_York\",\n  \"isp\": \"Example \\\"ISP\\\"\",\n  \"offset\": -14400\n}\n",
+        {"success", NULL, "America/New_York", "-14400", "2001:db8::1"},
+    },
+    {
+        // Nested members with the same keys must not match; escapes are decoded
+        "nested and escaped",
+        "{\"nested\":{\"timezone\":\"Wrong/Zone\",\"offset\":1},\"list\":[{\"status\":\"x\"},\"a\\\"]b\",[1,2]],"
+        "\"timezone\":\"Europe\\/Berlin\",\"message\":\"caf\\u00e9 \\ud83d\\ude00 \\\"q\\\"\\n\","
+        "\"status\":\"success\",\"offset\":7200}",
+        {"success", "caf\xc3\xa9 \xf0\x9f\x98\x80 \"q\"\n", "Europe/Berlin", "7200", NULL},
+    },
+    {
+        // A number at the very end is completed by json_extract_finish()
+        "bare number",
+        "{\"query\":\"198.51.100.2\",\"offset\":-3600",
+        {NULL, NULL, NULL, "-3600", "198.51.100.2"},
+    },
+};
+
+typedef struct {
+    char values[MEMBER_COUNT][VALUE_MAX];
+    size_t lengths[MEMBER_COUNT];
+    int ends[MEMBER_COUNT];
+    bool overflow;
+} result_t;
+
+static bool on_value(int member, const char *data, size_t len, void *ctx)
+{
+    result_t *r = ctx;
+    if (data == NULL) {
+        r->ends[member]++;
+        return true;
+    }
+    if (r->lengths[member] + len >= VALUE_MAX) {
+        r->overflow = true;
+        return true;
+    }
+    memcpy(r->values[member] + r->lengths[member], data, len);
+    r->lengths[member] += len;
+    return true;
+}
+
+// Returns NULL if the result is as expected, or what differs
+static const char *compare(const fixture_t *f, const result_t *r)
+{
+    static char why[256];
+    if (r->overflow) {
+        return "a value overflowed";
+    }
+    for (int m = 0; m < MEMBER_COUNT; m++) {
+        const char *want = f->expected[m];
+        if (want == NULL) {
+            if (r->ends[m] != 0 || r->lengths[m] != 0) {
+                snprintf(why, sizeof(why), "%s reported but not expected", keys[m]);
+                return why;
+            }
+            continue;
+        }
+        if (r->ends[m] != 1 || r->lengths[m] != strlen(want) || memcmp(r->values[m], want, r->lengths[m]) != 0) {
+            snprintf(why, sizeof(why), "%s is [%.*s] (ended %d times), expected [%s]", keys[m],
+                     (int)r->lengths[m], r->values[m], r->ends[m], want);
+            return why;
+        }
+    }
+    return NULL;
+}
+
+static void parse(const char *json, size_t len, size_t i, size_t j, result_t *r)
+{
+    json_extract_t x;
+    memset(r, 0, sizeof(*r));
+    json_extract_init(&x, keys, on_value, r);
+    json_extract_feed(&x, json, i);
+    json_extract_feed(&x, json + i, j - i);
+    json_extract_feed(&x, json + j, len - j);
+    json_extract_finish(&x);
+}
+
+int main(void)
+{
+    long splits = 0, failures = 0;
+    for (size_t k = 0; k < sizeof(fixtures) / sizeof(fixtures[0]); k++) {
+        const fixture_t *f = &fixtures[k];
+        size_t len = strlen(f->json);
+        for (size_t i = 0; i <= len; i++) {
+            for (size_t j = i; j <= len; j++) {
+                result_t r;
+                parse(f->json, len, i, j, &r);
+                splits++;
+                const char *why = compare(f, &r);
+                if (why != NULL && failures++ < 10) {
+                    printf("%s, split at %zu and %zu: %s\n", f->name, i, j, why);
+                }
+            }
+        }
+    }
+    printf("%zu fixtures, %ld splits, %ld failures\n", sizeof(fixtures) / sizeof(fixtures[0]), splits, failures);
+    return failures != 0;
+}
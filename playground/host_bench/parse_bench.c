@@ -0,0 +1,102 @@
+/*
+ * Measures the feed parser on a host: throughput in MB/s and VEVENTs/s, and
+ * the peak bytes of event text and of the line spill buffer.
+ *
+ * The feed is pushed in chunks of random size, as HTTP_EVENT_ON_DATA hands
+ * them over, so lines and folds are split at arbitrary points. Each round
+ * must yield the same events whatever the chunking.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "feed_parser.h"
+
+static unsigned char *read_file(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        perror(path);
+        exit(1);
+    }
+    fseek(f, 0, SEEK_END);
+    *len = (size_t)ftell(f);
+    rewind(f);
+    unsigned char *buf = malloc(*len ? *len : 1);
+    if (fread(buf, 1, *len, f) != *len) {
+        perror(path);
+        exit(1);
+    }
+    fclose(f);
+    return buf;
+}
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static double run(const unsigned char *data, size_t len, int64_t now, size_t max_chunk, feed_parser_stats_t *stats)
+{
+    double start = now_ms();
+    feed_parser_begin(now);
+    for (size_t i = 0; i < len;) {
+        size_t n = 1 + (size_t)rand() % max_chunk;
+        n = len - i < n ? len - i : n;
+        feed_parser_feed((const char *)data + i, n);
+        i += n;
+    }
+    feed_parser_finish(stats);
+    return now_ms() - start;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s feed.ics [rounds] [max chunk bytes] [now]\n", argv[0]);
+        return 1;
+    }
+    int rounds = argc > 2 ? atoi(argv[2]) : 10;
+    size_t max_chunk = argc > 3 ? (size_t)atol(argv[3]) : 1436;
+    int64_t now = argc > 4 ? atoll(argv[4]) : (int64_t)time(NULL);
+    if (rounds < 1 || max_chunk < 1) {
+        fprintf(stderr, "rounds and chunk size must be positive\n");
+        return 1;
+    }
+
+    size_t len;
+    unsigned char *data = read_file(argv[1], &len);
+    srand(1);
+
+    feed_parser_stats_t first, stats;
+    double total_ms = 0, best_ms = 0;
+    for (int r = 0; r < rounds; r++) {
+        double ms = run(data, len, now, max_chunk, &stats);
+        total_ms += ms;
+        if (r == 0 || ms < best_ms) {
+            best_ms = ms;
+        }
+        if (r == 0) {
+            first = stats;
+        } else if (stats.vevents != first.vevents || stats.occurrences != first.occurrences ||
+                   stats.kept != first.kept || stats.lines != first.lines) {
+            fprintf(stderr, "round %d parsed differently than round 0\n", r);
+            return 1;
+        }
+    }
+    double mean_ms = total_ms / rounds;
+
+    printf("%zu bytes, %zu lines, %u VEVENTs, %u zones; chunks of 1-%zu bytes, %d rounds\n",
+           first.bytes, first.lines, first.vevents, first.zones, max_chunk, rounds);
+    printf("%u occurrences in the window, %u kept, %u of them untitled; %u exceptions refused by the index\n",
+           first.occurrences, first.kept, first.untitled, first.index_dropped);
+    printf("CPU ms       mean %.2f, best %.2f\n", mean_ms, best_ms);
+    printf("throughput   %.1f MB/s, %.0f VEVENTs/s\n",
+           first.bytes / 1e3 / best_ms, first.vevents * 1e3 / best_ms);
+    printf("peak memory  %zu bytes of event text (%u strings dropped, %u compactions), %zu bytes of spilled line\n",
+           first.arena_high_water, first.arena_overflows, first.arena_compactions, first.spill_high_water);
+    free(data);
+    return 0;
+}
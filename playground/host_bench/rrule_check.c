@@ -0,0 +1,139 @@
+/*
+ * Checks the COUNT skip of ics_rrule.c against a walk from DTSTART: random
+ * DAILY, WEEKLY, MONTHLY and YEARLY rules with intervals, BYDAY ordinals,
+ * BYMONTH and BYMONTHDAY, starting up to 40 years before the window. Each
+ * rule is expanded once over the window and once from DTSTART on, and the
+ * occurrences in the window must be the same.
+ *
+ * Then times expanding COUNT rules over the window against the series' age.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "civil_time.h"
+#include "ics_rrule.h"
+
+#define TRIALS          50000
+#define WINDOW_START    1792800000  // 2026-10-24 00:00, local
+#define WINDOW_DAYS     15
+#define MAX_OCCURRENCES 512
+
+static uint64_t rng = 88172645463325252ull;
+
+static uint32_t next_random(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    return (uint32_t)(rng >> 32);
+}
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static void random_rule(char *buf, size_t cap)
+{
+    static const char *const freqs[] = {"DAILY", "WEEKLY", "MONTHLY", "YEARLY"};
+    static const char *const days[] = {"SU", "MO", "TU", "WE", "TH", "FR", "SA"};
+    int freq = (int)(next_random() % 4);
+    int len = snprintf(buf, cap, "FREQ=%s;COUNT=%u", freqs[freq], 1 + next_random() % 5000);
+    if (next_random() % 2) {
+        len += snprintf(buf + len, cap - (size_t)len, ";INTERVAL=%u", 1 + next_random() % 4);
+    }
+    if (next_random() % 2) {
+        len += snprintf(buf + len, cap - (size_t)len, ";BYDAY=");
+        int n = 1 + (int)(next_random() % 4);
+        for (int i = 0; i < n; i++) {
+            // Ordinals only where RFC 5545 allows them
+            int nth = freq >= 2 && next_random() % 2 ? (int)(next_random() % 11) - 5 : 0;
+            if (freq == 3 && nth != 0 && next_random() % 2) {
+                nth = (int)(next_random() % 105) - 52;
+            }
+            len += snprintf(buf + len, cap - (size_t)len, "%s%.0d%s", i ? "," : "", nth, days[next_random() % 7]);
+        }
+    }
+    if (next_random() % 4 == 0) {
+        len += snprintf(buf + len, cap - (size_t)len, ";BYMONTH=%u,%u", 1 + next_random() % 12, 1 + next_random() % 12);
+    }
+    if (next_random() % 4 == 0) {
+        int d = (int)(next_random() % 62) - 31;
+        len += snprintf(buf + len, cap - (size_t)len, ";BYMONTHDAY=%d,%u", d ? d : 1, 1 + next_random() % 31);
+    }
+    if (next_random() % 4 == 0) {
+        snprintf(buf + len, cap - (size_t)len, ";WKST=%s", days[next_random() % 7]);
+    }
+}
+
+static int expand(const ics_rrule_t *rule, int64_t dtstart, int64_t from, int64_t *out)
+{
+    int64_t window_end = WINDOW_START + WINDOW_DAYS * CIVIL_SECS_PER_DAY;
+    ics_rrule_iter_t it;
+    ics_rrule_iter_init(&it, rule, dtstart, from, window_end);
+    int n = 0;
+    int64_t start;
+    while (ics_rrule_iter_next(&it, &start)) {
+        if (start >= WINDOW_START && n < MAX_OCCURRENCES) {
+            out[n++] = start;
+        }
+    }
+    return n;
+}
+
+int main(void)
+{
+    static int64_t skipped[MAX_OCCURRENCES], walked[MAX_OCCURRENCES];
+    long failures = 0, occurrences = 0;
+    for (int t = 0; t < TRIALS; t++) {
+        char value[160];
+        random_rule(value, sizeof(value));
+        ics_rrule_t rule;
+        ics_rrule_parse(value, strlen(value), &rule);
+        int64_t dtstart = WINDOW_START - (int64_t)(next_random() % (40 * 366)) * CIVIL_SECS_PER_DAY +
+                          (int64_t)(next_random() % 96) * 900;
+
+        int n = expand(&rule, dtstart, WINDOW_START, skipped);
+        int m = expand(&rule, dtstart, dtstart, walked);
+        occurrences += m;
+        if (n != m || memcmp(skipped, walked, (size_t)n * sizeof(*skipped)) != 0) {
+            if (failures++ < 10) {
+                civil_time_t c;
+                civil_from_seconds(dtstart, &c);
+                printf("%s from %04d-%02d-%02d: %d occurrences in the window, %d by walking\n", value,
+                       (int)c.year, c.month, c.day, n, m);
+            }
+        }
+    }
+    printf("%d rules, %ld occurrences in the window, %ld failures\n", TRIALS, occurrences, failures);
+
+    // Expanding a weekday stand-up and a monthly rule over the window, by the age of the series
+    static const char *const timed[] = {
+        "FREQ=DAILY;BYDAY=MO,TU,WE,TH,FR;COUNT=100000",
+        "FREQ=MONTHLY;BYDAY=-1FR;COUNT=100000",
+    };
+    int64_t sink = 0;
+    for (size_t k = 0; k < sizeof(timed) / sizeof(timed[0]); k++) {
+        ics_rrule_t rule;
+        ics_rrule_parse(timed[k], strlen(timed[k]), &rule);
+        printf("%-44s", timed[k]);
+        for (int years = 1; years <= 30; years *= 5) {
+            int64_t dtstart = WINDOW_START - (int64_t)years * 365 * CIVIL_SECS_PER_DAY + 9 * 3600;
+            double start = now_ms();
+            for (int r = 0; r < 1000; r++) {
+                ics_rrule_iter_t it;
+                ics_rrule_iter_init(&it, &rule, dtstart, WINDOW_START, WINDOW_START + WINDOW_DAYS * CIVIL_SECS_PER_DAY);
+                int64_t occurrence;
+                while (ics_rrule_iter_next(&it, &occurrence)) {
+                    sink += occurrence;
+                }
+            }
+            printf("  %2d years %6.2f us", years, now_ms() - start); // 1000 runs, so ms are us per run
+        }
+        printf("\n");
+    }
+    return failures != 0 || sink == 0;
+}
@@ -0,0 +1,126 @@
+/*
+ * Measures the ics_scan.c kernels on a feed in MB/s: the line feed search
+ * alone, the line and delimiter search the tokenizer makes per line, and the
+ * whole tokenizer without a filter.
+ *
+ * Build it once as is and once with -DCONFIG_GLANCE_ICS_SCAN_SCALAR to
+ * compare the SWAR kernels with the byte-at-a-time fallback. Both builds
+ * print the same checksum of the positions found, or one of them is wrong.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "ics_scan.h"
+#include "ics_tokenizer.h"
+
+static unsigned char *read_file(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        perror(path);
+        exit(1);
+    }
+    fseek(f, 0, SEEK_END);
+    *len = (size_t)ftell(f);
+    rewind(f);
+    unsigned char *buf = malloc(*len ? *len : 1);
+    if (fread(buf, 1, *len, f) != *len) {
+        perror(path);
+        exit(1);
+    }
+    fclose(f);
+    return buf;
+}
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static uint64_t scan_eol(const char *data, size_t len)
+{
+    uint64_t sum = 0;
+    const char *end = data + len;
+    for (const char *p = data; p < end; p++) {
+        p = ics_scan_eol(p, end);
+        sum += (uint64_t)(p - data);
+    }
+    return sum;
+}
+
+static uint64_t scan_lines(const char *data, size_t len)
+{
+    uint64_t sum = 0;
+    const char *end = data + len;
+    for (const char *p = data; p < end; p++) {
+        const char *delim;
+        p = ics_scan_line(p, end, &delim);
+        sum += (uint64_t)(p - data) * 31 + (uint64_t)(delim - data);
+    }
+    return sum;
+}
+
+static bool on_property(const ics_property_t *prop, void *ctx)
+{
+    uint64_t *sum = ctx;
+    *sum = *sum * 31 + prop->name_len + prop->params_len + prop->value_len;
+    return true;
+}
+
+static uint64_t tokenize(const char *data, size_t len)
+{
+    static char spill[1024];
+    uint64_t sum = 0;
+    ics_tokenizer_t tok;
+    ics_tokenizer_init(&tok, spill, sizeof(spill), on_property, &sum);
+    ics_tokenizer_feed(&tok, data, len);
+    ics_tokenizer_finish(&tok);
+    return sum;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s feed.ics [rounds]\n", argv[0]);
+        return 1;
+    }
+    int rounds = argc > 2 ? atoi(argv[2]) : 20;
+    if (rounds < 1) {
+        fprintf(stderr, "rounds must be positive\n");
+        return 1;
+    }
+    size_t len;
+    const char *data = (const char *)read_file(argv[1], &len);
+
+    static const struct {
+        const char *name;
+        uint64_t (*run)(const char *, size_t);
+    } kernels[] = {
+        {"ics_scan_eol", scan_eol},
+        {"ics_scan_line", scan_lines},
+        {"tokenizer", tokenize},
+    };
+#ifdef CONFIG_GLANCE_ICS_SCAN_SCALAR
+    printf("scalar kernels, %zu bytes, best of %d rounds\n", len, rounds);
+#else
+    printf("SWAR kernels, %zu bytes, best of %d rounds\n", len, rounds);
+#endif
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+        double best_ms = 0;
+        uint64_t sum = 0;
+        for (int r = 0; r < rounds; r++) {
+            double start = now_ms();
+            sum = kernels[k].run(data, len);
+            double ms = now_ms() - start;
+            if (r == 0 || ms < best_ms) {
+                best_ms = ms;
+            }
+        }
+        printf("%-14s %8.1f MB/s   checksum %016llx\n", kernels[k].name, len / 1e3 / best_ms,
+               (unsigned long long)sum);
+    }
+    return 0;
+}
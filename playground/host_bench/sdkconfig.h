@@ -0,0 +1,2 @@
+// Host builds of Glance/main sources use the Kconfig defaults
+#pragma once
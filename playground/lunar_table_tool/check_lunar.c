@@ -0,0 +1,129 @@
+/*
+ * Checks lunar_calendar.c against ICU's Chinese calendar for every day from
+ * 1970 to 2100, and against published dates: Lunar New Years, leap months,
+ * Qingming and the days off of 2026.
+ *
+ * The generator starts a month a day before or after ICU where ICU's new
+ * moon is too far off; those days are counted as moved month starts. Any
+ * other difference from ICU is an error.
+ *
+ *   gcc -O2 -I../../Glance/main check_lunar.c ../../Glance/main/lunar_calendar.c -licui18n -licuuc -o check_lunar
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unicode/ucal.h>
+#include "civil_time.h"
+#include "lunar_calendar.h"
+
+static int errors;
+
+static void expect(bool ok, const char *what, int a, int b, int c)
+{
+    if (!ok) {
+        printf("%s %d-%d-%d\n", what, a, b, c);
+        errors++;
+    }
+}
+
+int main(void)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    UChar zone[16];
+    u_uastrcpy(zone, "Asia/Taipei");
+    UCalendar *cal = ucal_open(zone, -1, "zh_TW@calendar=chinese", UCAL_DEFAULT, &status);
+    if (U_FAILURE(status)) {
+        printf("ucal_open: %s\n", u_errorName(status));
+        return 1;
+    }
+
+    int64_t first = civil_days_from_date(LUNAR_FIRST_YEAR, 1, 1);
+    int64_t last = civil_days_from_date(LUNAR_LAST_YEAR, 12, 31);
+    int days = 0, moved = 0;
+    for (int64_t day = first; day <= last; day++) {
+        lunar_date_t date;
+        if (!lunar_date_from_days(day, &date)) {
+            expect(false, "no lunar date for day", (int)day, 0, 0);
+            continue;
+        }
+        ucal_setMillis(cal, ((double)day * CIVIL_SECS_PER_DAY + 4 * 3600) * 1000.0, &status);
+        int month = ucal_get(cal, UCAL_MONTH, &status) + 1;
+        int leap = ucal_get(cal, UCAL_IS_LEAP_MONTH, &status);
+        int mday = ucal_get(cal, UCAL_DATE, &status);
+        days++;
+        bool same = date.month == month && date.leap == (leap != 0) && date.day == mday;
+        bool shifted = date.month == month && date.leap == (leap != 0) && abs(date.day - mday) == 1;
+        if (!same && (shifted || (date.day == 1 && mday >= 29) || (mday == 1 && date.day >= 29))) {
+            // Counted once, on the day only one of them starts a month
+            moved += (date.day == 1 && mday > 2) || (mday == 1 && date.day > 2);
+            continue;
+        }
+        if (!same) {
+            int32_t y;
+            int8_t m, d;
+            civil_date_from_days(day, &y, &m, &d);
+            printf("%04d-%02d-%02d: %d%s/%d, ICU %d%s/%d\n", (int)y, m, d, date.month, date.leap ? "L" : "",
+                   date.day, month, leap ? "L" : "", mday);
+            errors++;
+        }
+    }
+    ucal_close(cal);
+    expect(!lunar_date_from_days(first - 1, &(lunar_date_t){0}), "date before the table", 0, 0, 0);
+    expect(!lunar_date_from_days(last + 1, &(lunar_date_t){0}), "date after the table", 0, 0, 0);
+
+    // Lunar New Years and leap months as published
+    static const struct {
+        int year, month, day, leap;
+    } new_years[] = {
+        {1970, 2, 6, 0}, {1971, 1, 27, 5}, {1984, 2, 2, 10}, {2000, 2, 5, 0}, {2001, 1, 24, 4}, {2020, 1, 25, 4},
+        {2021, 2, 12, 0}, {2022, 2, 1, 0}, {2023, 1, 22, 2}, {2024, 2, 10, 0}, {2025, 1, 29, 6},
+        {2026, 2, 17, 0}, {2027, 2, 6, 0}, {2028, 1, 26, 5}, {2030, 2, 3, 0}, {2031, 1, 23, 3},
+        {2033, 1, 31, 11},
+    };
+    for (size_t i = 0; i < sizeof(new_years) / sizeof(new_years[0]); i++) {
+        lunar_date_t date;
+        int64_t day = civil_days_from_date(new_years[i].year, new_years[i].month, new_years[i].day);
+        lunar_date_from_days(day, &date);
+        expect(date.month == 1 && date.day == 1 && !date.leap && date.year == new_years[i].year,
+               "not a New Year:", new_years[i].year, new_years[i].month, new_years[i].day);
+        bool has_leap = false;
+        for (int64_t d = day; d < day + 384; d++) {
+            lunar_date_from_days(d, &date);
+            if (date.year == new_years[i].year && date.leap && date.day == 1) {
+                expect(date.month == new_years[i].leap, "other leap month in", new_years[i].year, date.month, 0);
+                has_leap = true;
+            }
+        }
+        expect(has_leap == (new_years[i].leap != 0), "leap month missing in", new_years[i].year, 0, 0);
+    }
+
+    // Qingming
+    static const int qingming[][2] = {
+        {2008, 4}, {2010, 5}, {2012, 4}, {2014, 5}, {2016, 4}, {2018, 5}, {2020, 4}, {2021, 4},
+        {2022, 5}, {2023, 5}, {2024, 4}, {2025, 4}, {2026, 5}, {2027, 5}, {2028, 4},
+    };
+    for (size_t i = 0; i < sizeof(qingming) / sizeof(qingming[0]); i++) {
+        int64_t day = civil_days_from_date(qingming[i][0], 4, qingming[i][1]);
+        taiwan_holiday_t h = taiwan_holiday(day);
+        expect(h == TAIWAN_HOLIDAY_TOMB_SWEEPING_DAY || h == TAIWAN_HOLIDAY_CHILDRENS_DAY,
+               "not Qingming:", qingming[i][0], 4, qingming[i][1]);
+    }
+
+    // Days off in 2026, as announced
+    static const int days_off_2026[][2] = {
+        {1, 1}, {2, 16}, {2, 17}, {2, 18}, {2, 19}, {2, 20}, {2, 27}, {4, 3}, {4, 6}, {5, 1},
+        {6, 19}, {9, 25}, {9, 28}, {10, 9}, {10, 26}, {12, 25},
+    };
+    int listed = 0;
+    for (size_t i = 0; i < sizeof(days_off_2026) / sizeof(days_off_2026[0]); i++) {
+        int64_t day = civil_days_from_date(2026, days_off_2026[i][0], days_off_2026[i][1]);
+        expect(taiwan_is_day_off(day), "not a day off:", 2026, days_off_2026[i][0], days_off_2026[i][1]);
+    }
+    for (int64_t day = civil_days_from_date(2026, 1, 1); day < civil_days_from_date(2027, 1, 1); day++) {
+        listed += taiwan_is_day_off(day) && civil_weekday(day) != 0 && civil_weekday(day) != 6;
+    }
+    expect(listed == (int)(sizeof(days_off_2026) / sizeof(days_off_2026[0])), "weekday days off in 2026:", listed, 0, 0);
+
+    printf("%d days checked against ICU, %d month starts moved, %d errors\n", days, moved, errors);
+    return errors != 0;
+}
@@ -0,0 +1,438 @@
+/*
+ * Generates Glance/main/lunar_table.h: the Chinese lunar calendar and the
+ * Taiwan public holidays from 1970 to 2100, packed for O(1) lookups on the
+ * device (lunar_calendar.c).
+ *
+ * Months are numbered, and leap months placed, by ICU's Chinese calendar,
+ * evaluated at noon in Taipei. ICU's new moons can be minutes off, which
+ * moves a month start when the new moon is close to midnight (it puts the
+ * 2027 New Year on February 7 instead of the 6th), so each month starts on
+ * the day of the new moon computed here instead, with the method of Meeus,
+ * Astronomical Algorithms ch. 49, good to seconds. Tomb Sweeping Day is the
+ * day the Sun reaches longitude 15 degrees (Qingming), computed with the
+ * low-accuracy solar theory of ch. 25, good to about 0.01 degree. Holidays follow
+ * the rules of the Act on Memorial Days and Holidays as amended in 2025,
+ * applied to every year.
+ *
+ *   gcc -O2 -I../../Glance/main lunar_table.c -licui18n -licuuc -lm -o lunar_table
+ *   ./lunar_table > ../../Glance/main/lunar_table.h
+ */
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unicode/ucal.h>
+#include "civil_time.h"
+
+#define FIRST_YEAR      1970
+#define LAST_YEAR       2100
+#define LUNAR_FIRST     (FIRST_YEAR - 1)    // January 1970 is still in the lunar year of 1969
+#define YEARS           (LAST_YEAR - LUNAR_FIRST + 1)
+#define HOLIDAY_YEARS   (LAST_YEAR - FIRST_YEAR + 1)
+#define HOLIDAY_BYTES   46                  // 366 bits
+
+// Lunar date of every day from the first of LUNAR_FIRST until two months after LAST_YEAR
+#define DAY0            civil_days_from_date(LUNAR_FIRST, 1, 1)
+#define DAY_COUNT       (civil_days_from_date(LAST_YEAR + 2, 3, 1) - DAY0)
+
+typedef struct {
+    int8_t month;   // 1-12
+    bool leap;
+    int8_t day;     // 1-30
+} lunar_t;
+
+static lunar_t *days;
+static int icu_moves;   // Months whose start was moved from ICU's
+
+static lunar_t *lunar_at(int64_t day)
+{
+    return &days[day - DAY0];
+}
+
+static void fail(const char *what, UErrorCode status)
+{
+    fprintf(stderr, "%s: %s\n", what, u_errorName(status));
+    exit(1);
+}
+
+static void read_icu(void)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    UChar zone[16];
+    u_uastrcpy(zone, "Asia/Taipei");
+    UCalendar *cal = ucal_open(zone, -1, "zh_TW@calendar=chinese", UCAL_DEFAULT, &status);
+    if (U_FAILURE(status)) {
+        fail("ucal_open", status);
+    }
+    days = calloc((size_t)DAY_COUNT, sizeof(*days));
+    for (int64_t i = 0; i < DAY_COUNT; i++) {
+        // Noon keeps clear of the hour Taiwan's summer time moved
+        double millis = ((double)(DAY0 + i) * CIVIL_SECS_PER_DAY + 4 * 3600) * 1000.0;
+        ucal_setMillis(cal, millis, &status);
+        days[i].month = (int8_t)(ucal_get(cal, UCAL_MONTH, &status) + 1);
+        days[i].leap = ucal_get(cal, UCAL_IS_LEAP_MONTH, &status) != 0;
+        days[i].day = (int8_t)ucal_get(cal, UCAL_DATE, &status);
+        if (U_FAILURE(status)) {
+            fail("ucal_get", status);
+        }
+    }
+    ucal_close(cal);
+}
+
+#define RAD(deg)    ((deg) * M_PI / 180)
+
+static double delta_t(double y);
+
+// Julian ephemeris day of the k-th new moon after that of 2000-01-06
+static double new_moon(double k)
+{
+    double t = k / 1236.85;
+    double jde = 2451550.09766 + 29.530588861 * k + 0.00015437 * t * t - 0.000000150 * t * t * t +
+                 0.00000000073 * t * t * t * t;
+    double e = 1 - 0.002516 * t - 0.0000074 * t * t;
+    double m = RAD(2.5534 + 29.10535670 * k - 0.0000014 * t * t - 0.00000011 * t * t * t);
+    double mp = RAD(201.5643 + 385.81693528 * k + 0.0107582 * t * t + 0.00001238 * t * t * t -
+                    0.000000058 * t * t * t * t);
+    double f = RAD(160.7108 + 390.67050284 * k - 0.0016118 * t * t - 0.00000227 * t * t * t +
+                   0.000000011 * t * t * t * t);
+    double omega = RAD(124.7746 - 1.56375588 * k + 0.0020672 * t * t + 0.00000215 * t * t * t);
+
+    jde += -0.40720 * sin(mp) + 0.17241 * e * sin(m) + 0.01608 * sin(2 * mp) + 0.01039 * sin(2 * f) +
+           0.00739 * e * sin(mp - m) - 0.00514 * e * sin(mp + m) + 0.00208 * e * e * sin(2 * m) -
+           0.00111 * sin(mp - 2 * f) - 0.00057 * sin(mp + 2 * f) + 0.00056 * e * sin(2 * mp + m) -
+           0.00042 * sin(3 * mp) + 0.00042 * e * sin(m + 2 * f) + 0.00038 * e * sin(m - 2 * f) -
+           0.00024 * e * sin(2 * mp - m) - 0.00017 * sin(omega) - 0.00007 * sin(mp + 2 * m) +
+           0.00004 * sin(2 * mp - 2 * f) + 0.00004 * sin(3 * m) + 0.00003 * sin(mp + m - 2 * f) +
+           0.00003 * sin(2 * mp + 2 * f) - 0.00003 * sin(mp + m + 2 * f) + 0.00003 * sin(mp - m + 2 * f) -
+           0.00002 * sin(mp - m - 2 * f) - 0.00002 * sin(3 * mp + m) + 0.00002 * sin(4 * mp);
+
+    // Planetary arguments
+    static const double a[14][3] = {
+        {299.77, 0.107408, 0.000325}, {251.88, 0.016321, 0.000165}, {251.83, 26.651886, 0.000164},
+        {349.42, 36.412478, 0.000126}, {84.66, 18.206239, 0.000110}, {141.74, 53.303771, 0.000062},
+        {207.14, 2.453732, 0.000060}, {154.84, 7.306860, 0.000056}, {34.52, 27.261239, 0.000047},
+        {207.19, 0.121824, 0.000042}, {291.34, 1.844379, 0.000040}, {161.72, 24.198154, 0.000037},
+        {239.56, 25.513099, 0.000035}, {331.55, 3.592518, 0.000023},
+    };
+    for (int i = 0; i < 14; i++) {
+        double arg = a[i][0] + a[i][1] * k - (i == 0 ? 0.009173 * t * t : 0);
+        jde += a[i][2] * sin(RAD(arg));
+    }
+    return jde;
+}
+
+// Day in Taiwan (UTC+8) of the new moon closest to a day
+static int64_t new_moon_day(int64_t day)
+{
+    double k = round((2440587.5 + day - 2451550.09766) / 29.530588861);
+    double jde = new_moon(k);
+    double ut = jde - delta_t(2000 + k / 12.3685) / CIVIL_SECS_PER_DAY;
+    return (int64_t)floor(ut - 2440587.5 + 8.0 / 24);
+}
+
+// Starts each of ICU's months on the day of its new moon
+static void correct_month_starts(void)
+{
+    // Month starts in ICU's numbering, then the days between them renumbered
+    int64_t count = DAY_COUNT;
+    lunar_t *fixed = calloc((size_t)count, sizeof(*fixed));
+    int64_t prev_start = -1;
+    lunar_t prev = {0};
+    for (int64_t i = 0; i < count; i++) {
+        if (days[i].day != 1) {
+            continue;
+        }
+        int64_t start = new_moon_day(DAY0 + i) - DAY0;
+        if (start != i) {
+            int32_t y;
+            int8_t m, d;
+            civil_date_from_days(DAY0 + i, &y, &m, &d);
+            fprintf(stderr, "month %d%s starts a day %s than ICU's %04d-%02d-%02d\n", days[i].month,
+                    days[i].leap ? " (leap)" : "", start < i ? "earlier" : "later", (int)y, m, d);
+            icu_moves++;
+        }
+        if (prev_start >= 0) {
+            for (int64_t j = prev_start; j < start && j < count; j++) {
+                fixed[j] = (lunar_t){.month = prev.month, .leap = prev.leap, .day = (int8_t)(j - prev_start + 1)};
+            }
+        }
+        prev_start = start < 0 ? 0 : start;
+        prev = days[i];
+    }
+    // Before the first and after the last month start, ICU's dates stand
+    for (int64_t j = 0; j < count; j++) {
+        if (fixed[j].day == 0) {
+            fixed[j] = days[j];
+        }
+    }
+    free(days);
+    days = fixed;
+}
+
+// --- Qingming ---
+
+// TT - UT in seconds, from the polynomials of Espenak and Meeus
+static double delta_t(double y)
+{
+    double t;
+    if (y < 1986) {
+        t = y - 1975;
+        return 45.45 + 1.067 * t - t * t / 260 - t * t * t / 718;
+    }
+    if (y < 2005) {
+        t = y - 2000;
+        return 63.86 + 0.3345 * t - 0.060374 * t * t + 0.0017275 * t * t * t +
+               0.000651814 * pow(t, 4) + 0.00002373599 * pow(t, 5);
+    }
+    if (y < 2050) {
+        t = y - 2000;
+        return 62.92 + 0.32217 * t + 0.005589 * t * t;
+    }
+    t = (y - 1820) / 100;
+    return -20 + 32 * t * t - 0.5628 * (2150 - y);
+}
+
+// Apparent longitude of the Sun in degrees at a Julian ephemeris day
+static double sun_longitude(double jde)
+{
+    double t = (jde - 2451545.0) / 36525;
+    double l0 = 280.46646 + 36000.76983 * t + 0.0003032 * t * t;
+    double m = (357.52911 + 35999.05029 * t - 0.0001537 * t * t) * M_PI / 180;
+    double c = (1.914602 - 0.004817 * t - 0.000014 * t * t) * sin(m) +
+               (0.019993 - 0.000101 * t) * sin(2 * m) + 0.000289 * sin(3 * m);
+    double omega = (125.04 - 1934.136 * t) * M_PI / 180;
+    double lambda = fmod(l0 + c - 0.00569 - 0.00478 * sin(omega), 360);
+    return lambda < 0 ? lambda + 360 : lambda;
+}
+
+// Day of April in Taiwan when the Sun reaches 15 degrees
+static int qingming_day(int year)
+{
+    double lo = 2440587.5 + civil_days_from_date(year, 3, 30);
+    double hi = lo + 10;
+    while (hi - lo > 1e-6) {
+        double mid = (lo + hi) / 2;
+        if (sun_longitude(mid) < 15) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    double ut = lo - delta_t(year + 0.26) / CIVIL_SECS_PER_DAY;
+    int64_t day = (int64_t)floor(ut - 2440587.5 + 8.0 / 24);
+    int32_t y;
+    int8_t m, d;
+    civil_date_from_days(day, &y, &m, &d);
+    if (m != 4 || d < 4 || d > 7) {
+        fprintf(stderr, "Qingming %d on %d-%d is out of range\n", year, m, d);
+        exit(1);
+    }
+    return d;
+}
+
+// --- Lunar years ---
+
+/*
+ * Word per lunar year, indexed by the Gregorian year its New Year falls in:
+ *   bits 0-12   month lengths in order, leap month included; 1 = 30 days
+ *   bits 13-16  leap month: it follows this month, 0 if none
+ *   bits 17-22  New Year as the zero-based day of the Gregorian year
+ *   bits 23-24  Qingming in April of the Gregorian year, minus 4
+ */
+static uint32_t lunar_word(int year, int64_t *new_year)
+{
+    int64_t day = civil_days_from_date(year, 1, 1);
+    while (!(lunar_at(day)->month == 1 && !lunar_at(day)->leap && lunar_at(day)->day == 1)) {
+        day++;
+    }
+    *new_year = day;
+    uint32_t word = (uint32_t)(day - civil_days_from_date(year, 1, 1)) << 17;
+    word |= (uint32_t)(qingming_day(year) - 4) << 23;
+
+    int month = 0;
+    int64_t start = day;
+    while (true) {
+        int64_t next = start + 29;
+        if (lunar_at(next)->day == 30) {
+            word |= 1u << month;
+            next++;
+        }
+        if (lunar_at(next)->day != 1 || lunar_at(next - 1)->day < 29) {
+            fprintf(stderr, "odd month at day %lld\n", (long long)start);
+            exit(1);
+        }
+        if (lunar_at(start)->leap) {
+            word |= (uint32_t)lunar_at(start)->month << 13;
+        }
+        month++;
+        start = next;
+        if (lunar_at(start)->month == 1 && !lunar_at(start)->leap) {
+            break;
+        }
+    }
+    if (month != 12 + ((word >> 13 & 0xF) != 0)) {
+        fprintf(stderr, "lunar year %d has %d months\n", year, month);
+        exit(1);
+    }
+    return word;
+}
+
+// --- Holidays ---
+
+static uint8_t holidays[HOLIDAY_YEARS][HOLIDAY_BYTES];
+
+static bool is_weekend(int64_t day)
+{
+    int w = civil_weekday(day);
+    return w == 0 || w == 6;
+}
+
+static bool is_holiday(int64_t day)
+{
+    int32_t y;
+    int8_t m, d;
+    civil_date_from_days(day, &y, &m, &d);
+    if (y < FIRST_YEAR || y > LAST_YEAR) {
+        return false;
+    }
+    int doy = civil_day_of_year(y, m, d);
+    return holidays[y - FIRST_YEAR][doy / 8] >> (doy % 8) & 1;
+}
+
+static void set_holiday(int64_t day)
+{
+    int32_t y;
+    int8_t m, d;
+    civil_date_from_days(day, &y, &m, &d);
+    if (y >= FIRST_YEAR && y <= LAST_YEAR) {
+        int doy = civil_day_of_year(y, m, d);
+        holidays[y - FIRST_YEAR][doy / 8] |= (uint8_t)(1 << (doy % 8));
+    }
+}
+
+// A holiday on a Saturday is taken the Friday before, on a Sunday the Monday after
+static void add_holiday(int64_t day)
+{
+    set_holiday(day);
+    int w = civil_weekday(day);
+    if (w == 6 || w == 0) {
+        int step = w == 6 ? -1 : 1;
+        int64_t other = day + step;
+        while (is_weekend(other) || is_holiday(other)) {
+            other += step;
+        }
+        set_holiday(other);
+    }
+}
+
+static int64_t lunar_day(int64_t new_year, uint32_t word, int month, int day)
+{
+    int leap = (int)(word >> 13 & 0xF);
+    int index = month - 1 + (leap != 0 && month > leap);
+    int64_t start = new_year;
+    for (int i = 0; i < index; i++) {
+        start += 29 + (word >> i & 1);
+    }
+    return start + day - 1;
+}
+
+static void build_holidays(const uint32_t *words, const int64_t *new_years)
+{
+    for (int y = FIRST_YEAR; y <= LAST_YEAR; y++) {
+        uint32_t word = words[y - LUNAR_FIRST];
+        int64_t new_year = new_years[y - LUNAR_FIRST];
+
+        // Two days before the Lunar New Year through its third day; those on
+        // a weekend are made up with the working days that follow
+        int weekend_days = 0;
+        for (int64_t day = new_year - 2; day <= new_year + 2; day++) {
+            set_holiday(day);
+            weekend_days += is_weekend(day);
+        }
+        for (int64_t day = new_year + 3; weekend_days > 0; day++) {
+            if (!is_weekend(day) && !is_holiday(day)) {
+                set_holiday(day);
+                weekend_days--;
+            }
+        }
+
+        add_holiday(civil_days_from_date(y, 1, 1));     // Founding Day
+        add_holiday(civil_days_from_date(y, 2, 28));    // Peace Memorial Day
+        add_holiday(civil_days_from_date(y, 5, 1));     // Labour Day
+        add_holiday(civil_days_from_date(y, 9, 28));    // Teachers' Day
+        add_holiday(civil_days_from_date(y, 10, 10));   // National Day
+        add_holiday(civil_days_from_date(y, 10, 25));   // Retrocession Day
+        add_holiday(civil_days_from_date(y, 12, 25));   // Constitution Day
+        add_holiday(lunar_day(new_year, word, 5, 5));   // Dragon Boat Festival
+        add_holiday(lunar_day(new_year, word, 8, 15));  // Mid-Autumn Festival
+
+        // Children's Day and Tomb Sweeping Day; when they fall together the
+        // day before is taken instead, or the day after if that is a Friday
+        int64_t children = civil_days_from_date(y, 4, 4);
+        int64_t qingming = civil_days_from_date(y, 4, 4 + (int)(word >> 23 & 3));
+        if (qingming != children) {
+            add_holiday(children);
+            add_holiday(qingming);
+        } else {
+            add_holiday(children);
+            if (civil_weekday(children) == 4) {
+                set_holiday(children + 1);
+            } else if (!is_weekend(children)) {
+                set_holiday(children - 1);
+            }
+        }
+    }
+}
+
+// --- Output ---
+
+int main(void)
+{
+    // Example 49.a of Meeus: the new moon of 1977 February 18, 3:37:42 TD
+    if (fabs(new_moon(-283) - 2443192.65118) > 1e-5) {
+        fprintf(stderr, "new moon example is off by %.6f days\n", new_moon(-283) - 2443192.65118);
+        return 1;
+    }
+    read_icu();
+    correct_month_starts();
+
+    uint32_t words[YEARS];
+    int64_t new_years[YEARS];
+    for (int y = LUNAR_FIRST; y <= LAST_YEAR; y++) {
+        words[y - LUNAR_FIRST] = lunar_word(y, &new_years[y - LUNAR_FIRST]);
+    }
+    build_holidays(words, new_years);
+
+    printf("// Generated by playground/lunar_table_tool/lunar_table.c. Do not edit.\n");
+    printf("#ifndef LUNAR_TABLE_H\n#define LUNAR_TABLE_H\n\n#include <stdint.h>\n\n");
+    printf("#define LUNAR_TABLE_FIRST_YEAR  %d   // Gregorian year of the first lunar New Year\n", LUNAR_FIRST);
+    printf("#define LUNAR_TABLE_YEARS       %d\n", YEARS);
+    printf("#define HOLIDAY_TABLE_FIRST_YEAR %d\n", FIRST_YEAR);
+    printf("#define HOLIDAY_TABLE_YEARS     %d\n\n", HOLIDAY_YEARS);
+
+    printf("/*\n * Lunar year starting in each Gregorian year:\n");
+    printf(" *   bits 0-12   month lengths in order, leap month included; 1 = 30 days\n");
+    printf(" *   bits 13-16  leap month: it follows this month, 0 if none\n");
+    printf(" *   bits 17-22  New Year as the zero-based day of the Gregorian year\n");
+    printf(" *   bits 23-24  Qingming in April of the Gregorian year, minus 4\n */\n");
+    printf("static const uint32_t lunar_years[LUNAR_TABLE_YEARS] = {\n");
+    for (int i = 0; i < YEARS; i++) {
+        printf("%s0x%07x,%s", i % 8 == 0 ? "    " : " ", words[i], i % 8 == 7 || i == YEARS - 1 ? "\n" : "");
+    }
+    printf("};\n\n");
+
+    printf("// Days off by day of the year, bit 0 of byte 0 being January 1; weekends are not included\n");
+    printf("static const uint8_t holiday_bits[HOLIDAY_TABLE_YEARS][%d] = {\n", HOLIDAY_BYTES);
+    for (int y = 0; y < HOLIDAY_YEARS; y++) {
+        printf("    {");
+        for (int i = 0; i < HOLIDAY_BYTES; i++) {
+            printf("%s0x%02x", i ? "," : "", holidays[y][i]);
+        }
+        printf("}, // %d\n", FIRST_YEAR + y);
+    }
+    printf("};\n\n#endif // LUNAR_TABLE_H\n");
+    fprintf(stderr, "%d lunar years, %d month starts moved from ICU's\n", YEARS, icu_moves);
+    return 0;
+}
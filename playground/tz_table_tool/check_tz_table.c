@@ -0,0 +1,89 @@
+/*
+ * Checks the generated table against the zoneinfo it came from. Reads the
+ * "name, TZ, IANA zone" lines of `tz_table.py --list` and, for each name:
+ *
+ *   - looks it up and expects the same TZ string back,
+ *   - compiles that string with ics_tz_compile_posix() and compares the UTC
+ *     offset hour by hour over the check years with what the C library
+ *     reads from the TZif file of the IANA zone (itself, or the zone a
+ *     Windows name maps to).
+ *
+ * Names that are not zones must not be found.
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "civil_time.h"
+#include "ics_tz.h"
+#include "tz_posix.h"
+
+#define FIRST_YEAR  2026
+#define LAST_YEAR   2030
+
+static int32_t libc_offset(time_t t)
+{
+    struct tm tm;
+    localtime_r(&t, &tm);
+    return (int32_t)tm.tm_gmtoff;
+}
+
+int main(void)
+{
+    char line[256];
+    int names = 0, lookup_errors = 0, compile_errors = 0, offset_errors = 0, false_hits = 0;
+    int64_t from = civil_days_from_date(FIRST_YEAR, 1, 1) * CIVIL_SECS_PER_DAY;
+    int64_t to = civil_days_from_date(LAST_YEAR + 1, 1, 1) * CIVIL_SECS_PER_DAY;
+
+    while (fgets(line, sizeof(line), stdin) != NULL) {
+        // Tab-separated, since Windows names hold spaces
+        char *name = strtok(line, "\t");
+        char *posix = strtok(NULL, "\t");
+        char *iana = strtok(NULL, "\t\r\n");
+        if (name == NULL || posix == NULL || iana == NULL) {
+            continue;
+        }
+        names++;
+
+        const char *found = tz_posix_lookup(name, strlen(name));
+        if (found == NULL || strcmp(found, posix) != 0) {
+            printf("%s: looked up %s, expected %s\n", name, found ? found : "nothing", posix);
+            lookup_errors++;
+            continue;
+        }
+
+        // Names that differ by one character are not zones
+        char other[258];
+        snprintf(other, sizeof(other), "%s_", name);
+        if (tz_posix_lookup(other, strlen(other)) != NULL) {
+            printf("%s: found, but it is not a zone\n", other);
+            false_hits++;
+        }
+
+        ics_tz_zone_t zone;
+        if (!ics_tz_compile_posix(&zone, found, FIRST_YEAR, LAST_YEAR) || zone.overflow) {
+            printf("%s: %s does not compile\n", name, found);
+            compile_errors++;
+            continue;
+        }
+        setenv("TZ", iana, 1);
+        tzset();
+        for (int64_t t = from; t < to; t += 3600) {
+            int32_t expected = libc_offset((time_t)t);
+            int32_t got = ics_tz_offset_at(&zone, t);
+            if (got != expected) {
+                civil_time_t c;
+                civil_from_seconds(t, &c);
+                printf("%s: %s gives %d at %04d-%02d-%02d %02d:00Z, zoneinfo %d\n",
+                       name, found, (int)got, (int)c.year, c.month, c.day, c.hour, (int)expected);
+                offset_errors++;
+                break;
+            }
+        }
+    }
+
+    printf("tzdata %s: %d names, %d lookup errors, %d false hits, %d not compiled, %d with other offsets\n",
+           tz_posix_version(), names, lookup_errors, false_hits, compile_errors, offset_errors);
+    return lookup_errors || false_hits || compile_errors ? 1 : 0;
+}
@@ -0,0 +1,220 @@
+"""
+Generates Glance/main/tz_posix_table.h, the table that turns an IANA zone
+name such as "Asia/Taipei" into a POSIX TZ string such as "CST-8".
+
+The input is a compiled zoneinfo directory, e.g. /usr/share/zoneinfo or the
+output of `make install` in a tzdata release. Each TZif file (version 2 or
+later) ends with the POSIX TZ string for times after its last transition;
+that string is what goes into the table, for every zone and link name.
+With --windows, the Windows zone names of CLDR's windowsZones.xml, such as
+"Taipei Standard Time", are added too, with the string of the IANA zone
+CLDR maps them to for territory 001.
+
+Names are looked up by their ics_tz_hash() through a minimal perfect hash
+(hash and displace): the hash picks a bucket, and the bucket's displacement
+picks the slot, so a lookup reads two array entries and compares one hash.
+Keep the hash functions in sync with tz_posix.c.
+"""
+import argparse
+import os
+import sys
+import xml.etree.ElementTree as ET
+
+SKIP_DIRS = {"posix", "right"}
+SKIP_NAMES = {"posixrules", "localtime", "Factory"}
+BUCKET_LOAD = 4     # Average names per bucket
+MAX_DISPLACEMENT = 0xFFFF
+
+
+def fnv1a(text):
+    """ics_tz_hash()"""
+    h = 0x811C9DC5
+    for b in text.encode():
+        h = ((h ^ b) * 0x01000193) & 0xFFFFFFFF
+    return h
+
+
+def mix(h):
+    """tz_mix() in tz_posix.c, the finalizer of MurmurHash3"""
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & 0xFFFFFFFF
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & 0xFFFFFFFF
+    h ^= h >> 16
+    return h
+
+
+def slot_of(h, displacement, count):
+    return mix(h ^ ((displacement * 0x9E3779B9) & 0xFFFFFFFF)) % count
+
+
+def read_footer(path):
+    """POSIX TZ string at the end of a TZif file, None if it is not one."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"TZif" or data[4:5] < b"2" or not data.endswith(b"\n"):
+        return None
+    footer = data[:-1].rsplit(b"\n", 1)[1].decode("ascii")
+    return footer or None
+
+
+def read_zones(zoneinfo):
+    zones = {}
+    for root, dirs, files in os.walk(zoneinfo):
+        rel_root = os.path.relpath(root, zoneinfo)
+        dirs[:] = sorted(d for d in dirs if not (rel_root == "." and d in SKIP_DIRS))
+        for name in sorted(files):
+            zone = os.path.normpath(os.path.join(rel_root, name)).replace(os.sep, "/")
+            if zone in SKIP_NAMES:
+                continue
+            footer = read_footer(os.path.join(root, name))
+            if footer is not None:
+                zones[zone] = footer
+    return zones
+
+
+def read_windows_zones(path, zones):
+    """Windows zone name -> IANA name, from the default (001) territory entries."""
+    windows = {}
+    for entry in ET.parse(path).getroot().iter("mapZone"):
+        if entry.get("territory") != "001":
+            continue
+        name, iana = entry.get("other"), entry.get("type").split()[0]
+        if iana not in zones:
+            print(f"skipping {name}: {iana} is not in the zoneinfo", file=sys.stderr)
+            continue
+        if name in zones:
+            if zones[name] != zones[iana]:
+                sys.exit(f"{name} is both a Windows and an IANA name, with other rules")
+            continue  # Such as "UTC"
+        windows[name] = iana
+    return windows
+
+
+def read_version(zoneinfo):
+    for name, prefix in (("+VERSION", ""), ("tzdata.zi", "# version ")):
+        try:
+            with open(os.path.join(zoneinfo, name)) as f:
+                line = f.readline().strip()
+        except OSError:
+            continue
+        if line.startswith(prefix):
+            return line[len(prefix):]
+    return "unknown"
+
+
+def build(zones):
+    """Returns (displacements, slots): slots[i] is the name in slot i."""
+    names = sorted(zones)
+    hashes = {name: fnv1a(name) for name in names}
+    seen = {}
+    for name, h in hashes.items():
+        if h in seen:
+            sys.exit(f"hash collision: {seen[h]} and {name}")
+        seen[h] = name
+
+    count = len(names)
+    bucket_count = max(1, (count + BUCKET_LOAD - 1) // BUCKET_LOAD)
+    buckets = [[] for _ in range(bucket_count)]
+    for name in names:
+        buckets[mix(hashes[name]) % bucket_count].append(name)
+
+    displacements = [0] * bucket_count
+    slots = [None] * count
+    # Fuller buckets first, while most slots are still free
+    for b in sorted(range(bucket_count), key=lambda b: (-len(buckets[b]), b)):
+        if not buckets[b]:
+            continue
+        for d in range(MAX_DISPLACEMENT + 1):
+            wanted = {slot_of(hashes[n], d, count) for n in buckets[b]}
+            if len(wanted) == len(buckets[b]) and all(slots[s] is None for s in wanted):
+                break
+        else:
+            sys.exit(f"no displacement found for bucket {b}")
+        displacements[b] = d
+        for n in buckets[b]:
+            slots[slot_of(hashes[n], d, count)] = n
+    return displacements, slots, hashes
+
+
+def c_string(text):
+    return '"' + text.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+
+def write_table(out, zones, version, windows):
+    displacements, slots, hashes = build(zones)
+    rules = sorted(set(zones.values()))
+    rule_index = {rule: i for i, rule in enumerate(rules)}
+    disp_type = "uint8_t" if max(displacements) <= 0xFF else "uint16_t"
+
+    w = out.write
+    source = "tzdata %s and CLDR windowsZones" % version if windows else "tzdata %s" % version
+    w("// Generated by playground/tz_table_tool/tz_table.py from %s. Do not edit.\n" % source)
+    w("#ifndef TZ_POSIX_TABLE_H\n#define TZ_POSIX_TABLE_H\n\n")
+    w("#include <stdint.h>\n\n")
+    w("#define TZ_POSIX_VERSION    %s\n" % c_string(version))
+    w("#define TZ_POSIX_COUNT      %d\n" % len(slots))
+    w("#define TZ_POSIX_BUCKETS    %d\n\n" % len(displacements))
+
+    w("static const char *const tz_posix_rules[%d] = {\n" % len(rules))
+    for rule in rules:
+        w("    %s,\n" % c_string(rule))
+    w("};\n\n")
+
+    w("static const %s tz_posix_displacements[TZ_POSIX_BUCKETS] = {\n" % disp_type)
+    for i in range(0, len(displacements), 16):
+        w("    " + " ".join("%d," % d for d in displacements[i:i + 16]) + "\n")
+    w("};\n\n")
+
+    # ics_tz_hash() of the name in each slot, and the index of its rule
+    w("static const uint32_t tz_posix_hashes[TZ_POSIX_COUNT] = {\n")
+    for name in slots:
+        note = " -> " + windows[name] if name in windows else ""
+        w("    0x%08x, // %s%s\n" % (hashes[name], name, note))
+    w("};\n\n")
+
+    w("static const uint16_t tz_posix_rule_of[TZ_POSIX_COUNT] = {\n")
+    for i in range(0, len(slots), 16):
+        w("    " + " ".join("%d," % rule_index[zones[n]] for n in slots[i:i + 16]) + "\n")
+    w("};\n\n")
+    w("#endif // TZ_POSIX_TABLE_H\n")
+    return len(slots), len(rules), len(displacements)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("zoneinfo", help="compiled zoneinfo directory")
+    parser.add_argument("-o", "--output", help="header to write (default: stdout)")
+    parser.add_argument("--windows", metavar="XML",
+                        help="also map the Windows names of CLDR's windowsZones.xml")
+    parser.add_argument("--list", action="store_true",
+                        help="print the zone names and their TZ strings instead")
+    args = parser.parse_args()
+
+    zones = read_zones(args.zoneinfo)
+    if not zones:
+        sys.exit(f"no TZif files in {args.zoneinfo}")
+    windows = read_windows_zones(args.windows, zones) if args.windows else {}
+    for name, iana in windows.items():
+        zones[name] = zones[iana]
+    if args.list:
+        # Windows names are followed by their IANA zone, as names may hold spaces
+        for name in sorted(zones):
+            if name in windows:
+                print("%s\t%s\t%s" % (name, zones[name], windows[name]))
+            else:
+                print("%s\t%s\t%s" % (name, zones[name], name))
+        return
+
+    version = read_version(args.zoneinfo)
+    if args.output:
+        with open(args.output, "w", newline="\n") as out:
+            count, rules, buckets = write_table(out, zones, version, windows)
+        print(f"tzdata {version}: {count} names ({len(windows)} Windows), {rules} distinct TZ strings, "
+              f"{buckets} buckets", file=sys.stderr)
+    else:
+        write_table(sys.stdout, zones, version, windows)
+
+
+if __name__ == "__main__":
+    main()